@@ -56,6 +56,8 @@
 #     DEAL_II_DOXYGEN_USE_ONLINE_MATHJAX
 #     DEAL_II_CPACK_EXTERNAL_LIBS
 #     DEAL_II_CPACK_BUNDLE_NAME
+#     DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX
+#     DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_PAIRS
 #
 # *)  May also be set via environment variable (CXXFLAGS, LDFLAGS)
 #     (a nonempty cached variable has precedence and will not be
@@ -370,6 +372,16 @@ set(DEAL_II_CPACK_BUNDLE_NAME "${DEAL_II_PACKAGE_NAME}" CACHE STRING
   )
 mark_as_advanced(DEAL_II_CPACK_BUNDLE_NAME)
 
+set(DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX "6" CACHE STRING
+  "The largest polynomial degree for which the evaluation kernels of FEEvaluation and FEFaceEvaluation with run-time polynomial degree are precompiled in the library, for several numbers of quadrature points per polynomial degree. Larger values increase the compile time and size of the library."
+  )
+mark_as_advanced(DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX)
+
+set(DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_PAIRS "" CACHE STRING
+  "A semicolon-separated list of pairs of the form <degree>:<n_q_points_1d> for which the evaluation kernels of FEEvaluation and FEFaceEvaluation with run-time polynomial degree are precompiled in the library in addition to the ones selected by DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX, e.g. \"8:9;8:12\"."
+  )
+mark_as_advanced(DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_PAIRS)
+
 
 ########################################################################
 #                                                                      #
@@ -17,6 +17,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/mutex.h>
@@ -299,6 +300,38 @@ public:
   size_type
   index_within_set(const size_type global_index) const;
 
+  /**
+   * Compute nth_index_in_set() for each of the given @p local_indices and
+   * store the results in @p global_indices, which must have the same size.
+   *
+   * Rather than searching each index separately, this function walks
+   * through the ranges of this index set and the given indices
+   * simultaneously, skipping ranges with an exponentially growing step. If
+   * the indices are sorted, the cost is therefore proportional to the number
+   * of given indices plus the logarithm of the number of ranges between
+   * consecutive indices, which is much cheaper than a binary search for each
+   * index on sets with many ranges. Unsorted indices are allowed, but a
+   * decreasing index restarts the search with a binary search.
+   */
+  void
+  nth_index_in_set(const ArrayView<const size_type> &local_indices,
+                   const ArrayView<size_type>       &global_indices) const;
+
+  /**
+   * Compute index_within_set() for each of the given @p global_indices and
+   * store the results in @p local_indices, which must have the same size.
+   * The result is numbers::invalid_dof_index for indices that are not
+   * elements of this set, so this function can also be used to answer
+   * is_element() for many indices at once.
+   *
+   * The indices are processed as described for the nth_index_in_set()
+   * function taking an array of indices, i.e., this function is most
+   * efficient if the indices are sorted.
+   */
+  void
+  index_within_set(const ArrayView<const size_type> &global_indices,
+                   const ArrayView<size_type>       &local_indices) const;
+
   /**
    * Each index set can be represented as the union of a number of contiguous
    * intervals of indices, where if necessary intervals may only consist of
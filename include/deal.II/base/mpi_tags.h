@@ -151,6 +151,9 @@ namespace Utilities
           affine_constraints_make_consistent_in_parallel_0,
           affine_constraints_make_consistent_in_parallel_1,
 
+          // Utilities::MPI::Partitioner::reinit_from_superset()
+          partitioner_reinit_from_superset,
+
         };
       } // namespace Tags
     }   // namespace internal
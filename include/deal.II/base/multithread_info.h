@@ -52,11 +52,46 @@ DEAL_II_NAMESPACE_OPEN
  * threads can be queried using MultithreadInfo::n_threads(), while the number
  * of cores in the system is returned by MultithreadInfo::n_cores().
  *
+ * On machines with several NUMA domains (e.g., several sockets), the speed of
+ * memory-bound operations such as vector updates depends on whether each
+ * thread works on data in the memory attached to its own domain. Operating
+ * systems place a page of memory on the domain of the thread that first
+ * writes to it ("first touch"). For this placement to be useful, the threads
+ * must stay on their cores and each thread must process the same part of
+ * the data in every loop. set_thread_affinity() provides both: it binds the
+ * threads of the task scheduler to cores and makes the loops over vector
+ * entries in deal.II, including the initialization of AlignedVector and
+ * LinearAlgebra::distributed::Vector, assign the same index ranges to the
+ * same threads in every call.
+ *
  * @ingroup threads
  */
 class MultithreadInfo
 {
 public:
+  /**
+   * Policies for binding the threads of the task scheduler to the cores
+   * available to the current process, see set_thread_affinity().
+   */
+  enum class ThreadAffinity
+  {
+    /**
+     * Let the operating system place the threads, and let the task scheduler
+     * balance the work of parallel loops dynamically. This is the default.
+     */
+    none,
+    /**
+     * Bind the threads to the cores available to the process one after the
+     * other, in the order in which the operating system numbers them.
+     */
+    compact,
+    /**
+     * Distribute the threads evenly over the cores available to the process,
+     * e.g., over all sockets when using fewer threads than cores.
+     */
+    scatter
+  };
+
   /**
    * Constructor. This constructor is deleted because no instance of
    * this class needs to be constructed (all members are static).
@@ -122,6 +157,32 @@ public:
   static void
   initialize_multithreading();
 
+  /**
+   * Set the policy for binding threads to cores. For any policy other than
+   * ThreadAffinity::none, each thread of the task scheduler is bound to one
+   * of the cores the process is allowed to run on at the time of the first
+   * call to this function, which respects the binding of MPI processes set
+   * up by the MPI launcher. In addition, the parallel loops over vector
+   * entries use a static assignment of index ranges to threads instead of a
+   * dynamic one, so that every loop over a vector of a given size, starting
+   * with the first touch of its memory, runs on the same threads. See the
+   * general documentation of this class.
+   *
+   * The policy can also be selected with the environment variable
+   * DEAL_II_THREAD_AFFINITY, which may be set to `none`, `compact`, or
+   * `scatter`. The binding is only implemented on Linux with the
+   * Threading Building Blocks; elsewhere, only the static assignment of
+   * ranges to threads is used.
+   */
+  static void
+  set_thread_affinity(const ThreadAffinity affinity);
+
+  /**
+   * Return the policy set by set_thread_affinity().
+   */
+  static ThreadAffinity
+  get_thread_affinity();
+
 
 #  ifdef DEAL_II_WITH_TASKFLOW
   /**
@@ -141,6 +202,11 @@ private:
    */
   static unsigned int n_max_threads;
 
+  /**
+   * Variable representing the policy for binding threads to cores.
+   */
+  static ThreadAffinity thread_affinity;
+
 #  ifdef DEAL_II_WITH_TASKFLOW
   /**
    * Store a taskflow Executor that is constructed with N workers (from
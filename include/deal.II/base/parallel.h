@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/mutex.h>
 #include <deal.II/base/synchronous_iterator.h>
 #include <deal.II/base/template_constraints.h>
@@ -94,6 +95,12 @@ namespace parallel
 
     /**
      * Encapsulate tbb::parallel_for when an affinite_partitioner is provided.
+     *
+     * If threads are bound to cores with
+     * MultithreadInfo::set_thread_affinity(), a tbb::static_partitioner is
+     * used instead, which assigns the same subranges to the same threads in
+     * every call and thus keeps the data touched by a thread in the memory
+     * attached to its core.
      */
     template <typename Iterator, typename Functor>
     void
@@ -103,9 +110,19 @@ namespace parallel
                  const unsigned int                                grainsize,
                  const std::shared_ptr<tbb::affinity_partitioner> &partitioner)
     {
-      tbb::parallel_for(tbb::blocked_range<Iterator>(x_begin, x_end, grainsize),
-                        functor,
-                        *partitioner);
+      if (MultithreadInfo::get_thread_affinity() !=
+          MultithreadInfo::ThreadAffinity::none)
+        tbb::parallel_for(tbb::blocked_range<Iterator>(x_begin,
+                                                       x_end,
+                                                       grainsize),
+                          functor,
+                          tbb::static_partitioner());
+      else
+        tbb::parallel_for(tbb::blocked_range<Iterator>(x_begin,
+                                                       x_end,
+                                                       grainsize),
+                          functor,
+                          *partitioner);
     }
 
 #else
@@ -752,13 +769,20 @@ namespace parallel
 
     apply_to_subrange(begin, end);
 #else
-    internal::parallel_for(
-      begin,
-      end,
-      [this](const tbb::blocked_range<std::size_t> &range) {
-        apply_to_subrange(range.begin(), range.end());
-      },
-      minimum_parallel_grain_size);
+    const auto functor = [this](const tbb::blocked_range<std::size_t> &range) {
+      apply_to_subrange(range.begin(), range.end());
+    };
+    // with threads bound to cores, initialize the memory of large arrays
+    // with the same assignment of index ranges to threads as the loops
+    // over vector entries, see MultithreadInfo::set_thread_affinity()
+    if (MultithreadInfo::get_thread_affinity() !=
+        MultithreadInfo::ThreadAffinity::none)
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(
+                          begin, end, minimum_parallel_grain_size),
+                        functor,
+                        tbb::static_partitioner());
+    else
+      internal::parallel_for(begin, end, functor, minimum_parallel_grain_size);
 #endif
   }
 
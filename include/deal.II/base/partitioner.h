@@ -27,6 +27,7 @@
 #include <deal.II/lac/vector_operation.h>
 
 #include <limits>
+#include <map>
 #include <memory>
 
 DEAL_II_NAMESPACE_OPEN
@@ -192,6 +193,33 @@ namespace Utilities
      * export_to_ghosted_array_start() and import_from_ghosted_array_start()
      * detect this case and only send the selected indices, taken from the
      * full array of ghost entries.
+     *
+     *
+     * <h4>Reuse of communication patterns</h4>
+     *
+     * Determining the owners of the ghost indices in set_ghost_indices()
+     * requires a consensus algorithm (see Utilities::MPI::ConsensusAlgorithms)
+     * that involves all processes and is by far the most expensive part of
+     * the setup on large process counts. Since applications often create
+     * many partitioners with the same index sets, e.g., for the components
+     * of a block vector or for several MatrixFree objects on the same
+     * DoFHandler, set_ghost_indices() keeps the most recently computed
+     * communication patterns in a cache identified by a hash of the locally
+     * owned and the ghost indices. A pattern is reused if all processes in
+     * the communicator find their index sets in the cache with the same
+     * entry, which is checked with a single collective reduction. The cache
+     * holds a small fixed number of patterns and can be emptied with
+     * clear_communication_pattern_cache(). The patterns of a communicator
+     * are removed from the cache when the communicator is freed with
+     * MPI_Comm_free(), so a new communicator that gets the same handle does
+     * not pick them up.
+     *
+     * Partitioners whose ghost indices are a subset of the ghost indices of
+     * an existing partitioner with the same locally owned indices can be set
+     * up with reinit_from_superset(). Since the owners of the ghost indices
+     * are already known, the setup only sends the requested indices to the
+     * processes the existing partitioner imports from, without running a
+     * consensus algorithm.
      */
     class Partitioner : public Utilities::MPI::CommunicationPatternBase
     {
@@ -284,6 +312,44 @@ namespace Utilities
       set_ghost_indices(const IndexSet &ghost_indices,
                         const IndexSet &larger_ghost_index_set = IndexSet());
 
+      /**
+       * Set up the partitioner with the locally owned indices and the
+       * communicator of @p superset and the ghost indices given by
+       * @p ghost_indices, which must be a subset of the ghost indices of
+       * @p superset. The owners of the ghost indices are taken from
+       * @p superset, so that no consensus algorithm is necessary and the
+       * setup only involves messages to the processes @p superset imports
+       * from, see the class documentation. This function must be called on
+       * all processes of the communicator of @p superset.
+       *
+       * The optional parameter @p larger_ghost_index_set has the same meaning
+       * as in set_ghost_indices(). A typical use is to pass the ghost indices
+       * of @p superset, which allows to exchange the subset of ghost values
+       * of a vector that is based on @p superset.
+       */
+      void
+      reinit_from_superset(
+        const Partitioner &superset,
+        const IndexSet    &ghost_indices,
+        const IndexSet    &larger_ghost_index_set = IndexSet());
+
+      /**
+       * Remove all communication patterns from the cache used by
+       * set_ghost_indices(), see the class documentation, and reset the
+       * counters returned by communication_pattern_cache_statistics().
+       */
+      static void
+      clear_communication_pattern_cache();
+
+      /**
+       * Return how many calls to set_ghost_indices() on this process could
+       * use a communication pattern from the cache (first entry) and how
+       * many had to compute it (second entry) since the last call to
+       * clear_communication_pattern_cache().
+       */
+      static std::pair<unsigned int, unsigned int>
+      communication_pattern_cache_statistics();
+
       /**
        * Return the global size.
        */
@@ -674,6 +740,22 @@ namespace Utilities
       void
       initialize_import_indices_plain_dev() const;
 
+      /**
+       * Set up import_targets_data, import_indices_data, and the associated
+       * counts from the indices that the other processes import from the
+       * current process, given per process rank.
+       */
+      void
+      set_import_data(const std::map<unsigned int, IndexSet> &import_data);
+
+      /**
+       * Check the communication pattern in debug mode and set up the
+       * addressing into @p larger_ghost_index_set. This is the last step of
+       * set_ghost_indices() and reinit_from_superset().
+       */
+      void
+      finish_ghost_indices_setup(const IndexSet &larger_ghost_index_set);
+
       /**
        * The global size of the vector over all processors
        */
@@ -417,6 +417,13 @@ namespace DoFTools
    * need to remember using SparsityPattern::compress() after generating the
    * pattern.
    *
+   * @note If the sparsity pattern is a ThreadLocalSparsityPattern, the cells
+   * are processed in parallel by several threads, and the object is
+   * compressed at the end so that it can be passed to
+   * SparsityPattern::copy_from() right away. The same holds for the variant
+   * of this function taking a coupling table and for all variants of
+   * make_flux_sparsity_pattern().
+   *
    * @ingroup constraints
    */
   template <int dim, int spacedim, typename number = double>
@@ -651,6 +658,9 @@ namespace DoFTools
    *      return 0 < face_center[0];
    *    };
    * @endcode
+   *
+   * If @p sparsity is a ThreadLocalSparsityPattern, @p face_has_flux_coupling
+   * is called concurrently for different cells from several threads.
    */
   template <int dim, int spacedim, typename number>
   void
@@ -1700,6 +1700,39 @@ public:
                              VectorType                   &global_vector,
                              bool use_inhomogeneities_for_rhs = false) const;
 
+  /**
+   * Batched version of the function above: distribute the local matrices
+   * and vectors of several cells at once, with the global indices of cell
+   * <code>c</code> given by <code>local_dof_indices[c]</code>.
+   *
+   * The result is the same as calling the single-cell function for each
+   * cell in turn. The constraint lines of the indices of all cells are
+   * looked up once, in a single pass over the batch, and the positions found
+   * there are reused when the rows of a cell are sorted and its
+   * inhomogeneities are applied. Cells none of whose degrees of freedom is
+   * constrained are added straight into the global objects. The
+   * AffineConstraints object must be closed.
+   */
+  template <typename MatrixType, typename VectorType>
+  void
+  distribute_local_to_global(
+    const std::vector<FullMatrix<number>>     &local_matrices,
+    const std::vector<Vector<number>>         &local_vectors,
+    const std::vector<std::vector<size_type>> &local_dof_indices,
+    MatrixType                                &global_matrix,
+    VectorType                                &global_vector,
+    bool use_inhomogeneities_for_rhs = false) const;
+
+  /**
+   * Same as the function above, but only for the matrix.
+   */
+  template <typename MatrixType>
+  void
+  distribute_local_to_global(
+    const std::vector<FullMatrix<number>>     &local_matrices,
+    const std::vector<std::vector<size_type>> &local_dof_indices,
+    MatrixType                                &global_matrix) const;
+
   /**
    * Do a similar operation as the distribute_local_to_global() function that
    * distributes writing entries into a matrix for constrained degrees of
@@ -2194,6 +2227,24 @@ private:
    */
   std::vector<size_type> lines_cache;
 
+  /**
+   * A copy of the entries of all constraint lines in compressed row
+   * storage, set up by close(): the entries of the line at position @p k in
+   * #lines are found at the positions <tt>line_entry_offsets[k]</tt> to
+   * <tt>line_entry_offsets[k+1]</tt> of the array #line_entries. The
+   * functions applying the constraints to vectors and matrices read the
+   * entries from here, rather than from the separately allocated
+   * ConstraintLine::entries of each line. Both arrays are empty as long as
+   * the object is not closed.
+   */
+  std::vector<size_type> line_entry_offsets;
+
+  /**
+   * The pairs of column index and weight of all lines, see
+   * #line_entry_offsets.
+   */
+  std::vector<std::pair<size_type, number>> line_entries;
+
   /**
    * This IndexSet denotes the set of locally owned DoFs (or, more correctly,
    * the locally owned vector elements when operating on parallel vectors)
@@ -2235,45 +2286,79 @@ private:
   size_type
   calculate_line_index(const size_type line_n) const;
 
+  /**
+   * Copy the entries of all lines into the arrays #line_entry_offsets and
+   * #line_entries if the object is closed, and clear these arrays
+   * otherwise.
+   */
+  void
+  setup_line_entries();
+
+  /**
+   * Return the position of the constraint line of the constrained degree of
+   * freedom @p line_n in #lines.
+   */
+  size_type
+  line_position(const size_type line_n) const;
+
+  /**
+   * Write the position in #lines of the constraint line of each of the
+   * given @p indices into @p line_positions, or numbers::invalid_size_type
+   * for the indices that are not constrained. Return whether any of the
+   * indices is constrained. Used by the batched distribute_local_to_global()
+   * functions to look up the constraints of all cells in one pass.
+   */
+  bool
+  find_line_positions(const std::vector<size_type> &indices,
+                      size_type                    *line_positions) const;
+
   /**
    * This function actually implements the local_to_global function for
-   * standard (non-block) matrices.
+   * standard (non-block) matrices. If @p line_positions is given, it holds
+   * the positions of the constraint lines of the @p local_dof_indices as
+   * computed by find_line_positions(), which are then not looked up again.
    */
   template <typename MatrixType, typename VectorType>
   void
-  distribute_local_to_global(const FullMatrix<number>     &local_matrix,
-                             const Vector<number>         &local_vector,
-                             const std::vector<size_type> &local_dof_indices,
-                             MatrixType                   &global_matrix,
-                             VectorType                   &global_vector,
-                             const bool use_inhomogeneities_for_rhs,
-                             const std::bool_constant<false>) const;
+  distribute_local_to_global(
+    const FullMatrix<number>        &local_matrix,
+    const Vector<number>            &local_vector,
+    const std::vector<size_type>    &local_dof_indices,
+    MatrixType                      &global_matrix,
+    VectorType                      &global_vector,
+    const bool                       use_inhomogeneities_for_rhs,
+    const std::bool_constant<false>,
+    const size_type *line_positions = nullptr) const;
 
   /**
    * This function actually implements the local_to_global function for block
-   * matrices.
+   * matrices. See the function above for the meaning of @p line_positions.
    */
   template <typename MatrixType, typename VectorType>
   void
-  distribute_local_to_global(const FullMatrix<number>     &local_matrix,
-                             const Vector<number>         &local_vector,
-                             const std::vector<size_type> &local_dof_indices,
-                             MatrixType                   &global_matrix,
-                             VectorType                   &global_vector,
-                             const bool use_inhomogeneities_for_rhs,
-                             const std::bool_constant<true>) const;
+  distribute_local_to_global(
+    const FullMatrix<number>       &local_matrix,
+    const Vector<number>           &local_vector,
+    const std::vector<size_type>   &local_dof_indices,
+    MatrixType                     &global_matrix,
+    VectorType                     &global_vector,
+    const bool                      use_inhomogeneities_for_rhs,
+    const std::bool_constant<true>,
+    const size_type *line_positions = nullptr) const;
 
   /**
    * Internal helper function for distribute_local_to_global function.
    *
    * Creates a list of affected global rows for distribution, including the
    * local rows where the entries come from. The list is sorted according to
-   * the global row indices.
+   * the global row indices. If @p line_positions is given, the constraint
+   * lines are taken from there instead of being looked up.
    */
   void
   make_sorted_row_list(const std::vector<size_type> &local_dof_indices,
                        internal::AffineConstraints::GlobalRowsFromLocal<number>
-                         &global_rows) const;
+                                       &global_rows,
+                       const size_type *line_positions = nullptr) const;
 
   /**
    * Internal helper function for add_entries_local_to_global function.
@@ -2296,7 +2381,8 @@ private:
     const internal::AffineConstraints::GlobalRowsFromLocal<number> &global_rows,
     const Vector<VectorScalar>     &local_vector,
     const std::vector<size_type>   &local_dof_indices,
-    const FullMatrix<MatrixScalar> &local_matrix) const;
+    const FullMatrix<MatrixScalar> &local_matrix,
+    const size_type                *line_positions = nullptr) const;
 };
 
 /* ---------------- template and inline functions ----------------- */
@@ -2344,6 +2430,8 @@ inline AffineConstraints<number>::AffineConstraints(
   : Subscriptor()
   , lines(affine_constraints.lines)
   , lines_cache(affine_constraints.lines_cache)
+  , line_entry_offsets(affine_constraints.line_entry_offsets)
+  , line_entries(affine_constraints.line_entries)
   , locally_owned_dofs(affine_constraints.locally_owned_dofs)
   , local_lines(affine_constraints.local_lines)
   , needed_elements_for_distribute(
@@ -2564,6 +2652,20 @@ AffineConstraints<number>::calculate_line_index(const size_type line_n) const
 
 
 
+template <typename number>
+inline types::global_dof_index
+AffineConstraints<number>::line_position(const size_type line_n) const
+{
+  const size_type line_index = calculate_line_index(line_n);
+  AssertIndexRange(line_index, lines_cache.size());
+  AssertIndexRange(lines_cache[line_index], lines.size());
+  Assert(sorted == true && line_entry_offsets.size() == lines.size() + 1,
+         ExcMatrixNotClosed());
+  return lines_cache[line_index];
+}
+
+
+
 template <typename number>
 inline bool
 AffineConstraints<number>::can_store_line(size_type line_n) const
@@ -2605,11 +2707,10 @@ AffineConstraints<number>::distribute_local_to_global(
     global_vector(index) += value;
   else
     {
-      const ConstraintLine &position =
-        lines[lines_cache[calculate_line_index(index)]];
-      for (size_type j = 0; j < position.entries.size(); ++j)
-        global_vector(position.entries[j].first) +=
-          value * position.entries[j].second;
+      const size_type k = line_position(index);
+      for (size_type q = line_entry_offsets[k]; q < line_entry_offsets[k + 1];
+           ++q)
+        global_vector(line_entries[q].first) += value * line_entries[q].second;
     }
 }
 
@@ -2634,12 +2735,13 @@ AffineConstraints<number>::distribute_local_to_global(
                                                  global_vector);
       else
         {
-          const ConstraintLine &position =
-            lines[lines_cache[calculate_line_index(*local_indices_begin)]];
-          for (size_type j = 0; j < position.entries.size(); ++j)
+          const size_type k = line_position(*local_indices_begin);
+          for (size_type q = line_entry_offsets[k];
+               q < line_entry_offsets[k + 1];
+               ++q)
             internal::ElementAccess<VectorType>::add(
-              (*local_vector_begin) * position.entries[j].second,
-              position.entries[j].first,
+              (*local_vector_begin) * line_entries[q].second,
+              line_entries[q].first,
               global_vector);
         }
     }
@@ -2681,12 +2783,13 @@ AffineConstraints<number>::get_dof_values(
         *local_vector_begin = global_vector(*local_indices_begin);
       else
         {
-          const ConstraintLine &position =
-            lines[lines_cache[calculate_line_index(*local_indices_begin)]];
-          typename VectorType::value_type value = position.inhomogeneity;
-          for (size_type j = 0; j < position.entries.size(); ++j)
-            value += (global_vector(position.entries[j].first) *
-                      position.entries[j].second);
+          const size_type k = line_position(*local_indices_begin);
+          typename VectorType::value_type value = lines[k].inhomogeneity;
+          for (size_type q = line_entry_offsets[k];
+               q < line_entry_offsets[k + 1];
+               ++q)
+            value += (global_vector(line_entries[q].first) *
+                      line_entries[q].second);
           *local_vector_begin = value;
         }
     }
@@ -2793,6 +2896,8 @@ AffineConstraints<number>::copy_from(
 
   locally_owned_dofs             = other.locally_owned_dofs;
   needed_elements_for_distribute = other.needed_elements_for_distribute;
+
+  setup_line_entries();
 }
 
 
@@ -3002,6 +3107,136 @@ AffineConstraints<number>::distribute_local_to_global(
 
 
 
+template <typename number>
+inline bool
+AffineConstraints<number>::find_line_positions(
+  const std::vector<size_type> &indices,
+  size_type                    *line_positions) const
+{
+  bool has_constraints = false;
+  for (const size_type index : indices)
+    {
+      *line_positions = numbers::invalid_size_type;
+      if (lines.empty() == false)
+        {
+          const size_type line_index = calculate_line_index(index);
+          if (line_index < lines_cache.size())
+            {
+              *line_positions = lines_cache[line_index];
+              has_constraints |=
+                (lines_cache[line_index] != numbers::invalid_size_type);
+            }
+        }
+      ++line_positions;
+    }
+  return has_constraints;
+}
+
+
+
+template <typename number>
+template <typename MatrixType, typename VectorType>
+inline void
+AffineConstraints<number>::distribute_local_to_global(
+  const std::vector<FullMatrix<number>>     &local_matrices,
+  const std::vector<Vector<number>>         &local_vectors,
+  const std::vector<std::vector<size_type>> &local_dof_indices,
+  MatrixType                                &global_matrix,
+  VectorType                                &global_vector,
+  bool                                       use_inhomogeneities_for_rhs) const
+{
+  AssertDimension(local_matrices.size(), local_dof_indices.size());
+  AssertDimension(local_vectors.size(), local_dof_indices.size());
+  Assert(lines.empty() || sorted == true, ExcMatrixNotClosed());
+
+  // look up the constraint lines of the indices of all cells in one pass
+  std::vector<size_type> cell_offsets(local_dof_indices.size() + 1, 0);
+  for (unsigned int c = 0; c < local_dof_indices.size(); ++c)
+    cell_offsets[c + 1] = cell_offsets[c] + local_dof_indices[c].size();
+  std::vector<size_type> line_positions(cell_offsets.back());
+  std::vector<bool>      cell_is_constrained(local_dof_indices.size());
+  for (unsigned int c = 0; c < local_dof_indices.size(); ++c)
+    cell_is_constrained[c] =
+      find_line_positions(local_dof_indices[c],
+                          line_positions.data() + cell_offsets[c]);
+
+  for (unsigned int c = 0; c < local_dof_indices.size(); ++c)
+    {
+      const std::vector<size_type> &indices = local_dof_indices[c];
+      if (cell_is_constrained[c] == false)
+        {
+          AssertDimension(local_matrices[c].m(), indices.size());
+          AssertDimension(local_matrices[c].n(), indices.size());
+          AssertDimension(local_vectors[c].size(), indices.size());
+          global_matrix.add(indices, local_matrices[c], false);
+          global_vector.add(indices, local_vectors[c]);
+        }
+      else
+        distribute_local_to_global(
+          local_matrices[c],
+          local_vectors[c],
+          indices,
+          global_matrix,
+          global_vector,
+          use_inhomogeneities_for_rhs,
+          std::integral_constant<
+            bool,
+            internal::AffineConstraints::IsBlockMatrix<MatrixType>::value>(),
+          line_positions.data() + cell_offsets[c]);
+    }
+}
+
+
+
+template <typename number>
+template <typename MatrixType>
+inline void
+AffineConstraints<number>::distribute_local_to_global(
+  const std::vector<FullMatrix<number>>     &local_matrices,
+  const std::vector<std::vector<size_type>> &local_dof_indices,
+  MatrixType                                &global_matrix) const
+{
+  AssertDimension(local_matrices.size(), local_dof_indices.size());
+  Assert(lines.empty() || sorted == true, ExcMatrixNotClosed());
+
+  // look up the constraint lines of the indices of all cells in one pass
+  std::vector<size_type> cell_offsets(local_dof_indices.size() + 1, 0);
+  for (unsigned int c = 0; c < local_dof_indices.size(); ++c)
+    cell_offsets[c + 1] = cell_offsets[c] + local_dof_indices[c].size();
+  std::vector<size_type> line_positions(cell_offsets.back());
+  std::vector<bool>      cell_is_constrained(local_dof_indices.size());
+  for (unsigned int c = 0; c < local_dof_indices.size(); ++c)
+    cell_is_constrained[c] =
+      find_line_positions(local_dof_indices[c],
+                          line_positions.data() + cell_offsets[c]);
+
+  Vector<typename MatrixType::value_type> dummy(0);
+  for (unsigned int c = 0; c < local_dof_indices.size(); ++c)
+    {
+      const std::vector<size_type> &indices = local_dof_indices[c];
+      if (cell_is_constrained[c] == false)
+        {
+          AssertDimension(local_matrices[c].m(), indices.size());
+          AssertDimension(local_matrices[c].n(), indices.size());
+          global_matrix.add(indices, local_matrices[c], false);
+        }
+      else
+        distribute_local_to_global(
+          local_matrices[c],
+          dummy,
+          indices,
+          global_matrix,
+          dummy,
+          false,
+          std::integral_constant<
+            bool,
+            internal::AffineConstraints::IsBlockMatrix<MatrixType>::value>(),
+          line_positions.data() + cell_offsets[c]);
+    }
+}
+
+
+
 template <typename number>
 inline AffineConstraints<number>::ConstraintLine::ConstraintLine(
   const size_type                                                   &index,
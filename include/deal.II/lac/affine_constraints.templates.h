@@ -42,6 +42,7 @@
 #include <deal.II/lac/petsc_sparse_matrix.h>
 #include <deal.II/lac/petsc_vector.h>
 #include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix_bsr.h>
 #include <deal.II/lac/sparse_matrix_ez.h>
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/trilinos_block_sparse_matrix.h>
@@ -1291,6 +1292,39 @@ AffineConstraints<number>::close()
     }
 
   sorted = true;
+
+  setup_line_entries();
+}
+
+
+
+template <typename number>
+void
+AffineConstraints<number>::setup_line_entries()
+{
+  if (sorted == false)
+    {
+      line_entry_offsets.clear();
+      line_entries.clear();
+      return;
+    }
+
+  line_entry_offsets.resize(lines.size() + 1);
+  line_entry_offsets[0] = 0;
+  for (size_type k = 0; k < lines.size(); ++k)
+    line_entry_offsets[k + 1] = line_entry_offsets[k] + lines[k].entries.size();
+
+  line_entries.resize(line_entry_offsets.back());
+  parallel::apply_to_subranges(
+    size_type(0),
+    size_type(lines.size()),
+    [&](const size_type begin, const size_type end) {
+      for (size_type k = begin; k < end; ++k)
+        std::copy(lines[k].entries.begin(),
+                  lines[k].entries.end(),
+                  line_entries.begin() + line_entry_offsets[k]);
+    },
+    /* grainsize = */ 1000);
 }
 
 
@@ -1333,6 +1367,9 @@ AffineConstraints<number>::shift(const size_type offset)
       for (std::pair<size_type, number> &entry : line.entries)
         entry.first += offset;
     }
+  // also shift the copy of the entries set up by close()
+  for (std::pair<size_type, number> &entry : line_entries)
+    entry.first += offset;
 
 #ifdef DEBUG
   // make sure that lines, lines_cache and local_lines
@@ -1427,6 +1464,9 @@ AffineConstraints<number>::clear()
     lines_cache.swap(tmp);
   }
 
+  line_entry_offsets = {};
+  line_entries       = {};
+
   locally_owned_dofs             = {};
   local_lines                    = {};
   needed_elements_for_distribute = {};
@@ -1620,6 +1660,8 @@ AffineConstraints<number>::memory_consumption() const
 {
   return (MemoryConsumption::memory_consumption(lines) +
           MemoryConsumption::memory_consumption(lines_cache) +
+          MemoryConsumption::memory_consumption(line_entry_offsets) +
+          MemoryConsumption::memory_consumption(line_entries) +
           MemoryConsumption::memory_consumption(sorted) +
           MemoryConsumption::memory_consumption(local_lines));
 }
@@ -2107,20 +2149,22 @@ AffineConstraints<number>::condense(const VectorType &vec_ghosted,
   // one we need to set elements to zero. for parallel vectors, this can
   // only work if we can put a compress() in between, but we don't want to
   // call compress() twice per entry
-  for (const ConstraintLine &line : lines)
+  for (size_type k = 0; k < lines.size(); ++k)
     {
       // in case the constraint is inhomogeneous, this function is not
       // appropriate. Throw an exception.
-      Assert(line.inhomogeneity == number(0.),
+      Assert(lines[k].inhomogeneity == number(0.),
              ExcMessage("Inhomogeneous constraint cannot be condensed "
                         "without any matrix specified."));
 
-      const typename VectorType::value_type old_value = vec_ghosted(line.index);
-      for (const std::pair<size_type, number> &entry : line.entries)
-        if (vec.in_local_range(entry.first) == true)
-          vec(entry.first) +=
+      const typename VectorType::value_type old_value =
+        vec_ghosted(lines[k].index);
+      for (size_type q = line_entry_offsets[k]; q < line_entry_offsets[k + 1];
+           ++q)
+        if (vec.in_local_range(line_entries[q].first) == true)
+          vec(line_entries[q].first) +=
             (static_cast<typename VectorType::value_type>(old_value) *
-             entry.second);
+             line_entries[q].second);
     }
 
   vec.compress(VectorOperation::add);
@@ -2727,16 +2771,12 @@ AffineConstraints<number>::distribute_local_to_global(
 
         // find the constraint line to the given
         // global dof index
-        const size_type line_index =
-          calculate_line_index(local_dof_indices_col[i]);
-        AssertIndexRange(line_index, lines_cache.size());
-        AssertIndexRange(lines_cache[line_index], lines.size());
-        const ConstraintLine &position = lines[lines_cache[line_index]];
+        const size_type k = line_position(local_dof_indices_col[i]);
 
         // Gauss elimination of the matrix columns with the inhomogeneity.
         // Go through them one by one and again check whether they are
         // constrained. If so, distribute the constraint
-        const auto val = position.inhomogeneity;
+        const auto val = lines[k].inhomogeneity;
         if (val != number(0.))
           for (size_type j = 0; j < m_local_dofs; ++j)
             {
@@ -2752,19 +2792,17 @@ AffineConstraints<number>::distribute_local_to_global(
               if (matrix_entry == number())
                 continue;
 
-              const ConstraintLine &position_j =
-                lines[lines_cache[calculate_line_index(
-                  local_dof_indices_row[j])]];
-
-              for (size_type q = 0; q < position_j.entries.size(); ++q)
+              const size_type k_j = line_position(local_dof_indices_row[j]);
+              for (size_type q = line_entry_offsets[k_j];
+                   q < line_entry_offsets[k_j + 1];
+                   ++q)
                 {
                   Assert(!(!local_lines.size() ||
-                           local_lines.is_element(
-                             position_j.entries[q].first)) ||
-                           is_constrained(position_j.entries[q].first) == false,
+                           local_lines.is_element(line_entries[q].first)) ||
+                           is_constrained(line_entries[q].first) == false,
                          ExcMessage("Tried to distribute to a fixed dof."));
-                  global_vector(position_j.entries[q].first) -=
-                    val * position_j.entries[q].second * matrix_entry;
+                  global_vector(line_entries[q].first) -=
+                    val * line_entries[q].second * matrix_entry;
                 }
             }
 
@@ -2773,14 +2811,16 @@ AffineConstraints<number>::distribute_local_to_global(
         // the entries of fixed dofs
         if (diagonal)
           {
-            for (size_type j = 0; j < position.entries.size(); ++j)
+            for (size_type q = line_entry_offsets[k];
+                 q < line_entry_offsets[k + 1];
+                 ++q)
               {
                 Assert(!(!local_lines.size() ||
-                         local_lines.is_element(position.entries[j].first)) ||
-                         is_constrained(position.entries[j].first) == false,
+                         local_lines.is_element(line_entries[q].first)) ||
+                         is_constrained(line_entries[q].first) == false,
                        ExcMessage("Tried to distribute to a fixed dof."));
-                global_vector(position.entries[j].first) +=
-                  local_vector(i) * position.entries[j].second;
+                global_vector(line_entries[q].first) +=
+                  local_vector(i) * line_entries[q].second;
               }
           }
       }
@@ -3093,19 +3133,22 @@ AffineConstraints<number>::distribute(VectorType &vec) const
                 std::bool_constant<IsBlockVector<VectorType>::value>());
             }
 
-          for (const ConstraintLine &line : lines)
-            if (vec_owned_elements.is_element(line.index))
+          for (size_type k = 0; k < lines.size(); ++k)
+            if (vec_owned_elements.is_element(lines[k].index))
               {
-                typename VectorType::value_type new_value = line.inhomogeneity;
-                for (const std::pair<size_type, number> &entry : line.entries)
+                typename VectorType::value_type new_value =
+                  lines[k].inhomogeneity;
+                for (size_type q = line_entry_offsets[k];
+                     q < line_entry_offsets[k + 1];
+                     ++q)
                   new_value +=
                     (static_cast<typename VectorType::value_type>(
-                       internal::ElementAccess<VectorType>::get(ghosted_vector,
-                                                                entry.first)) *
-                     entry.second);
+                       internal::ElementAccess<VectorType>::get(
+                         ghosted_vector, line_entries[q].first)) *
+                     line_entries[q].second);
                 AssertIsFinite(new_value);
                 internal::ElementAccess<VectorType>::set(new_value,
-                                                         line.index,
+                                                         lines[k].index,
                                                          vec);
               }
 
@@ -3122,22 +3165,21 @@ AffineConstraints<number>::distribute(VectorType &vec) const
     // support anything else or because it's completely stored
     // locally)
     {
-      for (const ConstraintLine &next_constraint : lines)
+      for (size_type k = 0; k < lines.size(); ++k)
         {
-          // fill entry in line
-          // next_constraint.index by adding the
-          // different contributions
-          typename VectorType::value_type new_value =
-            next_constraint.inhomogeneity;
-          for (const std::pair<size_type, number> &entry :
-               next_constraint.entries)
-            new_value +=
-              (static_cast<typename VectorType::value_type>(
-                 internal::ElementAccess<VectorType>::get(vec, entry.first)) *
-               entry.second);
+          // fill entry in line lines[k].index by adding the different
+          // contributions
+          typename VectorType::value_type new_value = lines[k].inhomogeneity;
+          for (size_type q = line_entry_offsets[k];
+               q < line_entry_offsets[k + 1];
+               ++q)
+            new_value += (static_cast<typename VectorType::value_type>(
+                            internal::ElementAccess<VectorType>::get(
+                              vec, line_entries[q].first)) *
+                          line_entries[q].second);
           AssertIsFinite(new_value);
           internal::ElementAccess<VectorType>::set(new_value,
-                                                   next_constraint.index,
+                                                   lines[k].index,
                                                    vec);
         }
     }
@@ -4211,7 +4253,8 @@ template <typename number>
 void
 AffineConstraints<number>::make_sorted_row_list(
   const std::vector<size_type>                             &local_dof_indices,
-  internal::AffineConstraints::GlobalRowsFromLocal<number> &global_rows) const
+  internal::AffineConstraints::GlobalRowsFromLocal<number> &global_rows,
+  const size_type                                          *line_positions) const
 {
   const size_type n_local_dofs = local_dof_indices.size();
   AssertDimension(n_local_dofs, global_rows.size());
@@ -4240,7 +4283,11 @@ AffineConstraints<number>::make_sorted_row_list(
   // constraints that appear. They are resolved in a second step.
   for (size_type i = 0; i < n_local_dofs; ++i)
     {
-      if (is_constrained(local_dof_indices[i]) == false)
+      const bool constrained =
+        (line_positions != nullptr ?
+           line_positions[i] != numbers::invalid_size_type :
+           is_constrained(local_dof_indices[i]));
+      if (constrained == false)
         {
           global_rows.global_row(added_rows)  = local_dof_indices[i];
           global_rows.local_row(added_rows++) = i;
@@ -4257,14 +4304,33 @@ AffineConstraints<number>::make_sorted_row_list(
       AssertIndexRange(local_row, n_local_dofs);
       const size_type global_row = local_dof_indices[local_row];
       Assert(is_constrained(global_row), ExcInternalError());
-      const ConstraintLine &position =
-        lines[lines_cache[calculate_line_index(global_row)]];
-      if (position.inhomogeneity != number(0.))
+      // the flat entry arrays only exist for closed objects; sparsity
+      // patterns are sometimes built before close() is called, so fall back
+      // to the per-line storage in that case
+      if (sorted == false)
+        {
+          const ConstraintLine &position =
+            lines[lines_cache[calculate_line_index(global_row)]];
+          if (position.inhomogeneity != number(0.))
+            global_rows.set_ith_constraint_inhomogeneous(i);
+          for (size_type q = 0; q < position.entries.size(); ++q)
+            global_rows.insert_index(position.entries[q].first,
+                                     local_row,
+                                     position.entries[q].second);
+          continue;
+        }
+
+      const size_type k = (line_positions != nullptr ?
+                             line_positions[local_row] :
+                             line_position(global_row));
+      AssertIndexRange(k, lines.size());
+      if (lines[k].inhomogeneity != number(0.))
         global_rows.set_ith_constraint_inhomogeneous(i);
-      for (size_type q = 0; q < position.entries.size(); ++q)
-        global_rows.insert_index(position.entries[q].first,
+      for (size_type q = line_entry_offsets[k]; q < line_entry_offsets[k + 1];
+           ++q)
+        global_rows.insert_index(line_entries[q].first,
                                  local_row,
-                                 position.entries[q].second);
+                                 line_entries[q].second);
     }
 }
 
@@ -4339,11 +4405,23 @@ AffineConstraints<number>::resolve_vector_entry(
   const internal::AffineConstraints::GlobalRowsFromLocal<number> &global_rows,
   const Vector<VectorScalar>                                     &local_vector,
   const std::vector<size_type>   &local_dof_indices,
-  const FullMatrix<MatrixScalar> &local_matrix) const
+  const FullMatrix<MatrixScalar> &local_matrix,
+  const size_type                *line_positions) const
 {
   const size_type loc_row              = global_rows.local_row(i);
   const size_type n_inhomogeneous_rows = global_rows.n_inhomogeneities();
   typename ProductType<VectorScalar, MatrixScalar>::type val = 0;
+
+  // the inhomogeneity of the k-th constrained row of the cell
+  const auto inhomogeneity = [&](const size_type k) {
+    const size_type local_row = global_rows.constraint_origin(k);
+    return lines[line_positions != nullptr ?
+                   line_positions[local_row] :
+                   lines_cache[calculate_line_index(
+                     local_dof_indices[local_row])]]
+      .inhomogeneity;
+  };
+
   // has a direct contribution from some local entry. If we have inhomogeneous
   // constraints, compute the contribution of the inhomogeneity in the current
   // row.
@@ -4352,9 +4430,7 @@ AffineConstraints<number>::resolve_vector_entry(
       val = local_vector(loc_row);
       for (size_type i = 0; i < n_inhomogeneous_rows; ++i)
         val -= (local_matrix(loc_row, global_rows.constraint_origin(i)) *
-                lines[lines_cache[calculate_line_index(
-                        local_dof_indices[global_rows.constraint_origin(i)])]]
-                  .inhomogeneity);
+                inhomogeneity(i));
     }
 
   // go through the indirect contributions
@@ -4366,9 +4442,7 @@ AffineConstraints<number>::resolve_vector_entry(
       for (size_type k = 0; k < n_inhomogeneous_rows; ++k)
         add_this -=
           (local_matrix(loc_row_q, global_rows.constraint_origin(k)) *
-           lines[lines_cache[calculate_line_index(
-                   local_dof_indices[global_rows.constraint_origin(k)])]]
-             .inhomogeneity);
+           inhomogeneity(k));
       val += add_this * global_rows.constraint_value(i, q);
     }
   return val;
@@ -4388,7 +4462,8 @@ AffineConstraints<number>::distribute_local_to_global(
   MatrixType                   &global_matrix,
   VectorType                   &global_vector,
   const bool                    use_inhomogeneities_for_rhs,
-  const std::bool_constant<false>) const
+  const std::bool_constant<false>,
+  const size_type *line_positions) const
 {
   // FIXME: static_assert MatrixType::value_type == number
 
@@ -4418,7 +4493,7 @@ AffineConstraints<number>::distribute_local_to_global(
   internal::AffineConstraints::GlobalRowsFromLocal<number> &global_rows =
     scratch_data->global_rows;
   global_rows.reinit(n_local_dofs);
-  make_sorted_row_list(local_dof_indices, global_rows);
+  make_sorted_row_list(local_dof_indices, global_rows, line_positions);
 
   const size_type n_actual_dofs = global_rows.size();
 
@@ -4488,8 +4563,13 @@ AffineConstraints<number>::distribute_local_to_global(
       // hand side.
       if (use_vectors == true)
         {
-          const typename VectorType::value_type val = resolve_vector_entry(
-            i, global_rows, local_vector, local_dof_indices, local_matrix);
+          const typename VectorType::value_type val =
+            resolve_vector_entry(i,
+                                 global_rows,
+                                 local_vector,
+                                 local_dof_indices,
+                                 local_matrix,
+                                 line_positions);
           AssertIsFinite(val);
 
           if (val != typename VectorType::value_type())
@@ -4550,7 +4630,8 @@ AffineConstraints<number>::distribute_local_to_global(
   MatrixType                   &global_matrix,
   VectorType                   &global_vector,
   const bool                    use_inhomogeneities_for_rhs,
-  const std::bool_constant<true>) const
+  const std::bool_constant<true>,
+  const size_type *line_positions) const
 {
   const bool use_vectors =
     (local_vector.size() == 0 && global_vector.size() == 0) ? false : true;
@@ -4578,7 +4659,7 @@ AffineConstraints<number>::distribute_local_to_global(
     scratch_data->global_rows;
   global_rows.reinit(n_local_dofs);
 
-  make_sorted_row_list(local_dof_indices, global_rows);
+  make_sorted_row_list(local_dof_indices, global_rows, line_positions);
   const size_type n_actual_dofs = global_rows.size();
 
   std::vector<size_type> &global_indices = scratch_data->vector_indices;
@@ -4655,8 +4736,12 @@ AffineConstraints<number>::distribute_local_to_global(
 
           if (use_vectors == true)
             {
-              const number val = resolve_vector_entry(
-                i, global_rows, local_vector, local_dof_indices, local_matrix);
+              const number val = resolve_vector_entry(i,
+                                                      global_rows,
+                                                      local_vector,
+                                                      local_dof_indices,
+                                                      local_matrix,
+                                                      line_positions);
 
               if (val != number())
                 global_vector(global_indices[i]) +=
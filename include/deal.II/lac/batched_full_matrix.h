@@ -0,0 +1,915 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_batched_full_matrix_h
+#define dealii_batched_full_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/lapack_support.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A container for a large number of small dense matrices of the same size,
+ * e.g., local cell matrices, inverse cell mass matrices or the diagonal
+ * blocks of block preconditioners such as RelaxationBlock. The matrices are
+ * stored in an interleaved layout where the entries $(i,j)$ of
+ * VectorizedArray::size() consecutive matrices are placed in a single
+ * VectorizedArray, such that all operations of this class work on several
+ * matrices at once with SIMD instructions. A group of matrices sharing one
+ * VectorizedArray is called a <i>batch</i>; the matrix with index @p index
+ * is found in lane <tt>index % VectorizedArray<Number>::size()</tt> of batch
+ * <tt>index / VectorizedArray<Number>::size()</tt>. Operations on all
+ * matrices, like the factorizations or the application to a vector, run in
+ * parallel over the batches using the task-based parallelization described
+ * in the @ref threads topic.
+ *
+ * The class offers batched LU and Cholesky factorizations, the explicit
+ * inverse, solves and matrix-vector as well as matrix-matrix products. A
+ * typical use is to fill the matrices from the local matrices computed
+ * during assembly with WorkStream or MeshWorker (set_matrix() may be called
+ * concurrently for different matrix indices) and to apply the inverses
+ * afterwards:
+ * @code
+ * BatchedFullMatrix<double> inverse_mass(n_cells, dofs_per_cell,
+ *                                        dofs_per_cell);
+ * // in the copier of the assembly loop:
+ * inverse_mass.set_matrix(cell_index, cell_matrix);
+ * // after the assembly:
+ * inverse_mass.compute_cholesky_factorization();
+ * inverse_mass.solve(make_array_view(interleaved_vectors));
+ * @endcode
+ *
+ * Vectors are passed to the functions of this class in the same interleaved
+ * layout, i.e., as an array of VectorizedArray values where the entry $i$ of
+ * the vector associated with the matrix @p index is stored in lane
+ * <tt>index % VectorizedArray<Number>::size()</tt> of the element
+ * <tt>(index / VectorizedArray<Number>::size()) * m() + i</tt> (or
+ * <tt>* n()</tt> for vectors in the domain space of the matrices).
+ *
+ * The lanes of the last batch not associated with a matrix are filled with
+ * identity matrices, such that the factorizations are well-defined.
+ *
+ * @note The LU factorization does not use pivoting, because the pivot rows
+ * of the matrices in different lanes would in general differ. It is
+ * therefore intended for matrices that are diagonally dominant or symmetric
+ * positive definite as is common for the local matrices of finite element
+ * discretizations. For general matrices, use one LAPACKFullMatrix per
+ * matrix.
+ *
+ * @tparam Number The scalar type of the matrix entries, float or double.
+ *
+ * @ingroup Matrix1
+ */
+template <typename Number>
+class BatchedFullMatrix : public Subscriptor
+{
+public:
+  /**
+   * The type of the matrix entries.
+   */
+  using value_type = Number;
+
+  /**
+   * The vectorized type storing the entries of a batch of matrices.
+   */
+  using vectorized_value_type = VectorizedArray<Number>;
+
+  /**
+   * The number of matrices in a batch.
+   */
+  static constexpr unsigned int n_lanes = VectorizedArray<Number>::size();
+
+  /**
+   * Constructor. Set up @p n_matrices matrices of dimension
+   * @p n_rows times @p n_columns, initialized with zeros.
+   */
+  BatchedFullMatrix(const unsigned int n_matrices = 0,
+                    const unsigned int n_rows     = 0,
+                    const unsigned int n_columns  = 0);
+
+  /**
+   * Set up @p n_matrices matrices of dimension @p n_rows times
+   * @p n_columns, initialized with zeros. The object is in the state of a
+   * matrix afterwards.
+   */
+  void
+  reinit(const unsigned int n_matrices,
+         const unsigned int n_rows,
+         const unsigned int n_columns);
+
+  /**
+   * Return the number of matrices stored in this object.
+   */
+  unsigned int
+  n_matrices() const;
+
+  /**
+   * Return the number of batches, i.e., the number of matrices divided by
+   * VectorizedArray::size() and rounded up.
+   */
+  unsigned int
+  n_batches() const;
+
+  /**
+   * Return the number of rows of each matrix.
+   */
+  unsigned int
+  m() const;
+
+  /**
+   * Return the number of columns of each matrix.
+   */
+  unsigned int
+  n() const;
+
+  /**
+   * Return the state of the matrices, see LAPACKSupport::State. The
+   * possible values are LAPACKSupport::matrix,
+   * LAPACKSupport::inverse_matrix, LAPACKSupport::lu, and
+   * LAPACKSupport::cholesky.
+   */
+  LAPACKSupport::State
+  get_state() const;
+
+  /**
+   * Read-write access to the entry $(i,j)$ of all matrices of the batch
+   * @p batch.
+   */
+  VectorizedArray<Number> &
+  operator()(const unsigned int batch,
+             const unsigned int i,
+             const unsigned int j);
+
+  /**
+   * Read access to the entry $(i,j)$ of all matrices of the batch @p batch.
+   */
+  const VectorizedArray<Number> &
+  operator()(const unsigned int batch,
+             const unsigned int i,
+             const unsigned int j) const;
+
+  /**
+   * Copy the matrix @p matrix into the lane of the matrix with index
+   * @p index. The matrix must have the dimensions m() times n(). This
+   * function may be called concurrently for different indices.
+   */
+  template <typename Number2>
+  void
+  set_matrix(const unsigned int index, const FullMatrix<Number2> &matrix);
+
+  /**
+   * Copy the content of the matrix with index @p index into @p matrix,
+   * which is resized if necessary. In the state LAPACKSupport::lu or
+   * LAPACKSupport::cholesky, the factors are returned in the form in which
+   * they are stored internally.
+   */
+  template <typename Number2>
+  void
+  get_matrix(const unsigned int index, FullMatrix<Number2> &matrix) const;
+
+  /**
+   * Compute the LU factorization $A = LU$ of all matrices without pivoting.
+   * The unit lower triangular factor $L$ and the upper triangular factor $U$
+   * replace the matrix entries, and the inverse of the diagonal of $U$ is
+   * stored for the solves. The matrices need to be square.
+   */
+  void
+  compute_lu_factorization();
+
+  /**
+   * Compute the Cholesky factorization $A = LL^T$ of all matrices, which
+   * need to be symmetric and positive definite. Only the lower triangle of
+   * the matrices is read and replaced by the factor $L$.
+   */
+  void
+  compute_cholesky_factorization();
+
+  /**
+   * Replace all matrices by their inverse, computed from the LU
+   * factorization unless a factorization has already been computed. Since
+   * the application of the inverse is a matrix-vector product that does
+   * not involve the divisions and dependency chains of the triangular
+   * solves, this is the most efficient form if the inverses are applied
+   * many times, e.g., in a smoother.
+   */
+  void
+  invert();
+
+  /**
+   * Solve the linear systems with the right hand sides given by @p rhs,
+   * overwriting them by the solutions, for all matrices. The matrices need
+   * to be in the state LAPACKSupport::lu, LAPACKSupport::cholesky, or
+   * LAPACKSupport::inverse_matrix.
+   */
+  void
+  solve(const ArrayView<VectorizedArray<Number>> &rhs) const;
+
+  /**
+   * Solve the linear systems of the batch @p batch with the right hand sides
+   * starting at @p rhs, overwriting them by the solutions. This is the
+   * variant for use within a loop over batches in user code.
+   */
+  void
+  solve(const unsigned int batch, VectorizedArray<Number> *rhs) const;
+
+  /**
+   * Matrix-vector multiplication $dst = A src$ for all matrices. In the
+   * state LAPACKSupport::inverse_matrix, this applies the inverse.
+   */
+  void
+  vmult(const ArrayView<VectorizedArray<Number>>       &dst,
+        const ArrayView<const VectorizedArray<Number>> &src) const;
+
+  /**
+   * Matrix-vector multiplication with the matrices of the batch @p batch,
+   * writing m() entries starting at @p dst and reading n() entries starting
+   * at @p src. If @p adding is true, the result is added to @p dst.
+   */
+  void
+  vmult(const unsigned int             batch,
+        VectorizedArray<Number>       *dst,
+        const VectorizedArray<Number> *src,
+        const bool                     adding = false) const;
+
+  /**
+   * Matrix-matrix multiplication $C = AB$, or $C += AB$ if @p adding is
+   * true, for all matrices $A$ of this object and the corresponding
+   * matrices $B$ in @p B. The matrices in @p C are resized if necessary.
+   * Both this object and @p B must be in the state of a matrix or an
+   * inverse matrix.
+   */
+  void
+  mmult(BatchedFullMatrix<Number>       &C,
+        const BatchedFullMatrix<Number> &B,
+        const bool                       adding = false) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * Exception thrown when the LU factorization encounters a zero pivot.
+   */
+  DeclException2(ExcZeroPivot,
+                 unsigned int,
+                 unsigned int,
+                 << "The LU factorization of the matrix with index " << arg1
+                 << " encountered a zero pivot in row " << arg2 << ".");
+
+  /**
+   * Exception thrown when the Cholesky factorization encounters a diagonal
+   * entry that is not positive.
+   */
+  DeclException2(ExcNotPositiveDefinite,
+                 unsigned int,
+                 unsigned int,
+                 << "The Cholesky factorization of the matrix with index "
+                 << arg1 << " encountered a zero or negative diagonal entry "
+                 << "in row " << arg2
+                 << ", so the matrix is not positive definite.");
+
+private:
+  /**
+   * Return the number of batches that are processed by a single task in
+   * the parallel loops of this class.
+   */
+  unsigned int
+  grain_size() const;
+
+  /**
+   * Check the pivots of a factorization of the batch @p batch in row
+   * @p row in debug mode.
+   */
+  void
+  check_pivot(const unsigned int             batch,
+              const unsigned int             row,
+              const VectorizedArray<Number> &pivot) const;
+
+  /**
+   * Compute the LU factorization of the batch @p batch.
+   */
+  void
+  factorize_lu(const unsigned int batch);
+
+  /**
+   * Compute the Cholesky factorization of the batch @p batch.
+   */
+  void
+  factorize_cholesky(const unsigned int batch);
+
+  /**
+   * The number of matrices.
+   */
+  unsigned int n_batched_matrices;
+
+  /**
+   * The number of rows of each matrix.
+   */
+  unsigned int n_rows;
+
+  /**
+   * The number of columns of each matrix.
+   */
+  unsigned int n_columns;
+
+  /**
+   * The matrix entries, stored batch by batch and row-wise within each
+   * batch.
+   */
+  AlignedVector<VectorizedArray<Number>> values;
+
+  /**
+   * The inverses of the diagonal entries of the factors computed by
+   * compute_lu_factorization() and compute_cholesky_factorization().
+   */
+  AlignedVector<VectorizedArray<Number>> inverse_diagonal;
+
+  /**
+   * The state of the matrices.
+   */
+  LAPACKSupport::State state;
+};
+
+
+
+/* ---------------------------- Inline functions ------------------------- */
+
+#ifndef DOXYGEN
+
+template <typename Number>
+inline BatchedFullMatrix<Number>::BatchedFullMatrix(
+  const unsigned int n_matrices,
+  const unsigned int n_rows,
+  const unsigned int n_columns)
+{
+  reinit(n_matrices, n_rows, n_columns);
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::reinit(const unsigned int n_matrices,
+                                  const unsigned int n_rows,
+                                  const unsigned int n_columns)
+{
+  this->n_batched_matrices = n_matrices;
+  this->n_rows             = n_rows;
+  this->n_columns          = n_columns;
+  state                    = LAPACKSupport::matrix;
+
+  values.clear();
+  values.resize(static_cast<std::size_t>(n_batches()) * n_rows * n_columns,
+                VectorizedArray<Number>());
+  inverse_diagonal.clear();
+
+  // fill the unused lanes of the last batch with identity matrices
+  if (n_matrices % n_lanes != 0)
+    {
+      const unsigned int batch = n_batches() - 1;
+      for (unsigned int i = 0; i < std::min(n_rows, n_columns); ++i)
+        for (unsigned int v = n_matrices % n_lanes; v < n_lanes; ++v)
+          (*this)(batch, i, i)[v] = Number(1.);
+    }
+}
+
+
+
+template <typename Number>
+inline unsigned int
+BatchedFullMatrix<Number>::n_matrices() const
+{
+  return n_batched_matrices;
+}
+
+
+
+template <typename Number>
+inline unsigned int
+BatchedFullMatrix<Number>::n_batches() const
+{
+  return (n_batched_matrices + n_lanes - 1) / n_lanes;
+}
+
+
+
+template <typename Number>
+inline unsigned int
+BatchedFullMatrix<Number>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename Number>
+inline unsigned int
+BatchedFullMatrix<Number>::n() const
+{
+  return n_columns;
+}
+
+
+
+template <typename Number>
+inline LAPACKSupport::State
+BatchedFullMatrix<Number>::get_state() const
+{
+  return state;
+}
+
+
+
+template <typename Number>
+inline VectorizedArray<Number> &
+BatchedFullMatrix<Number>::operator()(const unsigned int batch,
+                                      const unsigned int i,
+                                      const unsigned int j)
+{
+  AssertIndexRange(batch, n_batches());
+  AssertIndexRange(i, n_rows);
+  AssertIndexRange(j, n_columns);
+  return values[(static_cast<std::size_t>(batch) * n_rows + i) * n_columns +
+                j];
+}
+
+
+
+template <typename Number>
+inline const VectorizedArray<Number> &
+BatchedFullMatrix<Number>::operator()(const unsigned int batch,
+                                      const unsigned int i,
+                                      const unsigned int j) const
+{
+  AssertIndexRange(batch, n_batches());
+  AssertIndexRange(i, n_rows);
+  AssertIndexRange(j, n_columns);
+  return values[(static_cast<std::size_t>(batch) * n_rows + i) * n_columns +
+                j];
+}
+
+
+
+template <typename Number>
+template <typename Number2>
+inline void
+BatchedFullMatrix<Number>::set_matrix(const unsigned int         index,
+                                      const FullMatrix<Number2> &matrix)
+{
+  AssertIndexRange(index, n_batched_matrices);
+  AssertDimension(matrix.m(), n_rows);
+  AssertDimension(matrix.n(), n_columns);
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+
+  const unsigned int batch = index / n_lanes;
+  const unsigned int lane  = index % n_lanes;
+  for (unsigned int i = 0; i < n_rows; ++i)
+    for (unsigned int j = 0; j < n_columns; ++j)
+      (*this)(batch, i, j)[lane] = matrix(i, j);
+}
+
+
+
+template <typename Number>
+template <typename Number2>
+inline void
+BatchedFullMatrix<Number>::get_matrix(const unsigned int   index,
+                                      FullMatrix<Number2> &matrix) const
+{
+  AssertIndexRange(index, n_batched_matrices);
+
+  matrix.reinit(n_rows, n_columns);
+  const unsigned int batch = index / n_lanes;
+  const unsigned int lane  = index % n_lanes;
+  for (unsigned int i = 0; i < n_rows; ++i)
+    for (unsigned int j = 0; j < n_columns; ++j)
+      matrix(i, j) = (*this)(batch, i, j)[lane];
+}
+
+
+
+template <typename Number>
+inline unsigned int
+BatchedFullMatrix<Number>::grain_size() const
+{
+  // aim at a few thousand floating point operations per task for small
+  // matrices, but never less than one batch
+  return std::max<unsigned int>(1, 4096 / std::max(1U, n_rows * n_columns));
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::check_pivot(
+  const unsigned int             batch,
+  const unsigned int             row,
+  const VectorizedArray<Number> &pivot) const
+{
+  (void)batch;
+  (void)row;
+  (void)pivot;
+#  ifdef DEBUG
+  for (unsigned int v = 0; v < n_lanes; ++v)
+    if (state == LAPACKSupport::cholesky)
+      Assert(pivot[v] > Number(0.),
+             ExcNotPositiveDefinite(batch * n_lanes + v, row));
+    else
+      Assert(pivot[v] != Number(0.), ExcZeroPivot(batch * n_lanes + v, row));
+#  endif
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::factorize_lu(const unsigned int batch)
+{
+  const unsigned int       n = n_rows;
+  VectorizedArray<Number> *a =
+    values.data() + static_cast<std::size_t>(batch) * n * n;
+  VectorizedArray<Number> *inv_diag =
+    inverse_diagonal.data() + static_cast<std::size_t>(batch) * n;
+
+  for (unsigned int k = 0; k < n; ++k)
+    {
+      check_pivot(batch, k, a[k * n + k]);
+      const VectorizedArray<Number> inv_pivot = Number(1.) / a[k * n + k];
+      inv_diag[k]                             = inv_pivot;
+      for (unsigned int i = k + 1; i < n; ++i)
+        {
+          const VectorizedArray<Number> factor = a[i * n + k] * inv_pivot;
+          a[i * n + k]                         = factor;
+          for (unsigned int j = k + 1; j < n; ++j)
+            a[i * n + j] -= factor * a[k * n + j];
+        }
+    }
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::factorize_cholesky(const unsigned int batch)
+{
+  const unsigned int       n = n_rows;
+  VectorizedArray<Number> *a =
+    values.data() + static_cast<std::size_t>(batch) * n * n;
+  VectorizedArray<Number> *inv_diag =
+    inverse_diagonal.data() + static_cast<std::size_t>(batch) * n;
+
+  for (unsigned int j = 0; j < n; ++j)
+    {
+      VectorizedArray<Number> diagonal = a[j * n + j];
+      for (unsigned int k = 0; k < j; ++k)
+        diagonal -= a[j * n + k] * a[j * n + k];
+      check_pivot(batch, j, diagonal);
+      const VectorizedArray<Number> inv_sqrt = Number(1.) / std::sqrt(diagonal);
+      a[j * n + j]                           = std::sqrt(diagonal);
+      inv_diag[j]                            = inv_sqrt;
+      for (unsigned int i = j + 1; i < n; ++i)
+        {
+          VectorizedArray<Number> sum = a[i * n + j];
+          for (unsigned int k = 0; k < j; ++k)
+            sum -= a[i * n + k] * a[j * n + k];
+          a[i * n + j] = sum * inv_sqrt;
+        }
+    }
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::compute_lu_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  AssertDimension(n_rows, n_columns);
+
+  inverse_diagonal.resize_fast(static_cast<std::size_t>(n_batches()) *
+                               n_rows);
+  state = LAPACKSupport::lu;
+  dealii::parallel::apply_to_subranges(
+    0U,
+    n_batches(),
+    [this](const unsigned int begin, const unsigned int end) {
+      for (unsigned int batch = begin; batch < end; ++batch)
+        factorize_lu(batch);
+    },
+    grain_size());
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::compute_cholesky_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  AssertDimension(n_rows, n_columns);
+
+  inverse_diagonal.resize_fast(static_cast<std::size_t>(n_batches()) *
+                               n_rows);
+  state = LAPACKSupport::cholesky;
+  dealii::parallel::apply_to_subranges(
+    0U,
+    n_batches(),
+    [this](const unsigned int begin, const unsigned int end) {
+      for (unsigned int batch = begin; batch < end; ++batch)
+        factorize_cholesky(batch);
+    },
+    grain_size());
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::invert()
+{
+  if (state == LAPACKSupport::matrix)
+    compute_lu_factorization();
+  Assert(state == LAPACKSupport::lu || state == LAPACKSupport::cholesky,
+         LAPACKSupport::ExcState(state));
+
+  const unsigned int n = n_rows;
+  dealii::parallel::apply_to_subranges(
+    0U,
+    n_batches(),
+    [this, n](const unsigned int begin, const unsigned int end) {
+      AlignedVector<VectorizedArray<Number>> inverse(n * n);
+      for (unsigned int batch = begin; batch < end; ++batch)
+        {
+          // solve for the unit vectors, storing the solutions as the rows
+          // of the transpose of the inverse
+          for (unsigned int j = 0; j < n; ++j)
+            {
+              VectorizedArray<Number> *column = inverse.data() + j * n;
+              for (unsigned int i = 0; i < n; ++i)
+                column[i] = Number(i == j ? 1. : 0.);
+              solve(batch, column);
+            }
+          VectorizedArray<Number> *a =
+            values.data() + static_cast<std::size_t>(batch) * n * n;
+          for (unsigned int i = 0; i < n; ++i)
+            for (unsigned int j = 0; j < n; ++j)
+              a[i * n + j] = inverse[j * n + i];
+        }
+    },
+    grain_size());
+
+  state = LAPACKSupport::inverse_matrix;
+  inverse_diagonal.clear();
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::solve(const unsigned int       batch,
+                                 VectorizedArray<Number> *x) const
+{
+  AssertIndexRange(batch, n_batches());
+
+  const unsigned int             n = n_rows;
+  const VectorizedArray<Number> *a =
+    values.data() + static_cast<std::size_t>(batch) * n * n;
+
+  if (state == LAPACKSupport::inverse_matrix)
+    {
+      VectorizedArray<Number> tmp[128];
+      AlignedVector<VectorizedArray<Number>> tmp_heap;
+      VectorizedArray<Number>               *src = tmp;
+      if (n > 128)
+        {
+          tmp_heap.resize_fast(n);
+          src = tmp_heap.data();
+        }
+      for (unsigned int i = 0; i < n; ++i)
+        src[i] = x[i];
+      vmult(batch, x, src);
+      return;
+    }
+
+  const VectorizedArray<Number> *inv_diag =
+    inverse_diagonal.data() + static_cast<std::size_t>(batch) * n;
+  if (state == LAPACKSupport::lu)
+    {
+      // forward substitution with the unit lower triangular factor
+      for (unsigned int i = 1; i < n; ++i)
+        {
+          VectorizedArray<Number> sum = x[i];
+          for (unsigned int k = 0; k < i; ++k)
+            sum -= a[i * n + k] * x[k];
+          x[i] = sum;
+        }
+      // backward substitution with the upper triangular factor
+      for (int i = n - 1; i >= 0; --i)
+        {
+          VectorizedArray<Number> sum = x[i];
+          for (unsigned int k = i + 1; k < n; ++k)
+            sum -= a[i * n + k] * x[k];
+          x[i] = sum * inv_diag[i];
+        }
+    }
+  else if (state == LAPACKSupport::cholesky)
+    {
+      // forward substitution with L
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          VectorizedArray<Number> sum = x[i];
+          for (unsigned int k = 0; k < i; ++k)
+            sum -= a[i * n + k] * x[k];
+          x[i] = sum * inv_diag[i];
+        }
+      // backward substitution with L^T, reading L column by column
+      for (int i = n - 1; i >= 0; --i)
+        {
+          x[i] *= inv_diag[i];
+          for (int k = 0; k < i; ++k)
+            x[k] -= a[i * n + k] * x[i];
+        }
+    }
+  else
+    Assert(false, LAPACKSupport::ExcState(state));
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::solve(
+  const ArrayView<VectorizedArray<Number>> &rhs) const
+{
+  AssertDimension(rhs.size(), static_cast<std::size_t>(n_batches()) * n_rows);
+
+  dealii::parallel::apply_to_subranges(
+    0U,
+    n_batches(),
+    [this, &rhs](const unsigned int begin, const unsigned int end) {
+      for (unsigned int batch = begin; batch < end; ++batch)
+        solve(batch, rhs.data() + static_cast<std::size_t>(batch) * n_rows);
+    },
+    grain_size());
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::vmult(const unsigned int             batch,
+                                 VectorizedArray<Number>       *dst,
+                                 const VectorizedArray<Number> *src,
+                                 const bool                     adding) const
+{
+  AssertIndexRange(batch, n_batches());
+  Assert(state == LAPACKSupport::matrix ||
+           state == LAPACKSupport::inverse_matrix,
+         LAPACKSupport::ExcState(state));
+
+  const VectorizedArray<Number> *a =
+    values.data() + static_cast<std::size_t>(batch) * n_rows * n_columns;
+  for (unsigned int i = 0; i < n_rows; ++i, a += n_columns)
+    {
+      VectorizedArray<Number> sum = adding ? dst[i] : VectorizedArray<Number>();
+      for (unsigned int j = 0; j < n_columns; ++j)
+        sum += a[j] * src[j];
+      dst[i] = sum;
+    }
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::vmult(
+  const ArrayView<VectorizedArray<Number>>       &dst,
+  const ArrayView<const VectorizedArray<Number>> &src) const
+{
+  AssertDimension(dst.size(), static_cast<std::size_t>(n_batches()) * n_rows);
+  AssertDimension(src.size(),
+                  static_cast<std::size_t>(n_batches()) * n_columns);
+
+  dealii::parallel::apply_to_subranges(
+    0U,
+    n_batches(),
+    [this, &dst, &src](const unsigned int begin, const unsigned int end) {
+      for (unsigned int batch = begin; batch < end; ++batch)
+        vmult(batch,
+              dst.data() + static_cast<std::size_t>(batch) * n_rows,
+              src.data() + static_cast<std::size_t>(batch) * n_columns);
+    },
+    grain_size());
+}
+
+
+
+template <typename Number>
+inline void
+BatchedFullMatrix<Number>::mmult(BatchedFullMatrix<Number>       &C,
+                                 const BatchedFullMatrix<Number> &B,
+                                 const bool                       adding) const
+{
+  Assert(state == LAPACKSupport::matrix ||
+           state == LAPACKSupport::inverse_matrix,
+         LAPACKSupport::ExcState(state));
+  Assert(B.state == LAPACKSupport::matrix ||
+           B.state == LAPACKSupport::inverse_matrix,
+         LAPACKSupport::ExcState(B.state));
+  AssertDimension(n_batched_matrices, B.n_matrices());
+  AssertDimension(n_columns, B.m());
+  Assert(&C != this && &C != &B, ExcMessage("The result must not alias."));
+
+  if (adding)
+    {
+      AssertDimension(C.n_matrices(), n_batched_matrices);
+      AssertDimension(C.m(), n_rows);
+      AssertDimension(C.n(), B.n());
+      Assert(C.state == LAPACKSupport::matrix,
+             LAPACKSupport::ExcState(C.state));
+    }
+  else if (C.n_matrices() != n_batched_matrices || C.m() != n_rows ||
+           C.n() != B.n() || C.state != LAPACKSupport::matrix)
+    C.reinit(n_batched_matrices, n_rows, B.n());
+
+  // the entries of empty matrices can not be accessed below, and the
+  // product with an empty inner dimension is zero
+  if (m() == 0 || n() == 0 || B.n() == 0)
+    {
+      if (!adding)
+        for (VectorizedArray<Number> &entry : C.values)
+          entry = VectorizedArray<Number>();
+      return;
+    }
+
+  const unsigned int n_inner = n_columns;
+  const unsigned int n_cols  = B.n();
+  dealii::parallel::apply_to_subranges(
+    0U,
+    n_batches(),
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int batch = begin; batch < end; ++batch)
+        {
+          const VectorizedArray<Number> *a = &(*this)(batch, 0, 0);
+          const VectorizedArray<Number> *b = &B(batch, 0, 0);
+          VectorizedArray<Number>       *c = &C(batch, 0, 0);
+          for (unsigned int i = 0; i < n_rows; ++i)
+            {
+              // accumulate row i of the product with unit-stride access to
+              // the rows of B
+              if (!adding)
+                for (unsigned int j = 0; j < n_cols; ++j)
+                  c[i * n_cols + j] = VectorizedArray<Number>();
+              for (unsigned int k = 0; k < n_inner; ++k)
+                {
+                  const VectorizedArray<Number> a_ik = a[i * n_inner + k];
+                  for (unsigned int j = 0; j < n_cols; ++j)
+                    c[i * n_cols + j] += a_ik * b[k * n_cols + j];
+                }
+            }
+        }
+    },
+    grain_size());
+}
+
+
+
+template <typename Number>
+inline std::size_t
+BatchedFullMatrix<Number>::memory_consumption() const
+{
+  return sizeof(*this) + values.memory_consumption() -
+         sizeof(values) + inverse_diagonal.memory_consumption() -
+         sizeof(inverse_diagonal);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
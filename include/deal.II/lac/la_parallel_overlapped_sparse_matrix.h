@@ -0,0 +1,315 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_la_parallel_overlapped_sparse_matrix_h
+#define dealii_la_parallel_overlapped_sparse_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declarations
+#ifndef DOXYGEN
+template <typename number>
+class SparseMatrix;
+#endif
+
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    /**
+     * @addtogroup Matrices
+     * @{
+     */
+
+    /**
+     * A sparse matrix whose rows are distributed among the MPI processes
+     * according to a Utilities::MPI::Partitioner and whose matrix-vector
+     * product with LinearAlgebra::distributed::Vector overlaps the exchange
+     * of ghost values with computations.
+     *
+     * The matrix stores the locally owned rows in two parts: the entries in
+     * columns that are locally owned, and the entries in columns that are
+     * ghost indices of the partitioner. A matrix-vector product then
+     * <ol>
+     * <li> starts the import of the ghost values of the source vector with
+     * LinearAlgebra::distributed::Vector::update_ghost_values_start(), </li>
+     * <li> multiplies the part of the matrix with locally owned columns,
+     * which does not need any data from other processes, </li>
+     * <li> waits for the ghost values with
+     * LinearAlgebra::distributed::Vector::update_ghost_values_finish(), and
+     * </li>
+     * <li> adds the contribution of the ghost columns, which usually only
+     * concerns the rows at the boundary between the subdomains. </li>
+     * </ol>
+     * This is the same pattern that MatrixFree::cell_loop() uses for the
+     * cells at the interior and at the boundary of the subdomain, applied to
+     * an assembled matrix. The overlap is contained in vmult(), so it also
+     * takes place when the matrix is used through a LinearOperator or by
+     * solvers such as SolverGMRES or SolverMinRes. These solvers do not
+     * provide any work of their own to be overlapped with the communication,
+     * though. Within a block operator, every block does its own exchange of
+     * the ghost values of the respective block of the source vector.
+     *
+     * In addition, the class provides the variant of vmult() with functions
+     * to be run on ranges of the vector entries before and after the
+     * matrix-vector product that is described in the documentation of
+     * SolverCG. This allows SolverCG to merge its vector updates and
+     * reductions with the matrix-vector product and to run the vector
+     * updates of the search direction before the ghost values are sent.
+     * SolverCG is currently the only solver that uses this variant.
+     *
+     * The matrix is set up from a SparseMatrix in the local numbering of the
+     * partitioner: its rows are the locally owned rows in the order of the
+     * locally owned indices, and its columns are the local indices as
+     * returned by Utilities::MPI::Partitioner::global_to_local(), i.e., the
+     * locally owned indices followed by the ghost indices.
+     *
+     * The rows are processed in parallel with the task-based parallelization
+     * of deal.II, in chunks of rows. In the variant of vmult() with functions
+     * before and after the product, the entries only accessed by the rows of
+     * one chunk are passed to these functions as part of the work on that
+     * chunk, such that they are still in caches for the product. Like in
+     * MatrixFree::cell_loop(), this interleaving is only done when running
+     * with a single thread, since the functions may not be called
+     * concurrently. With several threads, the functions are run on all
+     * entries before and after the parallel loop, respectively.
+     */
+    template <typename Number>
+    class OverlappedSparseMatrix : public Subscriptor
+    {
+    public:
+      /**
+       * Declare type for container size.
+       */
+      using size_type = types::global_dof_index;
+
+      /**
+       * Type of the matrix entries.
+       */
+      using value_type = Number;
+
+      /**
+       * Constructor. Creates an empty matrix.
+       */
+      OverlappedSparseMatrix() = default;
+
+      /**
+       * Set up the matrix from the locally owned rows in @p local_matrix,
+       * given in the local numbering of @p partitioner as described in the
+       * class documentation.
+       */
+      void
+      reinit(
+        const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+        const SparseMatrix<Number> &local_matrix);
+
+      /**
+       * Release all memory and return to a state just like after having
+       * called the default constructor.
+       */
+      void
+      clear();
+
+      /**
+       * Return the number of rows of the global matrix.
+       */
+      size_type
+      m() const;
+
+      /**
+       * Return the number of columns of the global matrix.
+       */
+      size_type
+      n() const;
+
+      /**
+       * Return the partitioner that describes the parallel layout of the
+       * vectors this matrix can be applied to.
+       */
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &
+      get_partitioner() const;
+
+      /**
+       * Return the number of locally owned rows that have entries in ghost
+       * columns, i.e., the rows whose computation has to wait for the data
+       * of other processes.
+       */
+      unsigned int
+      n_boundary_rows() const;
+
+      /**
+       * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+       * matrix, overlapping the exchange of the ghost values of @p src with
+       * the computation as described in the class documentation.
+       *
+       * If @p src already has its ghost values set, no communication is
+       * started and the ghost values are left untouched. Otherwise, the
+       * ghost values of @p src are zeroed at the end of the function.
+       */
+      void
+      vmult(Vector<Number> &dst, const Vector<Number> &src) const;
+
+      /**
+       * Matrix-vector multiplication with functions to be run on ranges of
+       * the locally owned vector entries, with the interface and the
+       * requirements described in the documentation of SolverCG:
+       * @p operation_before_matrix_vector_product is called on the entries
+       * before the entries are sent to other processes or used by the
+       * product, and @p operation_after_matrix_vector_product is called on
+       * ranges of entries that are not accessed by the product any more.
+       */
+      void
+      vmult(Vector<Number>       &dst,
+            const Vector<Number> &src,
+            const std::function<void(const unsigned int, const unsigned int)>
+              &operation_before_matrix_vector_product,
+            const std::function<void(const unsigned int, const unsigned int)>
+              &operation_after_matrix_vector_product) const;
+
+      /**
+       * Adding matrix-vector multiplication: let $dst += M*src$ with $M$
+       * being this matrix.
+       */
+      void
+      vmult_add(Vector<Number> &dst, const Vector<Number> &src) const;
+
+      /**
+       * Return an estimate for the memory consumption, in bytes, of this
+       * object.
+       */
+      std::size_t
+      memory_consumption() const;
+
+    private:
+      /**
+       * Shared implementation of the vmult() functions.
+       */
+      void
+      do_vmult(Vector<Number>       &dst,
+               const Vector<Number> &src,
+               const bool            add,
+               const std::function<void(const unsigned int,
+                                        const unsigned int)> *operation_before,
+               const std::function<void(const unsigned int,
+                                        const unsigned int)> *operation_after)
+        const;
+
+      /**
+       * Compute the product of the rows in the range [begin, end) of the
+       * part of the matrix with locally owned columns.
+       */
+      void
+      vmult_owned_rows(const unsigned int begin,
+                       const unsigned int end,
+                       Number            *dst,
+                       const Number      *src,
+                       const bool         add) const;
+
+      /**
+       * The partitioner describing the locally owned and ghost indices.
+       */
+      std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
+
+      /**
+       * Start of each locally owned row in the arrays owned_columns and
+       * owned_values. The array has one more entry than there are locally
+       * owned rows.
+       */
+      std::vector<std::size_t> owned_row_starts;
+
+      /**
+       * Local column indices of the entries in locally owned columns.
+       */
+      std::vector<unsigned int> owned_columns;
+
+      /**
+       * Values of the entries in locally owned columns.
+       */
+      AlignedVector<Number> owned_values;
+
+      /**
+       * Local indices of the rows with entries in ghost columns.
+       */
+      std::vector<unsigned int> boundary_rows;
+
+      /**
+       * Start of each row of boundary_rows in the arrays ghost_columns and
+       * ghost_values.
+       */
+      std::vector<std::size_t> ghost_row_starts;
+
+      /**
+       * Local column indices of the entries in ghost columns, numbered
+       * within the vector including its ghost entries.
+       */
+      std::vector<unsigned int> ghost_columns;
+
+      /**
+       * Values of the entries in ghost columns.
+       */
+      AlignedVector<Number> ghost_values;
+
+      /**
+       * Number of rows in each chunk of rows processed by one task in the
+       * matrix-vector product. The last chunk may be shorter.
+       */
+      unsigned int rows_per_chunk = 1;
+
+      /**
+       * Start of the ranges of each chunk of rows in the array
+       * private_ranges. The array has one more entry than there are chunks.
+       */
+      std::vector<unsigned int> private_range_starts = {0};
+
+      /**
+       * Ranges of vector entries that are only accessed by the rows of a
+       * single chunk, and which are not sent to other processes nor belong
+       * to a boundary row. The functions before and after the
+       * matrix-vector product are run on these ranges as part of the work
+       * on the chunk.
+       */
+      std::vector<std::pair<unsigned int, unsigned int>> private_ranges;
+
+      /**
+       * The ranges of vector entries that are not in private_ranges. The
+       * functions before and after the matrix-vector product are run on
+       * these ranges before the communication starts and after all rows
+       * have been computed, respectively.
+       */
+      std::vector<std::pair<unsigned int, unsigned int>> shared_ranges;
+    };
+
+    /** @} */
+
+  } // namespace distributed
+} // namespace LinearAlgebra
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -52,6 +52,17 @@ namespace LinearAlgebra
   class ReadWriteVector;
 } // namespace LinearAlgebra
 
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    namespace VectorDataExchange
+    {
+      class Base;
+    }
+  } // namespace MatrixFreeFunctions
+} // namespace internal
+
 #  ifdef DEAL_II_WITH_PETSC
 namespace PETScWrappers
 {
@@ -244,6 +255,29 @@ namespace LinearAlgebra
      *   MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
      *                       &comm_sm);
      * @endcode
+     *
+     * Furthermore, the ghost exchange can be done through the shared memory
+     * by calling enable_shared_memory_ghost_exchange(). Then,
+     * update_ghost_values() copies the ghost values owned by processes in
+     * `comm_sm` directly from their memory, and compress() with
+     * VectorOperation::add lets the owners add the ghost contributions
+     * directly from the memory of this process, using the same data
+     * structures as MatrixFree (see MatrixFree::AdditionalData). Only the
+     * data of processes outside `comm_sm` is sent through MPI. This is
+     * available for vectors of double and float in Host mode.
+     *
+     * Since the processes access each other's memory without waiting for
+     * each other to finish, this mode imposes the following rule: After
+     * update_ghost_values(), the locally owned values must not be modified,
+     * and after compress(), the ghost values must neither be read nor
+     * written, until all processes in `comm_sm` have passed a common
+     * synchronization point, such as a reduction like a dot product or a
+     * norm, or an MPI barrier. Many algorithms do not follow this rule,
+     * e.g., PreconditionChebyshev modifies a vector right after it has been
+     * used in a matrix-vector product that updated its ghost values. The
+     * shared-memory exchange is therefore only used for vectors that opt in
+     * explicitly, and it is not passed on to vectors that are copied from,
+     * or reinitialized with, such a vector.
      */
     template <typename Number, typename MemorySpace = MemorySpace::Host>
     class Vector : public ::dealii::ReadVector<Number>, public Subscriptor
@@ -1253,6 +1287,26 @@ namespace LinearAlgebra
       const std::vector<ArrayView<const Number>> &
       shared_vector_data() const;
 
+      /**
+       * Let update_ghost_values() and compress() with VectorOperation::add
+       * exchange the data with the processes in the shared-memory
+       * communicator `comm_sm` given to the constructor or reinit() through
+       * shared memory, subject to the rule described in the general
+       * documentation of this class. This function must be called by all
+       * processes in `comm_sm` after each call to reinit(). It is only
+       * implemented for double and float in Host mode, and does nothing if
+       * `comm_sm` is MPI_COMM_SELF.
+       */
+      void
+      enable_shared_memory_ghost_exchange();
+
+      /**
+       * Return whether update_ghost_values() and compress() exchange data
+       * through shared memory, see enable_shared_memory_ghost_exchange().
+       */
+      bool
+      uses_shared_memory_ghost_exchange() const;
+
       /** @} */
 
       /**
@@ -1436,6 +1490,14 @@ namespace LinearAlgebra
        */
       MPI_Comm comm_sm;
 
+      /**
+       * The data exchange through shared memory with the processes in
+       * `comm_sm`, set up by enable_shared_memory_ghost_exchange().
+       */
+      std::shared_ptr<
+        const ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::Base>
+        shared_memory_exchange;
+
       /**
        * A helper function that clears the compress_requests and
        * update_ghost_values_requests field. Used in reinit() functions.
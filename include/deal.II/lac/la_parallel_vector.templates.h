@@ -27,6 +27,8 @@
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_operations_internal.h>
 
+#include <deal.II/matrix_free/vector_data_exchange.h>
+
 #include <memory>
 
 
@@ -79,6 +81,15 @@ namespace LinearAlgebra
 
 
 
+      // The ghost exchange through shared memory of MatrixFree is only
+      // available for these number types on the host
+      template <typename Number, typename MemorySpaceType>
+      constexpr bool supports_shared_memory_exchange =
+        std::is_same_v<MemorySpaceType, ::dealii::MemorySpace::Host> &&
+        (std::is_same_v<Number, double> || std::is_same_v<Number, float>);
+
+
+
       // Resize the underlying array on the host or on the device
       template <typename Number, typename MemorySpaceType>
       struct la_parallel_vector_templates_functions
@@ -505,6 +516,40 @@ namespace LinearAlgebra
     } // namespace internal
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::enable_shared_memory_ghost_exchange()
+    {
+      Assert((internal::supports_shared_memory_exchange<Number,
+                                                        MemorySpaceType>),
+             ExcNotImplemented());
+
+      shared_memory_exchange.reset();
+
+#ifdef DEAL_II_WITH_MPI
+      if (Utilities::MPI::job_supports_mpi() && comm_sm != MPI_COMM_SELF)
+        {
+          Assert(data.values_sm.size() ==
+                   Utilities::MPI::n_mpi_processes(comm_sm),
+                 ExcInternalError());
+          shared_memory_exchange = std::make_shared<
+            const ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::
+              Full>(partitioner, comm_sm);
+        }
+#endif
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    bool
+    Vector<Number, MemorySpaceType>::uses_shared_memory_ghost_exchange() const
+    {
+      return shared_memory_exchange != nullptr;
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Vector<Number, MemorySpaceType>::clear_mpi_requests()
@@ -532,6 +577,8 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::resize_val(const size_type new_alloc_size,
                                                 const MPI_Comm  comm_sm)
     {
+      const Number *old_values = data.values.data();
+
       internal::la_parallel_vector_templates_functions<
         Number,
         MemorySpaceType>::resize_val(new_alloc_size,
@@ -541,6 +588,19 @@ namespace LinearAlgebra
 
       thread_loop_partitioner =
         std::make_shared<::dealii::parallel::internal::TBBPartitioner>();
+
+      // With threads bound to cores, the vector operations assign the same
+      // index ranges to the same threads in every call. Touch new memory in
+      // the same way, so that the operating system places each page on the
+      // NUMA domain of the thread that works on it later on.
+      if constexpr (std::is_same_v<MemorySpaceType,
+                                   ::dealii::MemorySpace::Host>)
+        if (MultithreadInfo::get_thread_affinity() !=
+              MultithreadInfo::ThreadAffinity::none &&
+            data.values.data() != old_values && allocated_size > 0)
+          dealii::internal::VectorOperations::
+            functions<Number, Number, MemorySpaceType>::set(
+              thread_loop_partitioner, allocated_size, Number(), data);
     }
 
 
@@ -551,6 +611,7 @@ namespace LinearAlgebra
                                             const bool omit_zeroing_entries)
     {
       clear_mpi_requests();
+      shared_memory_exchange.reset();
 
       // check whether we need to reallocate
       resize_val(size, comm_sm);
@@ -580,6 +641,7 @@ namespace LinearAlgebra
       const MPI_Comm                comm_sm)
     {
       clear_mpi_requests();
+      shared_memory_exchange.reset();
 
       this->comm_sm = comm_sm;
 
@@ -608,6 +670,7 @@ namespace LinearAlgebra
       const bool                              omit_zeroing_entries)
     {
       clear_mpi_requests();
+      shared_memory_exchange.reset();
       Assert(v.partitioner.get() != nullptr, ExcNotInitialized());
 
       this->comm_sm = v.comm_sm;
@@ -676,6 +739,7 @@ namespace LinearAlgebra
       const MPI_Comm                                            comm_sm)
     {
       clear_mpi_requests();
+      shared_memory_exchange.reset();
 
       this->comm_sm = comm_sm;
 
@@ -809,6 +873,7 @@ namespace LinearAlgebra
       try
         {
           clear_mpi_requests();
+          shared_memory_exchange.reset();
         }
       catch (...)
         {}
@@ -1016,6 +1081,28 @@ namespace LinearAlgebra
             }
         }
 
+      // the owners in the shared-memory communicator read the ghost values
+      // directly from the memory of this process
+      if constexpr (internal::supports_shared_memory_exchange<Number,
+                                                              MemorySpaceType>)
+        if (operation == VectorOperation::add &&
+            shared_memory_exchange != nullptr)
+          {
+            shared_memory_exchange->import_from_ghosted_array_start(
+              operation,
+              communication_channel,
+              ArrayView<const Number>(data.values.data(),
+                                      partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<Number>(import_data.values.data(),
+                                partitioner->n_import_indices()),
+              compress_requests);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, dealii::MemorySpace::Default>)
         {
@@ -1078,6 +1165,27 @@ namespace LinearAlgebra
 
       // make this function thread safe
       std::lock_guard<std::mutex> lock(mutex);
+
+      if constexpr (internal::supports_shared_memory_exchange<Number,
+                                                              MemorySpaceType>)
+        if (operation == VectorOperation::add &&
+            shared_memory_exchange != nullptr)
+          {
+            shared_memory_exchange->import_from_ghosted_array_finish(
+              operation,
+              ArrayView<Number>(data.values.data(),
+                                partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<const Number>(import_data.values.data(),
+                                      partitioner->n_import_indices()),
+              compress_requests);
+            compress_requests.resize(0);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1176,6 +1284,27 @@ namespace LinearAlgebra
             }
         }
 
+      // the ghost values owned by processes in the shared-memory
+      // communicator are read from their memory in
+      // update_ghost_values_finish()
+      if constexpr (internal::supports_shared_memory_exchange<Number,
+                                                              MemorySpaceType>)
+        if (shared_memory_exchange != nullptr)
+          {
+            shared_memory_exchange->export_to_ghosted_array_start(
+              communication_channel,
+              ArrayView<const Number>(data.values.data(),
+                                      partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<Number>(import_data.values.data(),
+                                partitioner->n_import_indices()),
+              update_ghost_values_requests);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1233,6 +1362,29 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::update_ghost_values_finish() const
     {
 #ifdef DEAL_II_WITH_MPI
+      if constexpr (internal::supports_shared_memory_exchange<Number,
+                                                              MemorySpaceType>)
+        if (shared_memory_exchange != nullptr)
+          {
+            if (update_ghost_values_requests.size() > 0)
+              {
+                // make this function thread safe
+                std::lock_guard<std::mutex> lock(mutex);
+
+                shared_memory_exchange->export_to_ghosted_array_finish(
+                  ArrayView<const Number>(data.values.data(),
+                                          partitioner->locally_owned_size()),
+                  data.values_sm,
+                  ArrayView<Number>(data.values.data() +
+                                      partitioner->locally_owned_size(),
+                                    partitioner->n_ghost_indices()),
+                  update_ghost_values_requests);
+                update_ghost_values_requests.resize(0);
+              }
+            vector_is_ghosted = true;
+            return;
+          }
+
       // wait for both sends and receives to complete, even though only
       // receives are really necessary. this gives (much) better performance
       AssertDimension(partitioner->ghost_targets().size() +
@@ -1410,6 +1562,7 @@ namespace LinearAlgebra
       std::swap(compress_requests, v.compress_requests);
       std::swap(update_ghost_values_requests, v.update_ghost_values_requests);
       std::swap(comm_sm, v.comm_sm);
+      std::swap(shared_memory_exchange, v.shared_memory_exchange);
 #endif
 
       std::swap(partitioner, v.partitioner);
@@ -0,0 +1,343 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_la_parallel_vector_fused_operation_h
+#define dealii_la_parallel_vector_fused_operation_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <array>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    namespace internal
+    {
+      namespace FusedOperation
+      {
+        /**
+         * Number of vector entries processed by one task. A multiple of the
+         * width of all VectorizedArray types.
+         */
+        constexpr std::size_t block_size = 4096;
+
+        // Load the entries [0, n_lanes) of a vectorized array, setting the
+        // remaining lanes to zero.
+        template <typename Number>
+        inline void
+        load(VectorizedArray<Number> &value,
+             const Number            *ptr,
+             const unsigned int       n_lanes)
+        {
+          if (n_lanes == VectorizedArray<Number>::size())
+            value.load(ptr);
+          else
+            {
+              value = Number();
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                value[v] = ptr[v];
+            }
+        }
+
+        // Write back the entries of vectors the kernel may modify, and do
+        // nothing for read-only vectors.
+        template <typename Number>
+        inline void
+        store(const VectorizedArray<Number> &value,
+              Number                        *ptr,
+              const unsigned int             n_lanes)
+        {
+          if (n_lanes == VectorizedArray<Number>::size())
+            value.store(ptr);
+          else
+            for (unsigned int v = 0; v < n_lanes; ++v)
+              ptr[v] = value[v];
+        }
+
+        template <typename Number>
+        inline void
+        store(const VectorizedArray<Number> &,
+              const Number *,
+              const unsigned int)
+        {}
+
+        // Pass the entries of read-only vectors as const reference to the
+        // kernel.
+        template <typename Number>
+        inline VectorizedArray<Number> &
+        kernel_argument(VectorizedArray<Number> &value, Number *)
+        {
+          return value;
+        }
+
+        template <typename Number>
+        inline const VectorizedArray<Number> &
+        kernel_argument(VectorizedArray<Number> &value, const Number *)
+        {
+          return value;
+        }
+
+        // Run the kernel on the entries starting at @p index of all vectors.
+        template <typename Number,
+                  std::size_t n_reductions,
+                  typename Kernel,
+                  typename... Pointers,
+                  std::size_t... indices>
+        inline void
+        apply_kernel(const Kernel                                      &kernel,
+                     std::array<VectorizedArray<Number>, n_reductions> &sums,
+                     const std::tuple<Pointers...> &pointers,
+                     const std::size_t              index,
+                     const unsigned int             n_lanes,
+                     std::index_sequence<indices...>)
+        {
+          std::array<VectorizedArray<Number>, sizeof...(Pointers)> values;
+          (load<Number>(values[indices],
+                        std::get<indices>(pointers) + index,
+                        n_lanes),
+           ...);
+          kernel(sums,
+                 kernel_argument(values[indices],
+                                 std::get<indices>(pointers))...);
+          (store<Number>(values[indices],
+                         std::get<indices>(pointers) + index,
+                         n_lanes),
+           ...);
+        }
+
+        // Return the pointer to the locally owned entries, which is a
+        // pointer to const for vectors passed as const reference.
+        template <typename VectorType>
+        inline auto
+        local_data(VectorType &vector)
+        {
+          return vector.begin();
+        }
+
+        // Refresh the ghost values of vectors the kernel has modified.
+        template <typename Number>
+        inline void
+        update_ghosts(Vector<Number, MemorySpace::Host> &vector)
+        {
+          if (vector.has_ghost_elements())
+            vector.update_ghost_values();
+        }
+
+        template <typename Number>
+        inline void
+        update_ghosts(const Vector<Number, MemorySpace::Host> &)
+        {}
+      } // namespace FusedOperation
+    }   // namespace internal
+
+
+
+    /**
+     * Run a user-defined operation on the locally owned entries of several
+     * vectors in a single pass over memory, and compute any number of
+     * reductions (like dot products or norms) over the result with a single
+     * global MPI reduction.
+     *
+     * Iterative solvers often call several vector operations in a row, such
+     * as <code>r.add(-alpha, v)</code>, <code>x.add(alpha, p)</code>, and
+     * <code>r.norm_sqr()</code>. Each of these functions reads (and possibly
+     * writes) all entries of the involved vectors, and each reduction
+     * requires a separate global communication step. Since these operations
+     * are limited by the memory bandwidth, merging them into one loop saves
+     * a corresponding share of the run time. This function provides the loop
+     * for an arbitrary combination of such operations, described by the @p
+     * kernel, for example
+     * @code
+     *   const std::array<double, 2> results =
+     *     LinearAlgebra::distributed::fused_vector_operation<2>(
+     *       [alpha](std::array<VectorizedArray<double>, 2> &sums,
+     *               VectorizedArray<double>                &x,
+     *               VectorizedArray<double>                &r,
+     *               const VectorizedArray<double>          &p,
+     *               const VectorizedArray<double>          &v) {
+     *         x += alpha * p;
+     *         r -= alpha * v;
+     *         sums[0] += r * r;
+     *         sums[1] += r * v;
+     *       },
+     *       x,
+     *       r,
+     *       std::as_const(p),
+     *       std::as_const(v));
+     * @endcode
+     * which computes the updates of $x$ and $r$ together with the squared
+     * norm of the new $r$ and its product with $v$.
+     *
+     * The kernel is called with an array of @p n_reductions accumulators,
+     * followed by the entries of the given vectors in the order in which the
+     * vectors are passed, each packed into a VectorizedArray. It is called
+     * for consecutive packs of entries of the locally owned range, so it must
+     * only use element-wise operations. At the end of the locally owned range
+     * the unused lanes of the arguments are set to zero; the contributions of
+     * these lanes to the accumulators are discarded. The function returns the
+     * sums of the accumulators over all entries and all MPI processes.
+     *
+     * Vectors passed as non-const reference are considered to be modified:
+     * the entries of their argument are written back after each call of the
+     * kernel, and their ghost values are updated at the end if they had been
+     * imported before, as done by the member functions of the vector class.
+     * Vectors passed as const reference (e.g., through std::as_const())
+     * are only read and receive a const argument in the kernel, which saves
+     * the memory traffic for writing them.
+     *
+     * The local range is split into blocks that are processed in parallel
+     * with the task-based parallelization of deal.II, see the
+     * @ref threads "Parallel computing with multiple processors" topic. The
+     * partial sums of the blocks are added up in a fixed order, so the
+     * results do not depend on the number of threads.
+     *
+     * All vectors must have the same locally owned range and use the same
+     * MPI communicator. This function is only available for vectors of
+     * floating point numbers stored on the host.
+     */
+    template <unsigned int n_reductions,
+              typename Kernel,
+              typename VectorType,
+              typename... VectorTypes>
+    std::array<typename std::remove_const_t<VectorType>::value_type,
+               n_reductions>
+    fused_vector_operation(const Kernel &kernel,
+                           VectorType   &vector,
+                           VectorTypes &...vectors)
+    {
+      using Number = typename std::remove_const_t<VectorType>::value_type;
+      static_assert(std::is_floating_point_v<Number>,
+                    "This function is only implemented for vectors of "
+                    "floating point numbers.");
+      static_assert(
+        std::is_same_v<typename std::remove_const_t<VectorType>::memory_space,
+                       MemorySpace::Host>,
+        "This function is only implemented for vectors on the host.");
+      static_assert(
+        (std::is_same_v<std::remove_const_t<VectorTypes>,
+                        std::remove_const_t<VectorType>> &&
+         ...),
+        "All vectors must be of the same type.");
+
+      const std::size_t local_size = vector.locally_owned_size();
+      for (const std::size_t size :
+           std::initializer_list<std::size_t>{vectors.locally_owned_size()...})
+        {
+          AssertDimension(size, local_size);
+          (void)size;
+        }
+
+      constexpr unsigned int width = VectorizedArray<Number>::size();
+      static_assert(internal::FusedOperation::block_size % width == 0,
+                    "The block size must be a multiple of the SIMD width.");
+
+      const auto pointers =
+        std::make_tuple(internal::FusedOperation::local_data(vector),
+                        internal::FusedOperation::local_data(vectors)...);
+      const auto index_sequence =
+        std::make_index_sequence<1 + sizeof...(VectorTypes)>();
+
+      const std::size_t n_blocks =
+        (local_size + internal::FusedOperation::block_size - 1) /
+        internal::FusedOperation::block_size;
+      std::vector<std::array<Number, n_reductions>> block_sums(n_blocks);
+
+      parallel::apply_to_subranges(
+        std::size_t(0),
+        n_blocks,
+        [&](const std::size_t begin_block, const std::size_t end_block) {
+          for (std::size_t block = begin_block; block < end_block; ++block)
+            {
+              const std::size_t begin =
+                block * internal::FusedOperation::block_size;
+              const std::size_t end =
+                std::min(begin + internal::FusedOperation::block_size,
+                         local_size);
+              const std::size_t end_regular =
+                begin + (end - begin) / width * width;
+
+              std::array<VectorizedArray<Number>, n_reductions> sums;
+              for (auto &sum : sums)
+                sum = Number();
+              for (std::size_t i = begin; i < end_regular; i += width)
+                internal::FusedOperation::apply_kernel<Number>(
+                  kernel, sums, pointers, i, width, index_sequence);
+
+              for (unsigned int r = 0; r < n_reductions; ++r)
+                block_sums[block][r] = sums[r].sum();
+
+              // only add the lanes that correspond to vector entries
+              if (end_regular < end)
+                {
+                  for (auto &sum : sums)
+                    sum = Number();
+                  internal::FusedOperation::apply_kernel<Number>(
+                    kernel,
+                    sums,
+                    pointers,
+                    end_regular,
+                    end - end_regular,
+                    index_sequence);
+                  for (unsigned int r = 0; r < n_reductions; ++r)
+                    for (unsigned int v = 0; v < end - end_regular; ++v)
+                      block_sums[block][r] += sums[r][v];
+                }
+            }
+        },
+        4);
+
+      std::array<Number, n_reductions> results;
+      results.fill(Number());
+      for (const auto &sums : block_sums)
+        for (unsigned int r = 0; r < n_reductions; ++r)
+          results[r] += sums[r];
+
+      if (n_reductions > 0 &&
+          vector.get_partitioner()->n_mpi_processes() > 1)
+        {
+          const std::array<Number, n_reductions> local_results = results;
+          Utilities::MPI::sum(make_array_view(local_results),
+                              vector.get_mpi_communicator(),
+                              make_array_view(results));
+        }
+
+      internal::FusedOperation::update_ghosts(vector);
+      (internal::FusedOperation::update_ghosts(vectors), ...);
+
+      return results;
+    }
+  } // namespace distributed
+} // namespace LinearAlgebra
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
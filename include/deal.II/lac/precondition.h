@@ -29,6 +29,7 @@
 #include <deal.II/lac/diagonal_matrix.h>
 #include <deal.II/lac/identity_matrix.h>
 #include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/sparse_level_schedule.h>
 #include <deal.II/lac/vector_memory.h>
 
 #include <limits>
@@ -117,6 +118,22 @@ namespace internal
       , cg_iterations{0}
       , degree{0}
     {}
+
+    /**
+     * Write or read the data of this object to or from a stream for the
+     * purpose of serialization using the [BOOST serialization
+     * library](https://www.boost.org/doc/libs/1_74_0/libs/serialization/doc/index.html).
+     * This allows to store the eigenvalue estimates of a
+     * PreconditionChebyshev object and to pass them to
+     * PreconditionChebyshev::set_eigenvalue_information() after a restart.
+     */
+    template <class Archive>
+    void
+    serialize(Archive &ar, const unsigned int /*version*/)
+    {
+      ar &min_eigenvalue_estimate &max_eigenvalue_estimate &cg_iterations
+        &degree;
+    }
   };
 
   /**
@@ -602,6 +619,18 @@ public:
      * invocation of vmult() or step().
      */
     unsigned int n_iterations;
+
+    /**
+     * If this flag is true and the matrix is a SparseMatrix, PreconditionSOR
+     * and PreconditionSSOR compute a SparseLevelSchedule of its sparsity
+     * pattern in initialize() and run the forward and backward sweeps of
+     * vmult() and Tvmult() level by level on multiple threads. The result is
+     * the same as with the sequential sweeps. For small matrices, or when the
+     * levels become too small to be worth the synchronization among threads,
+     * the sequential code is used regardless of this flag. The flag is
+     * ignored by the other relaxation methods and by step() and Tstep().
+     */
+    bool use_level_scheduling;
   };
 
   /**
@@ -815,6 +844,63 @@ namespace internal
     constexpr bool has_SSOR_step =
       is_supported_operation<SSOR_step_t, T, VectorType>;
 
+    template <typename T, typename VectorType>
+    using precondition_SOR_scheduled_t =
+      decltype(std::declval<const T>().precondition_SOR(
+        std::declval<VectorType &>(),
+        std::declval<const VectorType &>(),
+        std::declval<const double>(),
+        std::declval<const SparseLevelSchedule &>()));
+
+    template <typename T, typename VectorType>
+    constexpr bool has_precondition_SOR_scheduled =
+      is_supported_operation<precondition_SOR_scheduled_t, T, VectorType>;
+
+    template <typename T, typename VectorType>
+    using precondition_TSOR_scheduled_t =
+      decltype(std::declval<const T>().precondition_TSOR(
+        std::declval<VectorType &>(),
+        std::declval<const VectorType &>(),
+        std::declval<const double>(),
+        std::declval<const SparseLevelSchedule &>()));
+
+    template <typename T, typename VectorType>
+    constexpr bool has_precondition_TSOR_scheduled =
+      is_supported_operation<precondition_TSOR_scheduled_t, T, VectorType>;
+
+    template <typename T, typename VectorType>
+    using precondition_SSOR_scheduled_t =
+      decltype(std::declval<const T>().precondition_SSOR(
+        std::declval<VectorType &>(),
+        std::declval<const VectorType &>(),
+        std::declval<const double>(),
+        std::declval<const std::vector<std::size_t> &>(),
+        std::declval<const SparseLevelSchedule &>()));
+
+    template <typename T, typename VectorType>
+    constexpr bool has_precondition_SSOR_scheduled =
+      is_supported_operation<precondition_SSOR_scheduled_t, T, VectorType>;
+
+    /**
+     * Set up the level schedule for the threaded sweeps of SOR and SSOR.
+     * This is only possible for a SparseMatrix.
+     */
+    template <typename number>
+    void
+    initialize_level_schedule(const SparseMatrix<number> &A,
+                              SparseLevelSchedule        &level_schedule)
+    {
+      level_schedule.initialize(A.get_sparsity_pattern());
+    }
+
+    template <typename MatrixType>
+    void
+    initialize_level_schedule(const MatrixType &,
+                              SparseLevelSchedule &level_schedule)
+    {
+      level_schedule.clear();
+    }
+
     template <typename MatrixType>
     class PreconditionJacobiImpl
     {
@@ -876,19 +962,56 @@ namespace internal
     class PreconditionSORImpl
     {
     public:
-      PreconditionSORImpl(const MatrixType &A, const double relaxation)
+      PreconditionSORImpl(const MatrixType &A,
+                          const double      relaxation,
+                          const bool        use_level_scheduling = false)
         : A(&A)
         , relaxation(relaxation)
-      {}
+      {
+        if (use_level_scheduling)
+          initialize_level_schedule(A, level_schedule);
+      }
 
-      template <typename VectorType>
+      template <
+        typename VectorType,
+        std::enable_if_t<has_precondition_SOR_scheduled<MatrixType, VectorType>,
+                         MatrixType> * = nullptr>
+      void
+      vmult(VectorType &dst, const VectorType &src) const
+      {
+        this->A->precondition_SOR(dst,
+                                  src,
+                                  this->relaxation,
+                                  this->level_schedule);
+      }
+
+      template <typename VectorType,
+                std::enable_if_t<
+                  !has_precondition_SOR_scheduled<MatrixType, VectorType>,
+                  MatrixType> * = nullptr>
       void
       vmult(VectorType &dst, const VectorType &src) const
       {
         this->A->precondition_SOR(dst, src, this->relaxation);
       }
 
-      template <typename VectorType>
+      template <typename VectorType,
+                std::enable_if_t<
+                  has_precondition_TSOR_scheduled<MatrixType, VectorType>,
+                  MatrixType> * = nullptr>
+      void
+      Tvmult(VectorType &dst, const VectorType &src) const
+      {
+        this->A->precondition_TSOR(dst,
+                                   src,
+                                   this->relaxation,
+                                   this->level_schedule);
+      }
+
+      template <typename VectorType,
+                std::enable_if_t<
+                  !has_precondition_TSOR_scheduled<MatrixType, VectorType>,
+                  MatrixType> * = nullptr>
       void
       Tvmult(VectorType &dst, const VectorType &src) const
       {
@@ -938,6 +1061,12 @@ namespace internal
     private:
       const SmartPointer<const MatrixType> A;
       const double                         relaxation;
+
+      /**
+       * The level schedule for threaded sweeps, or an empty object if the
+       * sequential sweeps are to be used.
+       */
+      SparseLevelSchedule level_schedule;
     };
 
     template <typename MatrixType>
@@ -946,7 +1075,9 @@ namespace internal
     public:
       using size_type = typename MatrixType::size_type;
 
-      PreconditionSSORImpl(const MatrixType &A, const double relaxation)
+      PreconditionSSORImpl(const MatrixType &A,
+                           const double      relaxation,
+                           const bool        use_level_scheduling = false)
         : A(&A)
         , relaxation(relaxation)
       {
@@ -976,21 +1107,31 @@ namespace internal
                 pos_right_of_diagonal[row] = it - mat->begin();
               }
           }
+
+        if (use_level_scheduling && !pos_right_of_diagonal.empty())
+          initialize_level_schedule(A, level_schedule);
       }
 
-      template <typename VectorType>
+      template <typename VectorType,
+                std::enable_if_t<
+                  has_precondition_SSOR_scheduled<MatrixType, VectorType>,
+                  MatrixType> * = nullptr>
       void
       vmult(VectorType &dst, const VectorType &src) const
       {
         this->A->precondition_SSOR(dst,
                                    src,
                                    this->relaxation,
-                                   pos_right_of_diagonal);
+                                   pos_right_of_diagonal,
+                                   level_schedule);
       }
 
-      template <typename VectorType>
+      template <typename VectorType,
+                std::enable_if_t<
+                  !has_precondition_SSOR_scheduled<MatrixType, VectorType>,
+                  MatrixType> * = nullptr>
       void
-      Tvmult(VectorType &dst, const VectorType &src) const
+      vmult(VectorType &dst, const VectorType &src) const
       {
         this->A->precondition_SSOR(dst,
                                    src,
@@ -998,6 +1139,14 @@ namespace internal
                                    pos_right_of_diagonal);
       }
 
+      template <typename VectorType>
+      void
+      Tvmult(VectorType &dst, const VectorType &src) const
+      {
+        // the preconditioner is symmetric
+        this->vmult(dst, src);
+      }
+
       template <typename VectorType,
                 std::enable_if_t<has_SSOR_step<MatrixType, VectorType>,
                                  MatrixType> * = nullptr>
@@ -1035,6 +1184,12 @@ namespace internal
        * the diagonal is located.
        */
       std::vector<std::size_t> pos_right_of_diagonal;
+
+      /**
+       * The level schedule for threaded sweeps, or an empty object if the
+       * sequential sweeps are to be used.
+       */
+      SparseLevelSchedule level_schedule;
     };
 
     template <typename MatrixType>
@@ -2005,6 +2160,22 @@ public:
  * variable AdditionalData::max_eigenvalue instead. The minimal eigenvalue is
  * implicitly specified via `max_eigenvalue/smoothing_range`.
  *
+ * <h4>Reusing eigenvalue estimates</h4>
+ *
+ * When the preconditioner is set up repeatedly for slowly changing matrices,
+ * e.g., in a time stepping scheme with time-dependent coefficients, the
+ * eigenvalue estimate of a previous call to initialize() can often be used
+ * again. If AdditionalData::eigenvalue_drift_tolerance is positive, the
+ * class compares the Rayleigh quotients of an approximate eigenvector of the
+ * previous preconditioned matrix with the previous and the new matrix, and
+ * only computes new eigenvalues if they differ by more than the given
+ * relative tolerance. The stored vector is only used for this comparison and
+ * as the start vector of the power iteration, whereas the Lanczos iteration
+ * of the CG method always starts from the default initial guess to capture
+ * both ends of the spectrum. Furthermore, the estimates can be queried by
+ * get_eigenvalue_information() and passed to set_eigenvalue_information(),
+ * e.g., to avoid the computation after restarting from a checkpoint.
+ *
  * <h4>Using the PreconditionChebyshev as a solver</h4>
  *
  * If the range <tt>[max_eigenvalue/smoothing_range, max_eigenvalue]</tt>
@@ -2145,7 +2316,8 @@ public:
       const double              max_eigenvalue      = 1,
       const EigenvalueAlgorithm eigenvalue_algorithm =
         EigenvalueAlgorithm::lanczos,
-      const PolynomialType polynomial_type = PolynomialType::first_kind);
+      const PolynomialType polynomial_type = PolynomialType::first_kind,
+      const double         eigenvalue_drift_tolerance = 0.);
 
     /**
      * This determines the degree of the Chebyshev polynomial. The degree of
@@ -2165,6 +2337,28 @@ public:
      * Specifies the polynomial type to be used.
      */
     PolynomialType polynomial_type;
+
+    /**
+     * Relative tolerance for reusing the eigenvalue estimate of a previous
+     * call to initialize(). If this number is positive and the eigenvalues
+     * are computed by an eigenvalue algorithm (i.e., `eig_cg_n_iterations`
+     * is positive), the class keeps a vector approximating the eigenvector
+     * of the largest eigenvalue after each estimate. Upon the next
+     * estimate, the Rayleigh quotient of the preconditioned matrix with this
+     * vector is compared to the value recorded with the previous matrix. If
+     * the two values differ by less than the given tolerance relative to
+     * the recorded value, the previous estimates are reused at the cost of
+     * a single matrix-vector product. Otherwise, the eigenvalues are
+     * computed again. The power iteration is then started from the stored
+     * vector, whereas the Lanczos iteration starts from the default initial
+     * guess, because a vector dominated by the largest eigenvalue would
+     * deteriorate the estimate of the smallest eigenvalue. The stored vector
+     * is discarded when the layout of the vectors changes.
+     *
+     * A value of zero, the default, disables the reuse and computes the
+     * eigenvalues after each call to initialize().
+     */
+    double eigenvalue_drift_tolerance;
   };
 
 
@@ -2251,6 +2445,33 @@ public:
   EigenvalueInformation
   estimate_eigenvalues(const VectorType &src) const;
 
+  /**
+   * Return the eigenvalue information currently used by the preconditioner,
+   * i.e., the result of the most recent call to estimate_eigenvalues() or
+   * the information passed to set_eigenvalue_information(). The number of
+   * CG iterations is zero if the estimate of a previous matrix has been
+   * reused, see AdditionalData::eigenvalue_drift_tolerance.
+   */
+  const EigenvalueInformation &
+  get_eigenvalue_information() const;
+
+  /**
+   * Set the eigenvalue estimates to be used with the matrix passed to the
+   * most recent call to initialize(), skipping the eigenvalue computation
+   * for this matrix. The typical use is to restart a simulation from a
+   * checkpoint where the result of get_eigenvalue_information() has been
+   * stored via EigenvalueInformation::serialize(). In contrast to setting
+   * AdditionalData::eig_cg_n_iterations to zero, both the minimal and
+   * maximal eigenvalue are taken from @p eigenvalue_information, including
+   * the safety factor applied to the maximal eigenvalue.
+   *
+   * This function needs to be called after initialize() and has no effect
+   * on later calls to initialize().
+   */
+  void
+  set_eigenvalue_information(
+    const EigenvalueInformation &eigenvalue_information);
+
 private:
   /**
    * A pointer to the underlying matrix.
@@ -2298,6 +2519,33 @@ private:
    */
   bool eigenvalues_are_initialized;
 
+  /**
+   * The eigenvalue information currently in use, kept across calls to
+   * initialize() to be reused according to
+   * AdditionalData::eigenvalue_drift_tolerance.
+   */
+  mutable EigenvalueInformation eigenvalue_information;
+
+  /**
+   * Whether the eigenvalue information has been provided by
+   * set_eigenvalue_information() for the current matrix.
+   */
+  bool use_given_eigenvalue_information;
+
+  /**
+   * Normalized approximation of the eigenvector of the largest eigenvalue
+   * of the preconditioned matrix at the time of the last eigenvalue
+   * computation. Empty unless AdditionalData::eigenvalue_drift_tolerance is
+   * positive.
+   */
+  mutable VectorType eigenvector_estimate;
+
+  /**
+   * The Rayleigh quotient of the preconditioned matrix at the time of the
+   * last eigenvalue computation with @p eigenvector_estimate.
+   */
+  mutable double eigenvector_rayleigh_quotient;
+
   /**
    * A mutex to avoid that multiple vmult() invocations by different threads
    * overwrite the temporary vectors.
@@ -2436,7 +2684,8 @@ namespace internal
     const MatrixType                                            *matrix_ptr,
     VectorType                                                  &solution_old,
     VectorType                                                  &temp_vector1,
-    const unsigned int                                           degree)
+    const unsigned int                                           degree,
+    const VectorType *initial_guess = nullptr)
   {
     Assert(data.preconditioner.get() != nullptr, ExcNotInitialized());
 
@@ -2452,8 +2701,16 @@ namespace internal
 
         // set an initial guess that contains some high-frequency parts (to the
         // extent possible without knowing the discretization and the numbering)
-        // to trigger high eigenvalues according to the external function
-        internal::set_initial_guess(temp_vector1);
+        // to trigger high eigenvalues according to the external function. The
+        // power iteration, which only approximates the largest eigenvalue, can
+        // also start from a vector of a previous estimate provided by the
+        // caller.
+        if (initial_guess != nullptr &&
+            data.eigenvalue_algorithm ==
+              internal::EigenvalueAlgorithm::power_iteration)
+          temp_vector1 = *initial_guess;
+        else
+          internal::set_initial_guess(temp_vector1);
         data.constraints.set_zero(temp_vector1);
 
         if (data.eigenvalue_algorithm == internal::EigenvalueAlgorithm::lanczos)
@@ -2517,6 +2774,63 @@ namespace internal
 
     return info;
   }
+
+
+
+  template <typename VectorType>
+  bool
+  vectors_have_same_layout(const VectorType &vector1,
+                           const VectorType &vector2)
+  {
+    return vector1.locally_owned_elements() ==
+           vector2.locally_owned_elements();
+  }
+
+  template <typename Number>
+  bool
+  vectors_have_same_layout(
+    const ::dealii::LinearAlgebra::distributed::BlockVector<Number> &vector1,
+    const ::dealii::LinearAlgebra::distributed::BlockVector<Number> &vector2)
+  {
+    if (vector1.n_blocks() != vector2.n_blocks())
+      return false;
+    bool same_layout = true;
+    for (unsigned int block = 0; block < vector1.n_blocks(); ++block)
+      same_layout &=
+        vectors_have_same_layout(vector1.block(block), vector2.block(block));
+    return same_layout;
+  }
+
+  template <typename Number, typename MemorySpace>
+  bool
+  vectors_have_same_layout(
+    const ::dealii::LinearAlgebra::distributed::Vector<Number, MemorySpace>
+      &vector1,
+    const ::dealii::LinearAlgebra::distributed::Vector<Number, MemorySpace>
+      &vector2)
+  {
+    // also compare the ghost indices, and make sure all processes take the
+    // same decision
+    return vector2.get_partitioner()->is_globally_compatible(
+      *vector1.get_partitioner());
+  }
+
+
+
+  template <typename MatrixType,
+            typename VectorType,
+            typename PreconditionerType>
+  double
+  preconditioned_rayleigh_quotient(const MatrixType         &matrix,
+                                   const VectorType         &vector,
+                                   const PreconditionerType &preconditioner,
+                                   VectorType               &temp_vector1,
+                                   VectorType               &temp_vector2)
+  {
+    matrix.vmult(temp_vector1, vector);
+    preconditioner.vmult(temp_vector2, temp_vector1);
+    return (vector * temp_vector2) / (vector * vector);
+  }
 } // namespace internal
 
 
@@ -2915,7 +3229,9 @@ PreconditionSOR<MatrixType>::initialize(const MatrixType     &A,
   parameters.relaxation   = 1.0;
   parameters.n_iterations = parameters_in.n_iterations;
   parameters.preconditioner =
-    std::make_shared<PreconditionerType>(A, parameters_in.relaxation);
+    std::make_shared<PreconditionerType>(A,
+                                         parameters_in.relaxation,
+                                         parameters_in.use_level_scheduling);
 
   this->BaseClass::initialize(A, parameters);
 }
@@ -2937,7 +3253,9 @@ PreconditionSSOR<MatrixType>::initialize(const MatrixType     &A,
   parameters.relaxation   = 1.0;
   parameters.n_iterations = parameters_in.n_iterations;
   parameters.preconditioner =
-    std::make_shared<PreconditionerType>(A, parameters_in.relaxation);
+    std::make_shared<PreconditionerType>(A,
+                                         parameters_in.relaxation,
+                                         parameters_in.use_level_scheduling);
 
   this->BaseClass::initialize(A, parameters);
 }
@@ -3071,6 +3389,7 @@ inline PreconditionRelaxation<MatrixType, PreconditionerType>::AdditionalData::
       eigenvalue_algorithm)
   , relaxation(relaxation)
   , n_iterations(n_iterations)
+  , use_level_scheduling(false)
 {}
 
 
@@ -3751,7 +4070,8 @@ inline PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
                                  const double              eig_cg_residual,
                                  const double              max_eigenvalue,
                                  const EigenvalueAlgorithm eigenvalue_algorithm,
-                                 const PolynomialType      polynomial_type)
+                                 const PolynomialType      polynomial_type,
+                                 const double eigenvalue_drift_tolerance)
   : internal::EigenvalueAlgorithmAdditionalData<PreconditionerType>(
       smoothing_range,
       eig_cg_n_iterations,
@@ -3760,6 +4080,7 @@ inline PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
       eigenvalue_algorithm)
   , degree(degree)
   , polynomial_type(polynomial_type)
+  , eigenvalue_drift_tolerance(eigenvalue_drift_tolerance)
 {}
 
 
@@ -3770,6 +4091,8 @@ inline PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   : theta(1.)
   , delta(1.)
   , eigenvalues_are_initialized(false)
+  , use_given_eigenvalue_information(false)
+  , eigenvector_rayleigh_quotient(0.)
 {
   static_assert(
     std::is_same_v<size_type, typename VectorType::size_type>,
@@ -3790,7 +4113,8 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::initialize(
          ExcMessage("The degree of the Chebyshev method must be positive."));
   internal::PreconditionChebyshevImplementation::initialize_preconditioner(
     matrix, data.preconditioner);
-  eigenvalues_are_initialized = false;
+  eigenvalues_are_initialized      = false;
+  use_given_eigenvalue_information = false;
 }
 
 
@@ -3799,7 +4123,10 @@ template <typename MatrixType, typename VectorType, typename PreconditionerType>
 inline void
 PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::clear()
 {
-  eigenvalues_are_initialized = false;
+  eigenvalues_are_initialized      = false;
+  use_given_eigenvalue_information = false;
+  eigenvalue_information           = EigenvalueInformation();
+  eigenvector_rayleigh_quotient    = 0.;
   theta = delta = 1.0;
   matrix_ptr    = nullptr;
   {
@@ -3807,6 +4134,7 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::clear()
     solution_old.reinit(empty_vector);
     temp_vector1.reinit(empty_vector);
     temp_vector2.reinit(empty_vector);
+    eigenvector_estimate.reinit(empty_vector);
   }
   data.preconditioner.reset();
 }
@@ -3823,8 +4151,78 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   solution_old.reinit(src);
   temp_vector1.reinit(src, true);
 
-  auto info = internal::estimate_eigenvalues<MatrixType>(
-    data, matrix_ptr, solution_old, temp_vector1, data.degree);
+  const bool track_eigenvector =
+    data.eigenvalue_drift_tolerance > 0. && data.eig_cg_n_iterations > 0;
+  const bool has_eigenvector_estimate =
+    track_eigenvector && eigenvector_estimate.size() == src.size() &&
+    internal::vectors_have_same_layout(eigenvector_estimate, src);
+
+  // check whether the estimate of the previous matrix is still good enough
+  // by comparing the Rayleigh quotients of the stored eigenvector
+  bool reuse_information = use_given_eigenvalue_information;
+  if (!reuse_information && has_eigenvector_estimate)
+    {
+      temp_vector2.reinit(src, true);
+      const double rayleigh_quotient =
+        internal::preconditioned_rayleigh_quotient(*matrix_ptr,
+                                                   eigenvector_estimate,
+                                                   *data.preconditioner,
+                                                   temp_vector1,
+                                                   temp_vector2);
+      reuse_information =
+        std::abs(rayleigh_quotient - eigenvector_rayleigh_quotient) <=
+        data.eigenvalue_drift_tolerance *
+          std::abs(eigenvector_rayleigh_quotient);
+    }
+
+  EigenvalueInformation info;
+  if (reuse_information)
+    {
+      info               = eigenvalue_information;
+      info.cg_iterations = 0;
+    }
+  else
+    {
+      info = internal::estimate_eigenvalues<MatrixType>(
+        data,
+        matrix_ptr,
+        solution_old,
+        temp_vector1,
+        data.degree,
+        has_eigenvector_estimate ? &eigenvector_estimate : nullptr);
+
+      // keep an approximation of the eigenvector of the largest eigenvalue
+      // for comparison with the next matrix: the power iteration leaves it
+      // in temp_vector1, otherwise apply one step of the power iteration to
+      // the initial guess of the eigenvalue algorithm
+      if (track_eigenvector)
+        {
+          if (data.eigenvalue_algorithm ==
+              internal::EigenvalueAlgorithm::power_iteration)
+            eigenvector_estimate = temp_vector1;
+          else
+            {
+              if (!has_eigenvector_estimate)
+                {
+                  eigenvector_estimate.reinit(src, true);
+                  internal::set_initial_guess(eigenvector_estimate);
+                  data.constraints.set_zero(eigenvector_estimate);
+                }
+              matrix_ptr->vmult(temp_vector1, eigenvector_estimate);
+              data.preconditioner->vmult(eigenvector_estimate, temp_vector1);
+              data.constraints.set_zero(eigenvector_estimate);
+            }
+          eigenvector_estimate /= eigenvector_estimate.l2_norm();
+
+          temp_vector2.reinit(src, true);
+          eigenvector_rayleigh_quotient =
+            internal::preconditioned_rayleigh_quotient(*matrix_ptr,
+                                                       eigenvector_estimate,
+                                                       *data.preconditioner,
+                                                       temp_vector1,
+                                                       temp_vector2);
+        }
+    }
 
   const double alpha = (data.smoothing_range > 1. ?
                           info.max_eigenvalue_estimate / data.smoothing_range :
@@ -3851,7 +4249,8 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
               std::log(1. / sigma));
     }
 
-  info.degree = data.degree;
+  info.degree            = data.degree;
+  eigenvalue_information = info;
 
   const_cast<
     PreconditionChebyshev<MatrixType, VectorType, PreconditionerType> *>(this)
@@ -3892,6 +4291,33 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
 
 
 
+template <typename MatrixType, typename VectorType, typename PreconditionerType>
+inline const typename internal::EigenvalueInformation &
+PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
+  get_eigenvalue_information() const
+{
+  return eigenvalue_information;
+}
+
+
+
+template <typename MatrixType, typename VectorType, typename PreconditionerType>
+inline void
+PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
+  set_eigenvalue_information(const EigenvalueInformation &information)
+{
+  Assert(matrix_ptr != nullptr, ExcNotInitialized());
+  Assert(information.min_eigenvalue_estimate <=
+           information.max_eigenvalue_estimate,
+         ExcMessage("The given eigenvalue information is not valid."));
+
+  eigenvalue_information           = information;
+  use_given_eigenvalue_information = true;
+  eigenvalues_are_initialized      = false;
+}
+
+
+
 template <typename MatrixType, typename VectorType, typename PreconditionerType>
 inline void
 PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::vmult(
@@ -20,6 +20,7 @@
 #include <deal.II/base/smartpointer.h>
 #include <deal.II/base/subscriptor.h>
 
+#include <deal.II/lac/batched_full_matrix.h>
 #include <deal.II/lac/precondition_block_base.h>
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/vector.h>
@@ -148,6 +149,31 @@ public:
      */
     unsigned int kernel_size = 0;
 
+    /**
+     * Store the inverses of the diagonal blocks in an interleaved layout
+     * for SIMD processing. If this flag is true, the blocks are grouped by
+     * their size, and the inverses of the blocks of each group are stored
+     * in a BatchedFullMatrix, such that VectorizedArray::size() blocks are
+     * inverted and applied at once. The residuals and corrections of all
+     * blocks are furthermore computed in parallel with tasks before they
+     * are added into the destination vector in the order of the blocks. The
+     * diagonal blocks themselves are kept if
+     * PreconditionBlockBase::store_diagonals() is set, as without this flag.
+     *
+     * Since all blocks are processed at once, this flag can only be used
+     * with RelaxationBlockJacobi. The multiplicative methods
+     * RelaxationBlockSOR and RelaxationBlockSSOR have to apply the inverses
+     * one block at a time, because each block depends on the update of the
+     * previous ones.
+     *
+     * This option is most useful for a large number of small blocks like
+     * vertex patches. It requires #inversion to be
+     * PreconditionBlockBase::gauss_jordan; the inverses are computed by an
+     * LU factorization without pivoting, see BatchedFullMatrix, and applied
+     * in the precision of @p InverseNumberType.
+     */
+    bool batched_inverses = false;
+
     /**
      * The order in which blocks should be traversed. This vector can initiate
      * several modes of execution:
@@ -225,6 +251,13 @@ public:
   void
   invert_diagblocks();
 
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
 protected:
   /**
    * Perform one block relaxation step.
@@ -233,12 +266,18 @@ protected:
    * (both reference the same vector) or a Jacobi step (both are different
    * vectors). For the Jacobi step, the calling function must copy @p dst to
    * @p prev after this.
+   *
+   * The flag @p additive states that the step is a Jacobi step, i.e., that
+   * the residuals of all blocks only depend on @p prev. With
+   * AdditionalData::batched_inverses, the corrections of all blocks are then
+   * computed at once before they are added to @p dst.
    */
   void
   do_step(VectorType       &dst,
           const VectorType &prev,
           const VectorType &src,
-          const bool        backward) const;
+          const bool        backward,
+          const bool        additive = false) const;
 
   /**
    * Pointer to the matrix. Make sure that the matrix exists as long as this
@@ -263,6 +302,50 @@ private:
    */
   void
   block_kernel(const size_type block_begin, const size_type block_end);
+
+  /**
+   * Copy the diagonal block with index @p block of the matrix into
+   * @p M_cell.
+   */
+  void
+  extract_diagonal_block(const size_type                block,
+                         FullMatrix<InverseNumberType> &M_cell) const;
+
+  /**
+   * Set up the inverses in the layout selected by
+   * AdditionalData::batched_inverses.
+   */
+  void
+  invert_diagblocks_batched();
+
+  /**
+   * Compute the corrections of all blocks for the Jacobi step of do_step()
+   * with the inverses of AdditionalData::batched_inverses, in the
+   * interleaved layout of #batched_inverse.
+   */
+  void
+  compute_batched_corrections(
+    const VectorType &prev,
+    const VectorType &src,
+    std::vector<AlignedVector<VectorizedArray<InverseNumberType>>>
+      &corrections) const;
+
+  /**
+   * The inverses of the diagonal blocks of each group of blocks with equal
+   * size, if AdditionalData::batched_inverses is set.
+   */
+  std::vector<BatchedFullMatrix<InverseNumberType>> batched_inverse;
+
+  /**
+   * The blocks of each group in #batched_inverse, in ascending order.
+   */
+  std::vector<std::vector<size_type>> batched_group_blocks;
+
+  /**
+   * For each block, the group in #batched_inverse and the index of the
+   * block within the group.
+   */
+  std::vector<std::pair<unsigned int, unsigned int>> batched_block_index;
 };
 
 
@@ -334,6 +417,11 @@ public:
    * Make function of base class public again.
    */
   using PreconditionBlockBase<InverseNumberType>::log_statistics;
+  /**
+   * Make function of base class public again.
+   */
+  using RelaxationBlock<MatrixType, InverseNumberType, VectorType>::
+    memory_consumption;
   /**
    * Perform one step of the Jacobi iteration.
    */
@@ -430,6 +518,11 @@ public:
    * Make function of base class public again.
    */
   using PreconditionBlockBase<InverseNumberType>::log_statistics;
+  /**
+   * Make function of base class public again.
+   */
+  using RelaxationBlock<MatrixType, InverseNumberType, VectorType>::
+    memory_consumption;
   /**
    * Perform one step of the SOR iteration.
    */
@@ -521,6 +614,11 @@ public:
    * Make function of base class public again.
    */
   using PreconditionBlockBase<InverseNumberType>::log_statistics;
+  /**
+   * Make function of base class public again.
+   */
+  using RelaxationBlock<MatrixType, InverseNumberType, VectorType>::
+    memory_consumption;
   /**
    * Perform one step of the SSOR iteration.
    */
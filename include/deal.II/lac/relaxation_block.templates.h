@@ -22,6 +22,8 @@
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_memory.h>
 
+#include <map>
+
 DEAL_II_NAMESPACE_OPEN
 
 template <typename MatrixType, typename InverseNumberType, typename VectorType>
@@ -83,10 +85,25 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::clear()
 {
   A               = nullptr;
   additional_data = nullptr;
+  batched_inverse.clear();
+  batched_group_blocks.clear();
+  batched_block_index.clear();
   PreconditionBlockBase<InverseNumberType>::clear();
 }
 
 
+template <typename MatrixType, typename InverseNumberType, typename VectorType>
+inline std::size_t
+RelaxationBlock<MatrixType, InverseNumberType, VectorType>::memory_consumption()
+  const
+{
+  return PreconditionBlockBase<InverseNumberType>::memory_consumption() +
+         MemoryConsumption::memory_consumption(batched_inverse) +
+         MemoryConsumption::memory_consumption(batched_group_blocks) +
+         MemoryConsumption::memory_consumption(batched_block_index);
+}
+
+
 template <typename MatrixType, typename InverseNumberType, typename VectorType>
 inline void
 RelaxationBlock<MatrixType, InverseNumberType, VectorType>::invert_diagblocks()
@@ -95,6 +112,8 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::invert_diagblocks()
     {
       DEAL_II_NOT_IMPLEMENTED();
     }
+  else if (this->additional_data->batched_inverses)
+    invert_diagblocks_batched();
   else
     {
       // compute blocks in parallel
@@ -116,31 +135,13 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::block_kernel(
   const size_type block_begin,
   const size_type block_end)
 {
-  const MatrixType             &M = *(this->A);
   FullMatrix<InverseNumberType> M_cell;
 
   for (size_type block = block_begin; block < block_end; ++block)
     {
       const size_type bs = this->additional_data->block_list.row_length(block);
-      M_cell.reinit(bs, bs);
+      extract_diagonal_block(block, M_cell);
 
-      // Copy rows for this block into the matrix for the diagonal block
-      SparsityPattern::iterator row =
-        this->additional_data->block_list.begin(block);
-      for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
-        {
-          for (typename MatrixType::const_iterator entry =
-                 M.begin(row->column());
-               entry != M.end(row->column());
-               ++entry)
-            {
-              const size_type column = entry->column();
-              const size_type col_cell =
-                this->additional_data->block_list.row_position(block, column);
-              if (col_cell != numbers::invalid_size_type)
-                M_cell(row_cell, col_cell) = entry->value();
-            }
-        }
       // Now M_cell contains the diagonal block. Now store it and its
       // inverse, if so requested.
       if (this->store_diagonals())
@@ -173,6 +174,166 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::block_kernel(
     }
 }
 
+
+template <typename MatrixType, typename InverseNumberType, typename VectorType>
+inline void
+RelaxationBlock<MatrixType, InverseNumberType, VectorType>::
+  extract_diagonal_block(const size_type                block,
+                         FullMatrix<InverseNumberType> &M_cell) const
+{
+  const MatrixType &M  = *(this->A);
+  const size_type   bs = this->additional_data->block_list.row_length(block);
+  M_cell.reinit(bs, bs);
+
+  // Copy rows for this block into the matrix for the diagonal block
+  SparsityPattern::iterator row =
+    this->additional_data->block_list.begin(block);
+  for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
+    {
+      for (typename MatrixType::const_iterator entry = M.begin(row->column());
+           entry != M.end(row->column());
+           ++entry)
+        {
+          const size_type column = entry->column();
+          const size_type col_cell =
+            this->additional_data->block_list.row_position(block, column);
+          if (col_cell != numbers::invalid_size_type)
+            M_cell(row_cell, col_cell) = entry->value();
+        }
+    }
+}
+
+
+template <typename MatrixType, typename InverseNumberType, typename VectorType>
+inline void
+RelaxationBlock<MatrixType, InverseNumberType, VectorType>::
+  invert_diagblocks_batched()
+{
+  Assert(this->inversion ==
+           PreconditionBlockBase<InverseNumberType>::gauss_jordan,
+         ExcNotImplemented());
+
+  const SparsityPattern &block_list = this->additional_data->block_list;
+  const size_type        n_blocks   = block_list.n_rows();
+  constexpr unsigned int n_lanes =
+    BatchedFullMatrix<InverseNumberType>::n_lanes;
+
+  // group the blocks by their size
+  std::map<size_type, unsigned int> group_of_size;
+  batched_group_blocks.clear();
+  batched_block_index.resize(n_blocks);
+  for (size_type block = 0; block < n_blocks; ++block)
+    {
+      const unsigned int group =
+        group_of_size
+          .emplace(block_list.row_length(block), group_of_size.size())
+          .first->second;
+      if (group == batched_group_blocks.size())
+        batched_group_blocks.emplace_back();
+      batched_block_index[block] = {group,
+                                    batched_group_blocks[group].size()};
+      batched_group_blocks[group].push_back(block);
+    }
+
+  // extract the blocks of each group in parallel over the batches, such that
+  // each task writes to separate matrices, and invert them
+  batched_inverse.resize(batched_group_blocks.size());
+  for (unsigned int group = 0; group < batched_group_blocks.size(); ++group)
+    {
+      const std::vector<size_type> &blocks = batched_group_blocks[group];
+      BatchedFullMatrix<InverseNumberType> &inverse = batched_inverse[group];
+      inverse.reinit(blocks.size(),
+                     block_list.row_length(blocks[0]),
+                     block_list.row_length(blocks[0]));
+      parallel::apply_to_subranges(
+        0U,
+        inverse.n_batches(),
+        [&](const unsigned int batch_begin, const unsigned int batch_end) {
+          FullMatrix<InverseNumberType> M_cell;
+          for (unsigned int batch = batch_begin; batch < batch_end; ++batch)
+            for (unsigned int v = 0;
+                 v < n_lanes && batch * n_lanes + v < blocks.size();
+                 ++v)
+              {
+                const size_type block = blocks[batch * n_lanes + v];
+                extract_diagonal_block(block, M_cell);
+                if (this->store_diagonals())
+                  {
+                    this->diagonal(block).reinit(M_cell.m(), M_cell.n());
+                    this->diagonal(block) = M_cell;
+                  }
+                inverse.set_matrix(batch * n_lanes + v, M_cell);
+              }
+        },
+        4);
+      inverse.invert();
+    }
+}
+
+
+template <typename MatrixType, typename InverseNumberType, typename VectorType>
+inline void
+RelaxationBlock<MatrixType, InverseNumberType, VectorType>::
+  compute_batched_corrections(
+    const VectorType &prev,
+    const VectorType &src,
+    std::vector<AlignedVector<VectorizedArray<InverseNumberType>>>
+      &corrections) const
+{
+  const MatrixType      &M          = *this->A;
+  const SparsityPattern &block_list = additional_data->block_list;
+  constexpr unsigned int n_lanes =
+    BatchedFullMatrix<InverseNumberType>::n_lanes;
+
+  corrections.resize(batched_inverse.size());
+  for (unsigned int group = 0; group < batched_inverse.size(); ++group)
+    {
+      const std::vector<size_type> &blocks  = batched_group_blocks[group];
+      const BatchedFullMatrix<InverseNumberType> &inverse =
+        batched_inverse[group];
+      const unsigned int bs = inverse.m();
+      corrections[group].resize_fast(inverse.n_batches() * bs);
+
+      // the residuals of all blocks only depend on prev, so they can be
+      // computed and multiplied by the inverses independently
+      parallel::apply_to_subranges(
+        0U,
+        inverse.n_batches(),
+        [&](const unsigned int batch_begin, const unsigned int batch_end) {
+          AlignedVector<VectorizedArray<InverseNumberType>> residual(bs);
+          for (unsigned int batch = batch_begin; batch < batch_end; ++batch)
+            {
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                {
+                  if (batch * n_lanes + v >= blocks.size())
+                    {
+                      for (unsigned int i = 0; i < bs; ++i)
+                        residual[i][v] = 0;
+                      continue;
+                    }
+                  SparsityPattern::iterator row =
+                    block_list.begin(blocks[batch * n_lanes + v]);
+                  for (unsigned int i = 0; i < bs; ++i, ++row)
+                    {
+                      typename VectorType::value_type r = src(row->column());
+                      for (typename MatrixType::const_iterator entry =
+                             M.begin(row->column());
+                           entry != M.end(row->column());
+                           ++entry)
+                        r -= entry->value() * prev(entry->column());
+                      residual[i][v] = r;
+                    }
+                }
+              inverse.vmult(batch,
+                            corrections[group].data() + batch * bs,
+                            residual.data());
+            }
+        },
+        4);
+    }
+}
+
+
 namespace internal
 {
   /**
@@ -219,9 +380,17 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
   VectorType       &dst,
   const VectorType &prev,
   const VectorType &src,
-  const bool        backward) const
+  const bool        backward,
+  const bool        additive) const
 {
   Assert(additional_data->invert_diagonal, ExcNotImplemented());
+  Assert(additive == false || &dst != &prev,
+         ExcMessage("The Jacobi step needs separate vectors dst and prev."));
+  Assert(additional_data->batched_inverses == false || additive == true,
+         ExcMessage("The batched inverses of "
+                    "AdditionalData::batched_inverses can only be used with "
+                    "the Jacobi method."));
+  (void)additive;
 
   const VectorType &ghosted_prev =
     internal::prepare_ghost_vector(prev, additional_data->temp_ghost_vector);
@@ -229,6 +398,15 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
   const MatrixType                       &M = *this->A;
   Vector<typename VectorType::value_type> b_cell, x_cell;
 
+  // for the Jacobi method with batched inverses, compute the corrections of
+  // all blocks up front and only add them in the loop below
+  std::vector<AlignedVector<VectorizedArray<InverseNumberType>>> corrections;
+  const bool use_batched_corrections = additional_data->batched_inverses;
+  if (use_batched_corrections)
+    compute_batched_corrections(ghosted_prev, src, corrections);
+  constexpr unsigned int n_lanes =
+    BatchedFullMatrix<InverseNumberType>::n_lanes;
+
   const bool         permutation_empty = additional_data->order.empty();
   const unsigned int n_permutations =
     (permutation_empty) ? 1U : additional_data->order.size();
@@ -252,6 +430,19 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
 
           const size_type bs = additional_data->block_list.row_length(block);
 
+          if (use_batched_corrections)
+            {
+              const auto [group, index] = batched_block_index[block];
+              const VectorizedArray<InverseNumberType> *correction =
+                corrections[group].data() + (index / n_lanes) * bs;
+              SparsityPattern::iterator row =
+                additional_data->block_list.begin(block);
+              for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
+                dst(row->column()) += additional_data->relaxation *
+                                      correction[row_cell][index % n_lanes];
+              continue;
+            }
+
           b_cell.reinit(bs);
           x_cell.reinit(bs);
           // Collect off-diagonal parts
@@ -298,7 +489,7 @@ RelaxationBlockJacobi<MatrixType, InverseNumberType, VectorType>::step(
   typename VectorMemory<VectorType>::Pointer aux(mem);
   aux->reinit(dst, false);
   *aux = dst;
-  this->do_step(dst, *aux, src, false);
+  this->do_step(dst, *aux, src, false, true);
 }
 
 
@@ -312,7 +503,7 @@ RelaxationBlockJacobi<MatrixType, InverseNumberType, VectorType>::Tstep(
   typename VectorMemory<VectorType>::Pointer aux(mem);
   aux->reinit(dst, false);
   *aux = dst;
-  this->do_step(dst, *aux, src, true);
+  this->do_step(dst, *aux, src, true, true);
 }
 
 
@@ -326,7 +517,7 @@ RelaxationBlockJacobi<MatrixType, InverseNumberType, VectorType>::vmult(
   typename VectorMemory<VectorType>::Pointer aux(mem);
   dst = 0;
   aux->reinit(dst);
-  this->do_step(dst, *aux, src, false);
+  this->do_step(dst, *aux, src, false, true);
 }
 
 
@@ -340,7 +531,7 @@ RelaxationBlockJacobi<MatrixType, InverseNumberType, VectorType>::Tvmult(
   typename VectorMemory<VectorType>::Pointer aux(mem);
   dst = 0;
   aux->reinit(dst);
-  this->do_step(dst, *aux, src, true);
+  this->do_step(dst, *aux, src, true, true);
 }
 
 
@@ -282,14 +282,15 @@ typename SolverBicgstab<VectorType>::IterationResult
                                       const PreconditionerType &preconditioner,
                                       const unsigned int        last_step)
 {
-  // Allocate temporary memory.
-  typename VectorMemory<VectorType>::Pointer Vr(this->memory);
-  typename VectorMemory<VectorType>::Pointer Vrbar(this->memory);
-  typename VectorMemory<VectorType>::Pointer Vp(this->memory);
-  typename VectorMemory<VectorType>::Pointer Vy(this->memory);
-  typename VectorMemory<VectorType>::Pointer Vz(this->memory);
-  typename VectorMemory<VectorType>::Pointer Vt(this->memory);
-  typename VectorMemory<VectorType>::Pointer Vv(this->memory);
+  // Allocate temporary memory with the layout of x, without setting the
+  // vector entries.
+  typename VectorMemory<VectorType>::Pointer Vr(this->memory, x, true);
+  typename VectorMemory<VectorType>::Pointer Vrbar(this->memory, x, true);
+  typename VectorMemory<VectorType>::Pointer Vp(this->memory, x, true);
+  typename VectorMemory<VectorType>::Pointer Vy(this->memory, x, true);
+  typename VectorMemory<VectorType>::Pointer Vz(this->memory, x, true);
+  typename VectorMemory<VectorType>::Pointer Vt(this->memory, x, true);
+  typename VectorMemory<VectorType>::Pointer Vv(this->memory, x, true);
 
   // Define a few aliases for simpler use of the vectors
   VectorType &r    = *Vr;
@@ -300,14 +301,6 @@ typename SolverBicgstab<VectorType>::IterationResult
   VectorType &t    = *Vt;
   VectorType &v    = *Vv;
 
-  r.reinit(x, true);
-  rbar.reinit(x, true);
-  p.reinit(x, true);
-  y.reinit(x, true);
-  z.reinit(x, true);
-  t.reinit(x, true);
-  v.reinit(x, true);
-
   using value_type = typename VectorType::value_type;
   using real_type  = typename numbers::NumberTraits<value_type>::real_type;
 
@@ -518,6 +518,8 @@ namespace internal
       double residual_norm;
       Number previous_alpha;
 
+      // Allocate the vectors with the layout of x, without setting the
+      // vector entries, as those would soon be overwritten anyway
       IterationWorkerBase(const MatrixType         &A,
                           const PreconditionerType &preconditioner,
                           const bool                flexible,
@@ -527,10 +529,14 @@ namespace internal
         , preconditioner(preconditioner)
         , flexible(flexible)
         , x(x)
-        , r_pointer(memory)
-        , p_pointer(memory)
-        , v_pointer(memory)
-        , z_pointer(memory)
+        , r_pointer(memory, x, true)
+        , p_pointer(memory, x, true)
+        , v_pointer(memory, x, true)
+        , z_pointer(flexible ?
+                      typename VectorMemory<VectorType>::Pointer(memory,
+                                                                 x,
+                                                                 true) :
+                      typename VectorMemory<VectorType>::Pointer(memory))
         , r(*r_pointer)
         , p(*p_pointer)
         , v(*v_pointer)
@@ -545,14 +551,6 @@ namespace internal
       void
       startup(const VectorType &b)
       {
-        // Initialize without setting the vector entries, as those would soon
-        // be overwritten anyway
-        r.reinit(x, true);
-        p.reinit(x, true);
-        v.reinit(x, true);
-        if (flexible)
-          z.reinit(x, true);
-
         // compute residual. if vector is zero, then short-circuit the full
         // computation
         if (!x.all_zero())
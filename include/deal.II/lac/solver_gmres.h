@@ -19,7 +19,10 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/vectorization.h>
@@ -817,35 +820,72 @@ namespace internal
 
 
 
+    // Vectors that store their locally owned entries contiguously and for
+    // which the fused orthogonalization kernels below can be used
+    template <typename VectorType>
+    constexpr bool is_dealii_compatible_vector_block =
+      std::is_same_v<
+        VectorType,
+        LinearAlgebra::distributed::Vector<typename VectorType::value_type,
+                                           MemorySpace::Host>> ||
+      std::is_same_v<VectorType, Vector<typename VectorType::value_type>>;
+
     template <typename VectorType, typename Enable = void>
-    struct is_dealii_compatible_distributed_vector;
+    struct is_dealii_compatible_vector;
 
     template <typename VectorType>
-    struct is_dealii_compatible_distributed_vector<
+    struct is_dealii_compatible_vector<
       VectorType,
       std::enable_if_t<!internal::is_block_vector<VectorType>>>
     {
-      static constexpr bool value = std::is_same_v<
-        VectorType,
-        LinearAlgebra::distributed::Vector<typename VectorType::value_type,
-                                           MemorySpace::Host>>;
+      static constexpr bool value =
+        is_dealii_compatible_vector_block<VectorType>;
     };
 
 
 
     template <typename VectorType>
-    struct is_dealii_compatible_distributed_vector<
+    struct is_dealii_compatible_vector<
       VectorType,
       std::enable_if_t<internal::is_block_vector<VectorType>>>
     {
-      static constexpr bool value = std::is_same_v<
-        typename VectorType::BlockType,
-        LinearAlgebra::distributed::Vector<typename VectorType::value_type,
-                                           MemorySpace::Host>>;
+      static constexpr bool value =
+        is_dealii_compatible_vector_block<typename VectorType::BlockType>;
     };
 
 
 
+    // The communicator over which the fused orthogonalization kernels need
+    // to sum their results
+    template <typename Number>
+    MPI_Comm
+    get_communicator(
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>
+        &vector)
+    {
+      return vector.get_mpi_communicator();
+    }
+
+
+
+    template <typename Number>
+    MPI_Comm
+    get_communicator(const Vector<Number> &)
+    {
+      return MPI_COMM_SELF;
+    }
+
+
+
+    // Number of vector entries that are processed by one task in the fused
+    // orthogonalization kernels. The partial sums of the chunks are added in
+    // a fixed order, which makes the result independent of the number of
+    // threads. The value is a multiple of the batch sizes of the kernels
+    // for all SIMD widths.
+    constexpr unsigned int orthogonalization_chunk_size = 6144;
+
+
+
     template <typename VectorType,
               std::enable_if_t<!IsBlockVector<VectorType>::value, VectorType>
                 * = nullptr>
@@ -919,7 +959,7 @@ namespace internal
     template <bool delayed_reorthogonalization,
               typename VectorType,
               std::enable_if_t<
-                !is_dealii_compatible_distributed_vector<VectorType>::value,
+                !is_dealii_compatible_vector<VectorType>::value,
                 VectorType> * = nullptr>
     void
     Tvmult_add(const unsigned int            n,
@@ -939,162 +979,211 @@ namespace internal
 
 
 
-    template <bool delayed_reorthogonalization,
-              typename VectorType,
-              std::enable_if_t<
-                is_dealii_compatible_distributed_vector<VectorType>::value,
-                VectorType> * = nullptr>
+    // Compute the contributions of the locally owned entries in the range
+    // [begin, end) of block b to the inner products of vv with the
+    // orthogonal vectors (and, for the delayed reorthogonalization, of the
+    // last orthogonal vector with the other ones and of vv with itself), and
+    // add them to the array h_local
+    template <bool delayed_reorthogonalization, typename VectorType>
     void
-    Tvmult_add(const unsigned int            n,
-               const VectorType             &vv,
-               const TmpVectors<VectorType> &orthogonal_vectors,
-               Vector<double>               &h)
+    Tvmult_add_on_subrange(const unsigned int            n,
+                           const VectorType             &vv,
+                           const TmpVectors<VectorType> &orthogonal_vectors,
+                           const unsigned int            b,
+                           const unsigned int            begin,
+                           const unsigned int            end,
+                           double                       *h_local)
     {
-      for (unsigned int b = 0; b < n_blocks(vv); ++b)
-        {
-          unsigned int j = 0;
+      static constexpr unsigned int n_lanes = VectorizedArray<double>::size();
 
-          if (n <= 128)
+      // keep the accumulators on the stack for up to 128 vectors, which
+      // covers the typical basis sizes, and on the heap otherwise
+      VectorizedArray<double> hs_stack[128];
+      VectorizedArray<double>
+        correct_stack[delayed_reorthogonalization ? 129 : 1];
+      AlignedVector<VectorizedArray<double>> hs_heap, correct_heap;
+      VectorizedArray<double>               *hs      = hs_stack;
+      VectorizedArray<double>               *correct = correct_stack;
+      if (n > 128)
+        {
+          hs_heap.resize(n);
+          hs = hs_heap.data();
+          if (delayed_reorthogonalization)
             {
-              // optimized path
-              static constexpr unsigned int n_lanes =
-                VectorizedArray<double>::size();
-
-              VectorizedArray<double> hs[128];
-              for (unsigned int i = 0; i < n; ++i)
-                hs[i] = 0.0;
-              VectorizedArray<double>
-                correct[delayed_reorthogonalization ? 129 : 1];
-              if (delayed_reorthogonalization)
-                for (unsigned int i = 0; i < n + 1; ++i)
-                  correct[i] = 0.0;
+              correct_heap.resize(n + 1);
+              correct = correct_heap.data();
+            }
+        }
 
-              unsigned int c = 0;
+      for (unsigned int i = 0; i < n; ++i)
+        hs[i] = 0.0;
+      if (delayed_reorthogonalization)
+        for (unsigned int i = 0; i < n + 1; ++i)
+          correct[i] = 0.0;
 
-              constexpr unsigned int inner_batch_size =
-                delayed_reorthogonalization ? 6 : 12;
+      constexpr unsigned int inner_batch_size =
+        delayed_reorthogonalization ? 6 : 12;
 
-              for (; c < block(vv, b).locally_owned_size() / n_lanes /
-                           inner_batch_size;
-                   ++c, j += n_lanes * inner_batch_size)
-                {
-                  VectorizedArray<double> vvec[inner_batch_size];
-                  for (unsigned int k = 0; k < inner_batch_size; ++k)
-                    vvec[k].load(block(vv, b).begin() + j + k * n_lanes);
-                  VectorizedArray<double> last_vector[inner_batch_size];
-                  for (unsigned int k = 0; k < inner_batch_size; ++k)
-                    last_vector[k].load(
-                      block(orthogonal_vectors[n - 1], b).begin() + j +
-                      k * n_lanes);
+      unsigned int j = begin;
+      for (; j + n_lanes * inner_batch_size <= end;
+           j += n_lanes * inner_batch_size)
+        {
+          VectorizedArray<double> vvec[inner_batch_size];
+          for (unsigned int k = 0; k < inner_batch_size; ++k)
+            vvec[k].load(block(vv, b).begin() + j + k * n_lanes);
+          VectorizedArray<double> last_vector[inner_batch_size];
+          for (unsigned int k = 0; k < inner_batch_size; ++k)
+            last_vector[k].load(block(orthogonal_vectors[n - 1], b).begin() +
+                                j + k * n_lanes);
 
+          {
+            VectorizedArray<double> local_sum_0 = last_vector[0] * vvec[0];
+            VectorizedArray<double> local_sum_1 =
+              last_vector[0] * last_vector[0];
+            VectorizedArray<double> local_sum_2 = vvec[0] * vvec[0];
+            for (unsigned int k = 1; k < inner_batch_size; ++k)
+              {
+                local_sum_0 += last_vector[k] * vvec[k];
+                if (delayed_reorthogonalization)
                   {
-                    VectorizedArray<double> local_sum_0 =
-                      last_vector[0] * vvec[0];
-                    VectorizedArray<double> local_sum_1 =
-                      last_vector[0] * last_vector[0];
-                    VectorizedArray<double> local_sum_2 = vvec[0] * vvec[0];
-                    for (unsigned int k = 1; k < inner_batch_size; ++k)
-                      {
-                        local_sum_0 += last_vector[k] * vvec[k];
-                        if (delayed_reorthogonalization)
-                          {
-                            local_sum_1 += last_vector[k] * last_vector[k];
-                            local_sum_2 += vvec[k] * vvec[k];
-                          }
-                      }
-                    hs[n - 1] += local_sum_0;
-                    if (delayed_reorthogonalization)
-                      {
-                        correct[n - 1] += local_sum_1;
-                        correct[n] += local_sum_2;
-                      }
+                    local_sum_1 += last_vector[k] * last_vector[k];
+                    local_sum_2 += vvec[k] * vvec[k];
                   }
+              }
+            hs[n - 1] += local_sum_0;
+            if (delayed_reorthogonalization)
+              {
+                correct[n - 1] += local_sum_1;
+                correct[n] += local_sum_2;
+              }
+          }
 
-                  for (unsigned int i = 0; i < n - 1; ++i)
-                    {
-                      // break the dependency chain into the field hs[i] for
-                      // small sizes i by first accumulating 4 or 8 results
-                      // into a local variable
-                      VectorizedArray<double> temp;
-                      temp.load(block(orthogonal_vectors[i], b).begin() + j);
-                      VectorizedArray<double> local_sum_0 = temp * vvec[0];
-                      VectorizedArray<double> local_sum_1 =
-                        delayed_reorthogonalization ? temp * last_vector[0] :
-                                                      0.;
-                      for (unsigned int k = 1; k < inner_batch_size; ++k)
-                        {
-                          temp.load(block(orthogonal_vectors[i], b).begin() +
-                                    j + k * n_lanes);
-                          local_sum_0 += temp * vvec[k];
-                          if (delayed_reorthogonalization)
-                            local_sum_1 += temp * last_vector[k];
-                        }
-                      hs[i] += local_sum_0;
-                      if (delayed_reorthogonalization)
-                        correct[i] += local_sum_1;
-                    }
-                }
-
-              c *= inner_batch_size;
-              for (; c < block(vv, b).locally_owned_size() / n_lanes;
-                   ++c, j += n_lanes)
+          for (unsigned int i = 0; i < n - 1; ++i)
+            {
+              // break the dependency chain into the field hs[i] for
+              // small sizes i by first accumulating 4 or 8 results
+              // into a local variable
+              VectorizedArray<double> temp;
+              temp.load(block(orthogonal_vectors[i], b).begin() + j);
+              VectorizedArray<double> local_sum_0 = temp * vvec[0];
+              VectorizedArray<double> local_sum_1 =
+                delayed_reorthogonalization ? temp * last_vector[0] : 0.;
+              for (unsigned int k = 1; k < inner_batch_size; ++k)
                 {
-                  VectorizedArray<double> vvec, last_vector;
-                  vvec.load(block(vv, b).begin() + j);
-                  last_vector.load(block(orthogonal_vectors[n - 1], b).begin() +
-                                   j);
-                  hs[n - 1] += last_vector * vvec;
+                  temp.load(block(orthogonal_vectors[i], b).begin() + j +
+                            k * n_lanes);
+                  local_sum_0 += temp * vvec[k];
                   if (delayed_reorthogonalization)
-                    {
-                      correct[n - 1] += last_vector * last_vector;
-                      correct[n] += vvec * vvec;
-                    }
-
-                  for (unsigned int i = 0; i < n - 1; ++i)
-                    {
-                      VectorizedArray<double> temp;
-                      temp.load(block(orthogonal_vectors[i], b).begin() + j);
-                      hs[i] += temp * vvec;
-                      if (delayed_reorthogonalization)
-                        correct[i] += temp * last_vector;
-                    }
+                    local_sum_1 += temp * last_vector[k];
                 }
+              hs[i] += local_sum_0;
+              if (delayed_reorthogonalization)
+                correct[i] += local_sum_1;
+            }
+        }
 
-              for (unsigned int i = 0; i < n; ++i)
-                {
-                  h(i) += hs[i].sum();
-                  if (delayed_reorthogonalization)
-                    h(i + n) += correct[i].sum();
-                }
+      for (; j + n_lanes <= end; j += n_lanes)
+        {
+          VectorizedArray<double> vvec, last_vector;
+          vvec.load(block(vv, b).begin() + j);
+          last_vector.load(block(orthogonal_vectors[n - 1], b).begin() + j);
+          hs[n - 1] += last_vector * vvec;
+          if (delayed_reorthogonalization)
+            {
+              correct[n - 1] += last_vector * last_vector;
+              correct[n] += vvec * vvec;
+            }
+
+          for (unsigned int i = 0; i < n - 1; ++i)
+            {
+              VectorizedArray<double> temp;
+              temp.load(block(orthogonal_vectors[i], b).begin() + j);
+              hs[i] += temp * vvec;
               if (delayed_reorthogonalization)
-                h(n + n) += correct[n].sum();
+                correct[i] += temp * last_vector;
             }
+        }
+
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          h_local[i] += hs[i].sum();
+          if (delayed_reorthogonalization)
+            h_local[i + n] += correct[i].sum();
+        }
+      if (delayed_reorthogonalization)
+        h_local[n + n] += correct[n].sum();
 
-          // remainder loop of optimized path or non-optimized path (if
-          // n>128)
-          for (; j < block(vv, b).locally_owned_size(); ++j)
+      // remainder loop
+      for (; j < end; ++j)
+        {
+          const double vvec = block(vv, b).begin()[j];
+          const double last_vector =
+            block(orthogonal_vectors[n - 1], b).begin()[j];
+          h_local[n - 1] += last_vector * vvec;
+          if (delayed_reorthogonalization)
             {
-              const double vvec = block(vv, b).local_element(j);
-              const double last_vector =
-                block(orthogonal_vectors[n - 1], b).local_element(j);
-              h(n - 1) += last_vector * vvec;
+              h_local[n + n - 1] += last_vector * last_vector;
+              h_local[n + n] += vvec * vvec;
+            }
+          for (unsigned int i = 0; i < n - 1; ++i)
+            {
+              const double temp = block(orthogonal_vectors[i], b).begin()[j];
+              h_local[i] += temp * vvec;
               if (delayed_reorthogonalization)
-                {
-                  h(n + n - 1) += last_vector * last_vector;
-                  h(n + n) += vvec * vvec;
-                }
-              for (unsigned int i = 0; i < n - 1; ++i)
-                {
-                  const double temp =
-                    block(orthogonal_vectors[i], b).local_element(j);
-                  h(i) += temp * vvec;
-                  if (delayed_reorthogonalization)
-                    h(n + i) += temp * last_vector;
-                }
+                h_local[n + i] += temp * last_vector;
             }
         }
+    }
+
+
+
+    template <bool delayed_reorthogonalization,
+              typename VectorType,
+              std::enable_if_t<
+                is_dealii_compatible_vector<VectorType>::value,
+                VectorType> * = nullptr>
+    void
+    Tvmult_add(const unsigned int            n,
+               const VectorType             &vv,
+               const TmpVectors<VectorType> &orthogonal_vectors,
+               Vector<double>               &h)
+    {
+      // all inner products are computed in a single pass through the
+      // vectors, split into chunks that are processed in parallel, and then
+      // summed up in one global reduction
+      const unsigned int n_results =
+        delayed_reorthogonalization ? n + n + 1 : n;
+      std::vector<double> partial_sums;
+      for (unsigned int b = 0; b < n_blocks(vv); ++b)
+        {
+          const unsigned int local_size = block(vv, b).locally_owned_size();
+          const unsigned int n_chunks =
+            (local_size + orthogonalization_chunk_size - 1) /
+            orthogonalization_chunk_size;
+          partial_sums.assign(n_chunks * n_results, 0.);
+
+          dealii::parallel::apply_to_subranges(
+            0U,
+            n_chunks,
+            [&](const unsigned int begin_chunk, const unsigned int end_chunk) {
+              for (unsigned int c = begin_chunk; c < end_chunk; ++c)
+                Tvmult_add_on_subrange<delayed_reorthogonalization>(
+                  n,
+                  vv,
+                  orthogonal_vectors,
+                  b,
+                  c * orthogonalization_chunk_size,
+                  std::min(local_size, (c + 1) * orthogonalization_chunk_size),
+                  partial_sums.data() + c * n_results);
+            },
+            1);
+
+          for (unsigned int c = 0; c < n_chunks; ++c)
+            for (unsigned int i = 0; i < n_results; ++i)
+              h(i) += partial_sums[c * n_results + i];
+        }
 
-      Utilities::MPI::sum(h, block(vv, 0).get_mpi_communicator(), h);
+      Utilities::MPI::sum(h, get_communicator(block(vv, 0)), h);
     }
 
 
@@ -1102,7 +1191,7 @@ namespace internal
     template <bool delayed_reorthogonalization,
               typename VectorType,
               std::enable_if_t<
-                !is_dealii_compatible_distributed_vector<VectorType>::value,
+                !is_dealii_compatible_vector<VectorType>::value,
                 VectorType> * = nullptr>
     double
     subtract_and_norm(const unsigned int            n,
@@ -1147,166 +1236,215 @@ namespace internal
 
 
 
-    template <bool delayed_reorthogonalization,
-              typename VectorType,
-              std::enable_if_t<
-                is_dealii_compatible_distributed_vector<VectorType>::value,
-                VectorType> * = nullptr>
+    // Subtract the projection onto the orthogonal vectors from vv for the
+    // locally owned entries in the range [begin, end) of block b (and
+    // orthonormalize the last orthogonal vector for the delayed
+    // reorthogonalization), returning the contribution of these entries to
+    // the square of the norm of vv
+    template <bool delayed_reorthogonalization, typename VectorType>
     double
-    subtract_and_norm(const unsigned int            n,
-                      const TmpVectors<VectorType> &orthogonal_vectors,
-                      const Vector<double>         &h,
-                      VectorType                   &vv)
+    subtract_and_norm_on_subrange(
+      const unsigned int            n,
+      const TmpVectors<VectorType> &orthogonal_vectors,
+      const Vector<double>         &h,
+      const double                  inverse_norm_previous,
+      const double                  scaling_factor_vv,
+      const unsigned int            b,
+      const unsigned int            begin,
+      const unsigned int            end,
+      VectorType                   &vv)
     {
       static constexpr unsigned int n_lanes = VectorizedArray<double>::size();
 
       double      norm_vv_temp = 0.0;
       VectorType &last_vector =
         const_cast<VectorType &>(orthogonal_vectors[n - 1]);
-      const double inverse_norm_previous =
-        delayed_reorthogonalization ? 1. / h(n + n - 1) : 0.;
-      const double scaling_factor_vv =
-        delayed_reorthogonalization ?
-          (h(n + n) > 0.0 ? inverse_norm_previous / h(n + n) :
-                            inverse_norm_previous / h(n + n - 1)) :
-          0.;
 
-      for (unsigned int b = 0; b < n_blocks(vv); ++b)
-        {
-          VectorizedArray<double> norm_vv_temp_vectorized = 0.0;
+      VectorizedArray<double> norm_vv_temp_vectorized = 0.0;
 
-          constexpr unsigned int inner_batch_size =
-            delayed_reorthogonalization ? 6 : 12;
+      constexpr unsigned int inner_batch_size =
+        delayed_reorthogonalization ? 6 : 12;
 
-          unsigned int j = 0;
-          unsigned int c = 0;
-          for (; c <
-                 block(vv, b).locally_owned_size() / n_lanes / inner_batch_size;
-               ++c, j += n_lanes * inner_batch_size)
+      unsigned int j = begin;
+      for (; j + n_lanes * inner_batch_size <= end;
+           j += n_lanes * inner_batch_size)
+        {
+          VectorizedArray<double> temp[inner_batch_size];
+          VectorizedArray<double> last_vec[inner_batch_size];
+
+          const double last_factor = h(n - 1);
+          for (unsigned int k = 0; k < inner_batch_size; ++k)
             {
-              VectorizedArray<double> temp[inner_batch_size];
-              VectorizedArray<double> last_vec[inner_batch_size];
+              temp[k].load(block(vv, b).begin() + j + k * n_lanes);
+              last_vec[k].load(block(last_vector, b).begin() + j +
+                               k * n_lanes);
+              if (!delayed_reorthogonalization)
+                temp[k] -= last_factor * last_vec[k];
+            }
 
-              const double last_factor = h(n - 1);
+          for (unsigned int i = 0; i < n - 1; ++i)
+            {
+              const double factor = h(i);
+              const double correction_factor =
+                (delayed_reorthogonalization ? h(n + i) : 0.0);
               for (unsigned int k = 0; k < inner_batch_size; ++k)
                 {
-                  temp[k].load(block(vv, b).begin() + j + k * n_lanes);
-                  last_vec[k].load(block(last_vector, b).begin() + j +
-                                   k * n_lanes);
-                  if (!delayed_reorthogonalization)
-                    temp[k] -= last_factor * last_vec[k];
+                  VectorizedArray<double> vec;
+                  vec.load(block(orthogonal_vectors[i], b).begin() + j +
+                           k * n_lanes);
+                  temp[k] -= factor * vec;
+                  if (delayed_reorthogonalization)
+                    last_vec[k] -= correction_factor * vec;
                 }
+            }
 
-              for (unsigned int i = 0; i < n - 1; ++i)
-                {
-                  const double factor = h(i);
-                  const double correction_factor =
-                    (delayed_reorthogonalization ? h(n + i) : 0.0);
-                  for (unsigned int k = 0; k < inner_batch_size; ++k)
-                    {
-                      VectorizedArray<double> vec;
-                      vec.load(block(orthogonal_vectors[i], b).begin() + j +
-                               k * n_lanes);
-                      temp[k] -= factor * vec;
-                      if (delayed_reorthogonalization)
-                        last_vec[k] -= correction_factor * vec;
-                    }
-                }
+          if (delayed_reorthogonalization)
+            for (unsigned int k = 0; k < inner_batch_size; ++k)
+              {
+                last_vec[k] = last_vec[k] * inverse_norm_previous;
+                last_vec[k].store(block(last_vector, b).begin() + j +
+                                  k * n_lanes);
+                temp[k] -= last_factor * last_vec[k];
+                temp[k] = temp[k] * scaling_factor_vv;
+                temp[k].store(block(vv, b).begin() + j + k * n_lanes);
+              }
+          else
+            for (unsigned int k = 0; k < inner_batch_size; ++k)
+              {
+                temp[k].store(block(vv, b).begin() + j + k * n_lanes);
+                norm_vv_temp_vectorized += temp[k] * temp[k];
+              }
+        }
+
+      for (; j + n_lanes <= end; j += n_lanes)
+        {
+          VectorizedArray<double> temp, last_vec;
+          temp.load(block(vv, b).begin() + j);
+          last_vec.load(block(last_vector, b).begin() + j);
+          if (!delayed_reorthogonalization)
+            temp -= h(n - 1) * last_vec;
 
+          for (unsigned int i = 0; i < n - 1; ++i)
+            {
+              VectorizedArray<double> vec;
+              vec.load(block(orthogonal_vectors[i], b).begin() + j);
+              temp -= h(i) * vec;
               if (delayed_reorthogonalization)
-                for (unsigned int k = 0; k < inner_batch_size; ++k)
-                  {
-                    last_vec[k] = last_vec[k] * inverse_norm_previous;
-                    last_vec[k].store(block(last_vector, b).begin() + j +
-                                      k * n_lanes);
-                    temp[k] -= last_factor * last_vec[k];
-                    temp[k] = temp[k] * scaling_factor_vv;
-                    temp[k].store(block(vv, b).begin() + j + k * n_lanes);
-                  }
-              else
-                for (unsigned int k = 0; k < inner_batch_size; ++k)
-                  {
-                    temp[k].store(block(vv, b).begin() + j + k * n_lanes);
-                    norm_vv_temp_vectorized += temp[k] * temp[k];
-                  }
+                last_vec -= h(n + i) * vec;
             }
 
-          c *= inner_batch_size;
-          for (; c < block(vv, b).locally_owned_size() / n_lanes;
-               ++c, j += n_lanes)
+          if (delayed_reorthogonalization)
             {
-              VectorizedArray<double> temp, last_vec;
-              temp.load(block(vv, b).begin() + j);
-              last_vec.load(block(last_vector, b).begin() + j);
-              if (!delayed_reorthogonalization)
-                temp -= h(n - 1) * last_vec;
+              last_vec = last_vec * inverse_norm_previous;
+              last_vec.store(block(last_vector, b).begin() + j);
+              temp -= h(n - 1) * last_vec;
+              temp = temp * scaling_factor_vv;
+              temp.store(block(vv, b).begin() + j);
+            }
+          else
+            {
+              temp.store(block(vv, b).begin() + j);
+              norm_vv_temp_vectorized += temp * temp;
+            }
+        }
+
+      if (!delayed_reorthogonalization)
+        norm_vv_temp += norm_vv_temp_vectorized.sum();
 
+      for (; j < end; ++j)
+        {
+          double temp     = block(vv, b).begin()[j];
+          double last_vec = block(last_vector, b).begin()[j];
+          if (delayed_reorthogonalization)
+            {
               for (unsigned int i = 0; i < n - 1; ++i)
                 {
-                  VectorizedArray<double> vec;
-                  vec.load(block(orthogonal_vectors[i], b).begin() + j);
+                  const double vec = block(orthogonal_vectors[i], b).begin()[j];
                   temp -= h(i) * vec;
-                  if (delayed_reorthogonalization)
-                    last_vec -= h(n + i) * vec;
-                }
-
-              if (delayed_reorthogonalization)
-                {
-                  last_vec = last_vec * inverse_norm_previous;
-                  last_vec.store(block(last_vector, b).begin() + j);
-                  temp -= h(n - 1) * last_vec;
-                  temp = temp * scaling_factor_vv;
-                  temp.store(block(vv, b).begin() + j);
-                }
-              else
-                {
-                  temp.store(block(vv, b).begin() + j);
-                  norm_vv_temp_vectorized += temp * temp;
+                  last_vec -= h(n + i) * vec;
                 }
+              last_vec *= inverse_norm_previous;
+              block(last_vector, b).begin()[j] = last_vec;
+              temp -= h(n - 1) * last_vec;
+              temp *= scaling_factor_vv;
             }
-
-          if (!delayed_reorthogonalization)
-            norm_vv_temp += norm_vv_temp_vectorized.sum();
-
-          for (; j < block(vv, b).locally_owned_size(); ++j)
+          else
             {
-              double temp     = block(vv, b).local_element(j);
-              double last_vec = block(last_vector, b).local_element(j);
-              if (delayed_reorthogonalization)
-                {
-                  for (unsigned int i = 0; i < n - 1; ++i)
-                    {
-                      const double vec =
-                        block(orthogonal_vectors[i], b).local_element(j);
-                      temp -= h(i) * vec;
-                      last_vec -= h(n + i) * vec;
-                    }
-                  last_vec *= inverse_norm_previous;
-                  block(last_vector, b).local_element(j) = last_vec;
-                  temp -= h(n - 1) * last_vec;
-                  temp *= scaling_factor_vv;
-                }
-              else
-                {
-                  temp -= h(n - 1) * last_vec;
-                  for (unsigned int i = 0; i < n - 1; ++i)
-                    temp -=
-                      h(i) * block(orthogonal_vectors[i], b).local_element(j);
-                  norm_vv_temp += temp * temp;
-                }
-              block(vv, b).local_element(j) = temp;
+              temp -= h(n - 1) * last_vec;
+              for (unsigned int i = 0; i < n - 1; ++i)
+                temp -= h(i) * block(orthogonal_vectors[i], b).begin()[j];
+              norm_vv_temp += temp * temp;
             }
+          block(vv, b).begin()[j] = temp;
+        }
+
+      return norm_vv_temp;
+    }
+
+
+
+    template <bool delayed_reorthogonalization,
+              typename VectorType,
+              std::enable_if_t<
+                is_dealii_compatible_vector<VectorType>::value,
+                VectorType> * = nullptr>
+    double
+    subtract_and_norm(const unsigned int            n,
+                      const TmpVectors<VectorType> &orthogonal_vectors,
+                      const Vector<double>         &h,
+                      VectorType                   &vv)
+    {
+      const double inverse_norm_previous =
+        delayed_reorthogonalization ? 1. / h(n + n - 1) : 0.;
+      const double scaling_factor_vv =
+        delayed_reorthogonalization ?
+          (h(n + n) > 0.0 ? inverse_norm_previous / h(n + n) :
+                            inverse_norm_previous / h(n + n - 1)) :
+          0.;
+
+      double              norm_vv_temp = 0.0;
+      std::vector<double> partial_norms;
+      for (unsigned int b = 0; b < n_blocks(vv); ++b)
+        {
+          const unsigned int local_size = block(vv, b).locally_owned_size();
+          const unsigned int n_chunks =
+            (local_size + orthogonalization_chunk_size - 1) /
+            orthogonalization_chunk_size;
+          partial_norms.resize(n_chunks);
+
+          dealii::parallel::apply_to_subranges(
+            0U,
+            n_chunks,
+            [&](const unsigned int begin_chunk, const unsigned int end_chunk) {
+              for (unsigned int c = begin_chunk; c < end_chunk; ++c)
+                partial_norms[c] =
+                  subtract_and_norm_on_subrange<delayed_reorthogonalization>(
+                    n,
+                    orthogonal_vectors,
+                    h,
+                    inverse_norm_previous,
+                    scaling_factor_vv,
+                    b,
+                    c * orthogonalization_chunk_size,
+                    std::min(local_size,
+                             (c + 1) * orthogonalization_chunk_size),
+                    vv);
+            },
+            1);
+
+          for (const double norm : partial_norms)
+            norm_vv_temp += norm;
         }
 
       return std::sqrt(
-        Utilities::MPI::sum(norm_vv_temp, block(vv, 0).get_mpi_communicator()));
+        Utilities::MPI::sum(norm_vv_temp, get_communicator(block(vv, 0))));
     }
 
 
 
     template <typename VectorType,
               std::enable_if_t<
-                !is_dealii_compatible_distributed_vector<VectorType>::value,
+                !is_dealii_compatible_vector<VectorType>::value,
                 VectorType> * = nullptr>
     void
     add(VectorType                   &p,
@@ -1328,7 +1466,7 @@ namespace internal
 
     template <typename VectorType,
               std::enable_if_t<
-                is_dealii_compatible_distributed_vector<VectorType>::value,
+                is_dealii_compatible_vector<VectorType>::value,
                 VectorType> * = nullptr>
     void
     add(VectorType                   &p,
@@ -1337,14 +1475,47 @@ namespace internal
         const TmpVectors<VectorType> &tmp_vectors,
         const bool                    zero_out)
     {
+      static constexpr unsigned int n_lanes = VectorizedArray<double>::size();
+      constexpr unsigned int        inner_batch_size = 12;
+
       for (unsigned int b = 0; b < n_blocks(p); ++b)
-        for (unsigned int j = 0; j < block(p, b).locally_owned_size(); ++j)
-          {
-            double temp = zero_out ? 0 : block(p, b).local_element(j);
-            for (unsigned int i = 0; i < n; ++i)
-              temp += block(tmp_vectors[i], b).local_element(j) * h(i);
-            block(p, b).local_element(j) = temp;
-          }
+        dealii::parallel::apply_to_subranges(
+          0U,
+          block(p, b).locally_owned_size(),
+          [&](const unsigned int begin, const unsigned int end) {
+            unsigned int j = begin;
+            for (; j + n_lanes * inner_batch_size <= end;
+                 j += n_lanes * inner_batch_size)
+              {
+                VectorizedArray<double> temp[inner_batch_size];
+                for (unsigned int k = 0; k < inner_batch_size; ++k)
+                  if (zero_out)
+                    temp[k] = 0.;
+                  else
+                    temp[k].load(block(p, b).begin() + j + k * n_lanes);
+                for (unsigned int i = 0; i < n; ++i)
+                  {
+                    const double factor = h(i);
+                    for (unsigned int k = 0; k < inner_batch_size; ++k)
+                      {
+                        VectorizedArray<double> vec;
+                        vec.load(block(tmp_vectors[i], b).begin() + j +
+                                 k * n_lanes);
+                        temp[k] += vec * factor;
+                      }
+                  }
+                for (unsigned int k = 0; k < inner_batch_size; ++k)
+                  temp[k].store(block(p, b).begin() + j + k * n_lanes);
+              }
+            for (; j < end; ++j)
+              {
+                double temp = zero_out ? 0 : block(p, b).begin()[j];
+                for (unsigned int i = 0; i < n; ++i)
+                  temp += block(tmp_vectors[i], b).begin()[j] * h(i);
+                block(p, b).begin()[j] = temp;
+              }
+          },
+          orthogonalization_chunk_size);
     }
 
 
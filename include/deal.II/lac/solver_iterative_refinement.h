@@ -0,0 +1,244 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_iterative_refinement_h
+#define dealii_solver_iterative_refinement_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * Implementation of mixed-precision iterative refinement, also known as
+ * defect correction. Starting from the initial value of the solution vector
+ * $x_0$, each iteration computes the residual $r_k = b - Ax_k$ in the
+ * precision of @p VectorType, converts it to the (typically lower) precision
+ * of an inner solver, approximately solves $\tilde A d_k = r_k$ with the inner
+ * solver, and updates $x_{k+1} = x_k + d_k$ in the original precision. The
+ * stopping criterion is the norm of the residual $r_k$.
+ *
+ * The typical use case is to store the matrix $\tilde A$ used by the inner
+ * solver in single precision, e.g., as a SparseMatrix<float> copied from the
+ * SparseMatrix<double> $A$. Since sparse matrix-vector products are limited
+ * by the memory bandwidth, the inner iterations with float values and float
+ * vectors are almost twice as fast, while the outer iteration still delivers
+ * a solution with the accuracy of double precision:
+ * @code
+ * SparseMatrix<float> system_matrix_float(sparsity_pattern);
+ * system_matrix_float.copy_from(system_matrix);
+ * PreconditionSSOR<SparseMatrix<float>> preconditioner;
+ * preconditioner.initialize(system_matrix_float);
+ *
+ * ReductionControl        inner_control(1000, 1e-30, 1e-4);
+ * SolverCG<Vector<float>> inner_solver(inner_control);
+ *
+ * SolverControl                             solver_control(100, 1e-12);
+ * SolverIterativeRefinement<Vector<double>> solver(solver_control);
+ * solver.solve(system_matrix,
+ *              solution,
+ *              system_rhs,
+ *              system_matrix_float,
+ *              inner_solver,
+ *              preconditioner);
+ * @endcode
+ *
+ * Before the conversion, the residual is scaled to unit norm such that it
+ * can neither underflow nor overflow in the lower precision, and the
+ * correction is scaled back afterwards. The inner solver is started from a
+ * zero vector in each iteration, so it should be controlled by a relative
+ * tolerance as provided by ReductionControl. If the inner solver does not
+ * reach its tolerance within its maximal number of iterations, the
+ * correction computed so far is used nonetheless.
+ *
+ * For the requirements on matrices and vectors in order to work with this
+ * class, see the documentation of the Solver base class. In addition,
+ * @p VectorType and the vector type of the inner solver need to be
+ * convertible into each other with <code>operator=</code>, as is the case
+ * for Vector, BlockVector and LinearAlgebra::distributed::Vector of
+ * different number types.
+ *
+ * Like all other solver classes, this class has a local structure called @p
+ * AdditionalData which is used to pass additional parameters to the solver.
+ * AdditionalData of this class currently does not contain any data.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ *
+ *
+ * @ingroup Solvers
+ */
+template <typename VectorType = Vector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverIterativeRefinement : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver. There is
+   * no data in here for iterative refinement.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverIterativeRefinement(SolverControl            &cn,
+                            VectorMemory<VectorType> &mem,
+                            const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverIterativeRefinement(SolverControl        &cn,
+                            const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the system $Ax = b$ by iterative refinement, using
+   * @p inner_solver with the matrix @p A_inner and the preconditioner
+   * @p inner_preconditioner to compute the corrections. The vector type of
+   * the inner solve is the <code>vector_type</code> of @p inner_solver.
+   */
+  template <typename MatrixType,
+            typename InnerMatrixType,
+            typename InnerSolverType,
+            typename InnerPreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<InnerMatrixType,
+                                     typename InnerSolverType::vector_type>))
+  void solve(const MatrixType              &A,
+             VectorType                    &x,
+             const VectorType              &b,
+             const InnerMatrixType         &A_inner,
+             InnerSolverType               &inner_solver,
+             const InnerPreconditionerType &inner_preconditioner);
+};
+
+//----------------------------------------------------------------------//
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverIterativeRefinement<VectorType>::SolverIterativeRefinement(
+  SolverControl            &cn,
+  VectorMemory<VectorType> &mem,
+  const AdditionalData &)
+  : SolverBase<VectorType>(cn, mem)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverIterativeRefinement<VectorType>::SolverIterativeRefinement(
+  SolverControl &cn,
+  const AdditionalData &)
+  : SolverBase<VectorType>(cn)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType,
+          typename InnerMatrixType,
+          typename InnerSolverType,
+          typename InnerPreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<InnerMatrixType,
+                                   typename InnerSolverType::vector_type>))
+void SolverIterativeRefinement<VectorType>::solve(
+  const MatrixType              &A,
+  VectorType                    &x,
+  const VectorType              &b,
+  const InnerMatrixType         &A_inner,
+  InnerSolverType               &inner_solver,
+  const InnerPreconditionerType &inner_preconditioner)
+{
+  using InnerVectorType = typename InnerSolverType::vector_type;
+
+  SolverControl::State conv = SolverControl::iterate;
+
+  // Memory allocation
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  VectorType                                &r = *r_pointer;
+  r.reinit(x, true);
+
+  GrowingVectorMemory<InnerVectorType>            inner_memory;
+  typename VectorMemory<InnerVectorType>::Pointer r_inner_pointer(
+    inner_memory);
+  InnerVectorType &r_inner = *r_inner_pointer;
+  typename VectorMemory<InnerVectorType>::Pointer d_inner_pointer(
+    inner_memory);
+  InnerVectorType &d_inner = *d_inner_pointer;
+
+  LogStream::Prefix prefix("IterativeRefinement");
+
+  double       res  = 0.;
+  unsigned int iter = 0;
+  // Main loop
+  for (; conv == SolverControl::iterate; ++iter)
+    {
+      // Compute the residual in the precision of the outer solver
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+
+      res  = r.l2_norm();
+      conv = this->iteration_status(iter, res, x);
+      if (conv != SolverControl::iterate)
+        break;
+
+      // Scale the residual to unit norm to stay within the range of the
+      // lower precision and convert it
+      r *= 1. / res;
+      r_inner = r;
+      d_inner.reinit(r_inner);
+
+      try
+        {
+          inner_solver.solve(A_inner, d_inner, r_inner, inner_preconditioner);
+        }
+      catch (const SolverControl::NoConvergence &)
+        {
+          // use the correction computed so far
+        }
+
+      // Convert the correction back and undo the scaling
+      r = d_inner;
+      x.add(res, r);
+    }
+
+  // in case of failure: throw exception
+  AssertThrow(conv == SolverControl::success,
+              SolverControl::NoConvergence(iter, res));
+  // otherwise exit as normal
+}
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
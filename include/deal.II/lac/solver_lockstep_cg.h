@@ -0,0 +1,354 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_lockstep_cg_h
+#define dealii_solver_lockstep_cg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector_operations_internal.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// forward declaration
+#ifndef DOXYGEN
+class PreconditionIdentity;
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  }
+} // namespace LinearAlgebra
+#endif
+
+/**
+ * This class solves several linear systems $Ax_i=b_i$ with the same
+ * symmetric positive definite matrix $A$ and different right hand sides
+ * $b_i$ by the preconditioned conjugate gradient method, advancing all
+ * systems in lockstep. The right hand sides and solutions are stored as the
+ * blocks of a block vector, such as BlockVector or
+ * LinearAlgebra::distributed::BlockVector, with one block per system.
+ *
+ * Each block runs its own conjugate gradient iteration with its own step
+ * lengths, so that the iterates are the same as the ones of SolverCG applied
+ * to the systems one after the other. The benefit is that the matrix and the
+ * preconditioner are applied to all blocks at once: Their
+ * <code>vmult(BlockVectorType &, const BlockVectorType &)</code> function
+ * receives the block vector and is expected to apply the operator to each of
+ * the blocks. For sparse matrices, this is only a convenience. For
+ * matrix-free operators, however, the operator can be evaluated for all
+ * right hand sides in a single pass over the mesh: An FEEvaluation object
+ * with @p n_components equal to the number of right hand sides, built on a
+ * scalar finite element, reads the blocks <code>first_index</code> to
+ * <code>first_index+n_components-1</code> of a block vector as its
+ * components in FEEvaluation::read_dof_values(), so that the index data and
+ * the geometry data of each cell batch are loaded once for all right hand
+ * sides. Furthermore, the inner products of all blocks are computed with a
+ * single global reduction for LinearAlgebra::distributed::Vector blocks,
+ * rather than with one reduction per block.
+ *
+ * As the stopping criterion, the maximum over the blocks of the $l_2$ norm of
+ * the residual is passed to the SolverControl object, i.e., the iteration
+ * stops when all systems have converged. Systems that have converged earlier
+ * continue to be iterated on, which improves their accuracy further. If the
+ * residual of a system vanishes exactly, its iteration is frozen.
+ *
+ * Like all other solver classes, this class has a local structure called @p
+ * AdditionalData which is used to pass additional parameters to the solver.
+ * AdditionalData of this class currently does not contain any data.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ *
+ *
+ * @ingroup Solvers
+ */
+template <typename BlockVectorType = BlockVector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+class SolverLockstepCG : public SolverBase<BlockVectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver. There is
+   * no data in here for this solver.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverLockstepCG(SolverControl                 &cn,
+                   VectorMemory<BlockVectorType> &mem,
+                   const AdditionalData          &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverLockstepCG(SolverControl        &cn,
+                   const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear systems $Ax_i=b_i$ for all blocks $x_i$ of @p x and $b_i$
+   * of @p b.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, BlockVectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, BlockVectorType>))
+  void solve(const MatrixType         &A,
+             BlockVectorType          &x,
+             const BlockVectorType    &b,
+             const PreconditionerType &preconditioner);
+};
+
+//----------------------------------------------------------------------//
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverLockstepCGImplementation
+  {
+    // Compute the inner products u.block(i) * v.block(i) of all blocks i and
+    // all pairs (u,v) given in the argument, and store them in
+    // results[pair * n_blocks + i]. For blocks of type
+    // LinearAlgebra::distributed::Vector, the local parts are computed with
+    // the threaded and vectorized reduction kernels of the vector classes,
+    // and all results are summed up over the processes in a single
+    // reduction.
+    template <typename BlockVectorType>
+    void
+    block_inner_products(
+      const std::vector<
+        std::pair<const BlockVectorType *, const BlockVectorType *>> &pairs,
+      std::vector<typename BlockVectorType::value_type>              &results)
+    {
+      using Number    = typename BlockVectorType::value_type;
+      using BlockType = typename BlockVectorType::BlockType;
+
+      Assert(pairs.size() > 0, ExcInternalError());
+      const unsigned int n_blocks = pairs[0].first->n_blocks();
+      results.resize(pairs.size() * n_blocks);
+
+      if constexpr (std::is_same_v<BlockType,
+                                   LinearAlgebra::distributed::
+                                     Vector<Number, MemorySpace::Host>>)
+        {
+          const auto thread_loop_partitioner =
+            std::make_shared<parallel::internal::TBBPartitioner>();
+          for (unsigned int p = 0; p < pairs.size(); ++p)
+            for (unsigned int i = 0; i < n_blocks; ++i)
+              {
+                const BlockType &u = pairs[p].first->block(i);
+                const BlockType &v = pairs[p].second->block(i);
+                AssertDimension(u.locally_owned_size(),
+                                v.locally_owned_size());
+                dealii::internal::VectorOperations::Dot<Number, Number> dot(
+                  u.begin(), v.begin());
+
+                Number sum;
+                dealii::internal::VectorOperations::parallel_reduce(
+                  dot, 0, u.locally_owned_size(), sum, thread_loop_partitioner);
+                results[p * n_blocks + i] = sum;
+              }
+          Utilities::MPI::sum(results,
+                              pairs[0].first->block(0).get_mpi_communicator(),
+                              results);
+        }
+      else
+        {
+          for (unsigned int p = 0; p < pairs.size(); ++p)
+            for (unsigned int i = 0; i < n_blocks; ++i)
+              results[p * n_blocks + i] =
+                pairs[p].first->block(i) * pairs[p].second->block(i);
+        }
+    }
+  } // namespace SolverLockstepCGImplementation
+} // namespace internal
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+SolverLockstepCG<BlockVectorType>::SolverLockstepCG(
+  SolverControl                 &cn,
+  VectorMemory<BlockVectorType> &mem,
+  const AdditionalData &)
+  : SolverBase<BlockVectorType>(cn, mem)
+{}
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+SolverLockstepCG<BlockVectorType>::SolverLockstepCG(SolverControl &cn,
+                                                    const AdditionalData &)
+  : SolverBase<BlockVectorType>(cn)
+{}
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, BlockVectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, BlockVectorType>))
+void SolverLockstepCG<BlockVectorType>::solve(
+  const MatrixType         &A,
+  BlockVectorType          &x,
+  const BlockVectorType    &b,
+  const PreconditionerType &preconditioner)
+{
+  using Number = typename BlockVectorType::value_type;
+
+  constexpr bool use_preconditioner =
+    !std::is_same_v<PreconditionerType, PreconditionIdentity>;
+
+  SolverControl::State conv = SolverControl::iterate;
+
+  LogStream::Prefix prefix("LockstepCG");
+
+  // Memory allocation
+  typename VectorMemory<BlockVectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer v_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer z_pointer(this->memory);
+
+  BlockVectorType &r = *r_pointer;
+  BlockVectorType &p = *p_pointer;
+  BlockVectorType &v = *v_pointer;
+  BlockVectorType &z = *z_pointer;
+
+  r.reinit(x, true);
+  p.reinit(x, true);
+  v.reinit(x, true);
+  if (use_preconditioner)
+    z.reinit(x, true);
+
+  const unsigned int n_blocks = x.n_blocks();
+  AssertDimension(b.n_blocks(), n_blocks);
+
+  // compute residual. if vector is zero, then short-circuit the full
+  // computation
+  if (!x.all_zero())
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+    }
+  else
+    r.equ(1., b);
+
+  const BlockVectorType &preconditioned_r = use_preconditioner ? z : r;
+  if (use_preconditioner)
+    preconditioner.vmult(z, r);
+  p = preconditioned_r;
+
+  // r * z and r * r of all blocks
+  std::vector<Number> sums;
+  internal::SolverLockstepCGImplementation::block_inner_products<
+    BlockVectorType>({{&r, &preconditioned_r}, {&r, &r}}, sums);
+
+  std::vector<Number> r_dot_z(sums.begin(), sums.begin() + n_blocks);
+  std::vector<Number> p_dot_A_dot_p;
+
+  const auto compute_residual = [&]() {
+    double max_norm = 0.;
+    for (unsigned int i = 0; i < n_blocks; ++i)
+      // Round-off errors near zero might yield negative values, so take the
+      // absolute value
+      max_norm = std::max<double>(max_norm,
+                                  std::sqrt(std::abs(sums[n_blocks + i])));
+    return max_norm;
+  };
+
+  double       residual_norm = compute_residual();
+  unsigned int iter          = 0;
+  conv = this->iteration_status(iter, residual_norm, x);
+
+  while (conv == SolverControl::iterate)
+    {
+      ++iter;
+
+      A.vmult(v, p);
+      internal::SolverLockstepCGImplementation::block_inner_products<
+        BlockVectorType>({{&p, &v}}, p_dot_A_dot_p);
+
+      for (unsigned int i = 0; i < n_blocks; ++i)
+        {
+          // freeze the iteration of systems that are solved exactly
+          const Number alpha = p_dot_A_dot_p[i] != Number() ?
+                                 r_dot_z[i] / p_dot_A_dot_p[i] :
+                                 Number();
+          x.block(i).add(alpha, p.block(i));
+          r.block(i).add(-alpha, v.block(i));
+        }
+
+      if (use_preconditioner)
+        preconditioner.vmult(z, r);
+
+      internal::SolverLockstepCGImplementation::block_inner_products<
+        BlockVectorType>({{&r, &preconditioned_r}, {&r, &r}}, sums);
+
+      residual_norm = compute_residual();
+      conv          = this->iteration_status(iter, residual_norm, x);
+      if (conv != SolverControl::iterate)
+        break;
+
+      for (unsigned int i = 0; i < n_blocks; ++i)
+        {
+          const Number beta =
+            r_dot_z[i] != Number() ? sums[i] / r_dot_z[i] : Number();
+          r_dot_z[i] = sums[i];
+          p.block(i).sadd(beta, 1., preconditioned_r.block(i));
+        }
+    }
+
+  // in case of failure: throw exception
+  AssertThrow(conv == SolverControl::success,
+              SolverControl::NoConvergence(iter, residual_norm));
+  // otherwise exit as normal
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
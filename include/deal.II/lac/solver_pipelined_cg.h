@@ -0,0 +1,597 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_pipelined_cg_h
+#define dealii_solver_pipelined_cg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// forward declaration
+#ifndef DOXYGEN
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  }
+} // namespace LinearAlgebra
+#endif
+
+
+/**
+ * This class implements the pipelined variant of the preconditioned
+ * conjugate gradient method by P. Ghysels and W. Vanroose, "Hiding global
+ * synchronization latency in the preconditioned Conjugate Gradient
+ * algorithm", Parallel Computing 40 (2014), pp. 224-238.
+ *
+ * The classical conjugate gradient method as implemented in SolverCG needs
+ * the result of a global reduction (an MPI_Allreduce) before it can continue
+ * with the next matrix-vector product, so that all processes wait for the
+ * slowest one and for the network latency twice per iteration. The pipelined
+ * variant computes all inner products of an iteration in a single reduction
+ * and reformulates the recurrences by introducing the auxiliary vectors $w =
+ * Au$, $m = Pw$, $n = Am$ (with $u = Pr$ the preconditioned residual and $P$
+ * the preconditioner), such that the reduction is independent of the
+ * application of the preconditioner and the matrix in the same iteration.
+ * For LinearAlgebra::distributed::Vector, the reduction is started as a
+ * non-blocking MPI_Iallreduce before the preconditioner and the
+ * matrix-vector product are applied and it is only completed afterwards,
+ * which hides the latency of the reduction behind the local work. In
+ * addition, all vector updates of an iteration and the local contributions
+ * to the inner products are performed in a single sweep through the vectors.
+ * For other vector types, the inner products are computed with the blocking
+ * functions of the vector class.
+ *
+ * If the matrix provides the variant of vmult() with functions to be run
+ * before and after the matrix-vector product on ranges of the vector entries,
+ * and the preconditioner the function apply() or apply_to_subrange(), as
+ * described in the documentation of SolverCG, the application of the
+ * preconditioner is run on each range of entries just before the
+ * matrix-vector product accesses them. This saves one sweep through the
+ * vectors per iteration. Unlike in SolverCG, the vector updates and the
+ * local parts of the inner products cannot be moved into the matrix-vector
+ * product, since they need the result of the reduction that is overlapped
+ * with the product.
+ *
+ * The price for this is one additional matrix-vector product and
+ * preconditioner application at the start of the iteration, the storage of
+ * eight instead of four auxiliary vectors, and a somewhat reduced numerical
+ * stability: Since the residual is updated by a longer recurrence, the
+ * attainable accuracy is typically a few orders of magnitude worse than with
+ * SolverCG, and the computed residual may deviate from the true residual
+ * $b-Ax$ for very strict tolerances. Furthermore, the convergence check
+ * refers to the residual of the previous iteration, so that the solver
+ * performs one more matrix-vector product than SolverCG for the same number
+ * of iterations. The method pays off when the latency of global reductions
+ * dominates the run time, i.e., for a large number of MPI processes and
+ * moderate problem sizes per process.
+ *
+ * As the stopping criterion, the $l_2$ norm of the residual computed by the
+ * recurrence is used, like in SolverCG. The method requires a symmetric
+ * positive definite matrix and preconditioner.
+ *
+ * Like all other solver classes, this class has a local structure called @p
+ * AdditionalData which is used to pass additional parameters to the solver.
+ * AdditionalData of this class currently does not contain any data.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ *
+ *
+ * @ingroup Solvers
+ */
+template <typename VectorType = Vector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver. There is
+   * no data in here for the pipelined conjugate gradient method.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverPipelinedCG(SolverControl            &cn,
+                    VectorMemory<VectorType> &mem,
+                    const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverPipelinedCG(SolverControl        &cn,
+                    const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+};
+
+//----------------------------------------------------------------------//
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverPipelinedCGImplementation
+  {
+    // Compute tmp = P*src and dst = A*tmp. If the matrix supports functions
+    // to be run on ranges of the vector entries before the matrix-vector
+    // product and the preconditioner can be applied to ranges of entries, the
+    // preconditioner is applied within the matrix-vector product, otherwise
+    // the two operations are run one after the other.
+    template <typename VectorType,
+              typename MatrixType,
+              typename PreconditionerType>
+    void
+    apply_preconditioner_and_matrix(const MatrixType         &A,
+                                    const PreconditionerType &preconditioner,
+                                    const VectorType         &src,
+                                    VectorType               &tmp,
+                                    VectorType               &dst)
+    {
+      using Number = typename VectorType::value_type;
+
+      if constexpr (internal::SolverCG::
+                      has_vmult_functions<MatrixType, VectorType> &&
+                    (internal::SolverCG::has_apply<PreconditionerType> ||
+                     internal::SolverCG::has_apply_to_subrange<
+                       PreconditionerType>)&&std::
+                      is_same_v<VectorType,
+                                LinearAlgebra::distributed::
+                                  Vector<Number, MemorySpace::Host>>)
+        {
+          A.vmult(
+            dst,
+            tmp,
+            [&](const unsigned int begin, const unsigned int end) {
+              const Number *src_ptr = src.begin();
+              Number       *tmp_ptr = tmp.begin();
+              if constexpr (internal::SolverCG::has_apply<PreconditionerType>)
+                {
+                  DEAL_II_OPENMP_SIMD_PRAGMA
+                  for (unsigned int j = begin; j < end; ++j)
+                    tmp_ptr[j] = preconditioner.apply(j, src_ptr[j]);
+                }
+              else
+                preconditioner.apply_to_subrange(begin,
+                                                 end,
+                                                 src_ptr + begin,
+                                                 tmp_ptr + begin);
+              // the matrix-vector product adds into the destination vector
+              std::fill(dst.begin() + begin, dst.begin() + end, Number());
+            },
+            [](const unsigned int, const unsigned int) {});
+        }
+      else
+        {
+          preconditioner.vmult(tmp, src);
+          A.vmult(dst, tmp);
+        }
+    }
+
+
+
+    // The global reduction of the three inner products (r,u), (w,u), and
+    // (r,r) needed in each iteration of the pipelined conjugate gradient
+    // method, together with the vector updates that precede it. This is the
+    // implementation for general vectors that uses the blocking inner
+    // products of the vector class.
+    template <typename VectorType, typename = int>
+    struct Reduction
+    {
+      using Number = typename VectorType::value_type;
+
+      std::array<Number, 3> values;
+
+      void
+      start(const VectorType &r, const VectorType &u, const VectorType &w)
+      {
+        values[0] = r * u;
+        values[1] = w * u;
+        values[2] = r * r;
+      }
+
+      void
+      update_and_start(const Number      alpha,
+                       const Number      beta,
+                       const VectorType &m,
+                       const VectorType &n,
+                       VectorType       &p,
+                       VectorType       &q,
+                       VectorType       &s,
+                       VectorType       &z,
+                       VectorType       &x,
+                       VectorType       &r,
+                       VectorType       &u,
+                       VectorType       &w)
+      {
+        z.sadd(beta, 1., n);
+        q.sadd(beta, 1., m);
+        s.sadd(beta, 1., w);
+        p.sadd(beta, 1., u);
+        x.add(alpha, p);
+        r.add(-alpha, s);
+        u.add(-alpha, q);
+        w.add(-alpha, z);
+        start(r, u, w);
+      }
+
+      void
+      finish()
+      {}
+    };
+
+
+
+    // Specialization for LinearAlgebra::distributed::Vector on the host: The
+    // vector updates and the local parts of the inner products are fused
+    // into a single loop, and the global sum is done with a non-blocking
+    // MPI_Iallreduce that is only completed by finish().
+    template <typename Number>
+    struct Reduction<
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>,
+      int>
+    {
+      using VectorType =
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>;
+
+      // Number of vector entries that are processed by one task. The local
+      // sums are computed per chunk and added in a fixed order to make the
+      // result independent of the number of threads
+      static constexpr unsigned int chunk_size = 4096;
+
+      std::array<Number, 3>              values;
+      std::vector<std::array<Number, 3>> chunk_sums;
+#  ifdef DEAL_II_WITH_MPI
+      MPI_Request request = MPI_REQUEST_NULL;
+#  endif
+
+      // Complete a reduction that is still in flight, e.g., when an
+      // exception leaves the solver loop, since MPI writes into the values
+      // until then. Errors are ignored, as a destructor must not throw.
+      ~Reduction()
+      {
+#  ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          MPI_Wait(&request, MPI_STATUS_IGNORE);
+#  endif
+      }
+
+      void
+      start(const VectorType &r, const VectorType &u, const VectorType &w)
+      {
+        compute_sums_and_start<false>(Number(),
+                                      Number(),
+                                      nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      r.begin(),
+                                      u.begin(),
+                                      w.begin(),
+                                      r);
+      }
+
+      void
+      update_and_start(const Number      alpha,
+                       const Number      beta,
+                       const VectorType &m,
+                       const VectorType &n,
+                       VectorType       &p,
+                       VectorType       &q,
+                       VectorType       &s,
+                       VectorType       &z,
+                       VectorType       &x,
+                       VectorType       &r,
+                       VectorType       &u,
+                       VectorType       &w)
+      {
+        compute_sums_and_start<true>(alpha,
+                                     beta,
+                                     m.begin(),
+                                     n.begin(),
+                                     p.begin(),
+                                     q.begin(),
+                                     s.begin(),
+                                     z.begin(),
+                                     x.begin(),
+                                     r.begin(),
+                                     u.begin(),
+                                     w.begin(),
+                                     r);
+      }
+
+      // Run through the locally owned vector entries, apply the updates of
+      // the search directions, the solution, and the residual vectors if
+      // requested, and start the global reduction of the inner products of
+      // the updated vectors
+      template <bool do_update>
+      void
+      compute_sums_and_start(
+        const Number                                            alpha,
+        const Number                                            beta,
+        const Number                                           *m,
+        const Number                                           *n,
+        Number                                                 *p,
+        Number                                                 *q,
+        Number                                                 *s,
+        Number                                                 *z,
+        Number                                                 *x,
+        std::conditional_t<do_update, Number *, const Number *> r,
+        std::conditional_t<do_update, Number *, const Number *> u,
+        std::conditional_t<do_update, Number *, const Number *> w,
+        const VectorType                                       &layout)
+      {
+        const unsigned int local_size = layout.locally_owned_size();
+        const unsigned int n_chunks =
+          (local_size + chunk_size - 1) / chunk_size;
+        chunk_sums.resize(n_chunks);
+
+        dealii::parallel::apply_to_subranges(
+          0U,
+          n_chunks,
+          [&](const unsigned int begin_chunk, const unsigned int end_chunk) {
+            for (unsigned int c = begin_chunk; c < end_chunk; ++c)
+              {
+                const unsigned int end =
+                  std::min(local_size, (c + 1) * chunk_size);
+                std::array<Number, 3> sums = {};
+                for (unsigned int j = c * chunk_size; j < end; ++j)
+                  {
+                    if constexpr (do_update)
+                      {
+                        z[j] = n[j] + beta * z[j];
+                        q[j] = m[j] + beta * q[j];
+                        s[j] = w[j] + beta * s[j];
+                        p[j] = u[j] + beta * p[j];
+                        x[j] += alpha * p[j];
+                        r[j] -= alpha * s[j];
+                        u[j] -= alpha * q[j];
+                        w[j] -= alpha * z[j];
+                      }
+                    const Number u_conj =
+                      numbers::NumberTraits<Number>::conjugate(u[j]);
+                    sums[0] += r[j] * u_conj;
+                    sums[1] += w[j] * u_conj;
+                    sums[2] +=
+                      r[j] * numbers::NumberTraits<Number>::conjugate(r[j]);
+                  }
+                chunk_sums[c] = sums;
+              }
+          },
+          1);
+
+        values = {};
+        for (const auto &sums : chunk_sums)
+          for (unsigned int i = 0; i < 3; ++i)
+            values[i] += sums[i];
+
+#  ifdef DEAL_II_WITH_MPI
+        const MPI_Comm communicator = layout.get_mpi_communicator();
+        if (Utilities::MPI::job_supports_mpi() &&
+            Utilities::MPI::n_mpi_processes(communicator) > 1)
+          {
+            const int ierr =
+              MPI_Iallreduce(MPI_IN_PLACE,
+                             values.data(),
+                             3,
+                             Utilities::MPI::mpi_type_id_for_type<Number>,
+                             MPI_SUM,
+                             communicator,
+                             &request);
+            AssertThrowMPI(ierr);
+          }
+#  else
+        (void)layout;
+#  endif
+      }
+
+      void
+      finish()
+      {
+#  ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
+#  endif
+      }
+    };
+  } // namespace SolverPipelinedCGImplementation
+} // namespace internal
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl            &cn,
+                                                 VectorMemory<VectorType> &mem,
+                                                 const AdditionalData &)
+  : SolverBase<VectorType>(cn, mem)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl &cn,
+                                                 const AdditionalData &)
+  : SolverBase<VectorType>(cn)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverPipelinedCG<VectorType>::solve(
+  const MatrixType         &A,
+  VectorType               &x,
+  const VectorType         &b,
+  const PreconditionerType &preconditioner)
+{
+  using Number = typename VectorType::value_type;
+
+  SolverControl::State conv = SolverControl::iterate;
+
+  LogStream::Prefix prefix("pipecg");
+
+  // Memory allocation
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer u_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer w_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer m_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer n_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer q_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer s_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer z_pointer(this->memory);
+
+  VectorType &r = *r_pointer;
+  VectorType &u = *u_pointer;
+  VectorType &w = *w_pointer;
+  VectorType &m = *m_pointer;
+  VectorType &n = *n_pointer;
+  VectorType &p = *p_pointer;
+  VectorType &q = *q_pointer;
+  VectorType &s = *s_pointer;
+  VectorType &z = *z_pointer;
+
+  r.reinit(x, true);
+  u.reinit(x, true);
+  w.reinit(x, true);
+  m.reinit(x, true);
+  n.reinit(x, true);
+  // the search directions are initialized to zero since the first update
+  // uses them with beta = 0
+  p.reinit(x);
+  q.reinit(x);
+  s.reinit(x);
+  z.reinit(x);
+
+  // compute residual. if vector is zero, then short-circuit the full
+  // computation
+  if (!x.all_zero())
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+    }
+  else
+    r.equ(1., b);
+
+  internal::SolverPipelinedCGImplementation::apply_preconditioner_and_matrix(
+    A, preconditioner, r, u, w);
+
+  internal::SolverPipelinedCGImplementation::Reduction<VectorType> reduction;
+  reduction.start(r, u, w);
+
+  Number       gamma = Number(), previous_gamma = Number();
+  Number       alpha = Number(), beta = Number();
+  double       residual_norm = 0.;
+  unsigned int iter          = 0;
+  while (true)
+    {
+      // overlap the global reduction with the application of the
+      // preconditioner and the matrix
+      internal::SolverPipelinedCGImplementation::
+        apply_preconditioner_and_matrix(A, preconditioner, w, m, n);
+      reduction.finish();
+
+      // Round-off errors near zero might yield negative values, so take the
+      // absolute value
+      residual_norm = std::sqrt(std::abs(reduction.values[2]));
+      conv          = this->iteration_status(iter, residual_norm, x);
+      if (conv != SolverControl::iterate)
+        break;
+
+      previous_gamma     = gamma;
+      gamma              = reduction.values[0];
+      const Number delta = reduction.values[1];
+      if (iter == 0)
+        {
+          beta = Number();
+          Assert(std::abs(delta) != 0., ExcDivideByZero());
+          alpha = gamma / delta;
+        }
+      else
+        {
+          Assert(std::abs(previous_gamma) != 0., ExcDivideByZero());
+          beta = gamma / previous_gamma;
+          const Number denominator = delta - beta * gamma / alpha;
+          Assert(std::abs(denominator) != 0., ExcDivideByZero());
+          alpha = gamma / denominator;
+        }
+
+      reduction.update_and_start(alpha, beta, m, n, p, q, s, z, x, r, u, w);
+      ++iter;
+    }
+
+  // in case of failure: throw exception
+  AssertThrow(conv == SolverControl::success,
+              SolverControl::NoConvergence(iter, residual_norm));
+  // otherwise exit as normal
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
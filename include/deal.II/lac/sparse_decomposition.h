@@ -17,6 +17,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/lac/sparse_level_schedule.h>
 #include <deal.II/lac/sparse_matrix.h>
 
 #include <cmath>
@@ -146,7 +147,8 @@ public:
     explicit AdditionalData(const double       strengthen_diagonal   = 0.,
                             const unsigned int extra_off_diagonals   = 0,
                             const bool         use_previous_sparsity = false,
-                            const SparsityPattern *use_this_sparsity = nullptr);
+                            const SparsityPattern *use_this_sparsity = nullptr,
+                            const bool use_level_scheduling = false);
 
     /**
      * <code>strengthen_diag</code> times the sum of absolute row entries is
@@ -189,6 +191,17 @@ public:
      * matrix.
      */
     const SparsityPattern *use_this_sparsity;
+
+    /**
+     * If this flag is true, the initialize() function computes a
+     * SparseLevelSchedule of the sparsity pattern of the decomposition, and
+     * the forward and backward substitutions in SparseILU::vmult() are run
+     * level by level on multiple threads. The result is the same as with the
+     * sequential substitutions. For small matrices, or when the levels
+     * become too small to be worth the synchronization among threads, the
+     * sequential code is used regardless of this flag.
+     */
+    bool use_level_scheduling;
   };
 
   /**
@@ -317,6 +330,13 @@ protected:
    */
   std::vector<const size_type *> prebuilt_lower_bound;
 
+  /**
+   * The level schedule for threaded forward and backward substitutions,
+   * computed by initialize() if requested by
+   * AdditionalData::use_level_scheduling. Empty otherwise.
+   */
+  SparseLevelSchedule level_schedule;
+
   /**
    * Fills the #prebuilt_lower_bound array.
    */
@@ -415,11 +435,13 @@ SparseLUDecomposition<number>::AdditionalData::AdditionalData(
   const double           strengthen_diag,
   const unsigned int     extra_off_diag,
   const bool             use_prev_sparsity,
-  const SparsityPattern *use_this_spars)
+  const SparsityPattern *use_this_spars,
+  const bool             use_level_sched)
   : strengthen_diagonal(strengthen_diag)
   , extra_off_diagonals(extra_off_diag)
   , use_previous_sparsity(use_prev_sparsity)
   , use_this_sparsity(use_this_spars)
+  , use_level_scheduling(use_level_sched)
 {}
 
 
@@ -55,6 +55,7 @@ SparseLUDecomposition<number>::clear()
 {
   std::vector<const size_type *> tmp;
   tmp.swap(prebuilt_lower_bound);
+  level_schedule.clear();
 
   SparseMatrix<number>::clear();
 
@@ -120,6 +121,8 @@ SparseLUDecomposition<number>::initialize(
                                            2 * data.extra_off_diagonals,
                                          data.extra_off_diagonals);
       own_sparsity->compress();
+      if (matrix_sparsity.has_relative_column_indices())
+        own_sparsity->compute_relative_column_indices();
       sparsity_pattern_to_use = own_sparsity;
     }
 
@@ -133,6 +136,11 @@ SparseLUDecomposition<number>::initialize(
     tmp.swap(prebuilt_lower_bound);
   }
   SparseMatrix<number>::reinit(*sparsity_pattern_to_use);
+
+  if (data.use_level_scheduling)
+    level_schedule.initialize(*sparsity_pattern_to_use);
+  else
+    level_schedule.clear();
 }
 
 
@@ -238,7 +246,8 @@ std::size_t
 SparseLUDecomposition<number>::memory_consumption() const
 {
   return (SparseMatrix<number>::memory_consumption() +
-          MemoryConsumption::memory_consumption(prebuilt_lower_bound));
+          MemoryConsumption::memory_consumption(prebuilt_lower_bound) +
+          level_schedule.memory_consumption());
 }
 
 
@@ -104,7 +104,9 @@ public:
    * Apply the incomplete decomposition, i.e. do one forward-backward step
    * $dst=(LU)^{-1}src$.
    *
-   * The initialize() function needs to be called before.
+   * The initialize() function needs to be called before. If
+   * AdditionalData::use_level_scheduling was set there, the forward and
+   * backward substitutions run on multiple threads.
    */
   template <typename somenumber>
   void
@@ -147,6 +147,11 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
     this->get_sparsity_pattern().rowstart.get();
   const size_type *const column_numbers =
     this->get_sparsity_pattern().colnums.get();
+  // if the sparsity pattern provides relative column indices, read these
+  // 32-bit numbers instead of the full column indices
+  const std::int32_t *const relative_column_numbers =
+    this->get_sparsity_pattern().relative_colnums.get();
+  const number *const luval = this->SparseMatrix<number>::val.get();
 
   // solve LUx=b in two steps:
   // first Ly = b, then
@@ -161,25 +166,24 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
   // perform it at the outset of the
   // loop
   dst = src;
-  for (size_type row = 0; row < N; ++row)
-    {
-      // get start of this row. skip the
-      // diagonal element
-      const size_type *const rowstart =
-        &column_numbers[rowstart_indices[row] + 1];
-      // find the position where the part
-      // right of the diagonal starts
-      const size_type *const first_after_diagonal =
-        this->prebuilt_lower_bound[row];
-
-      somenumber    dst_row = dst(row);
-      const number *luval =
-        this->SparseMatrix<number>::val.get() + (rowstart - column_numbers);
-      for (const size_type *col = rowstart; col != first_after_diagonal;
-           ++col, ++luval)
-        dst_row -= *luval * dst(*col);
-      dst(row) = dst_row;
-    }
+  const auto forward_row = [&](const size_type row) {
+    // get start of this row. skip the
+    // diagonal element
+    const std::size_t first = rowstart_indices[row] + 1;
+    // find the position where the part
+    // right of the diagonal starts
+    const std::size_t first_after_diagonal =
+      this->prebuilt_lower_bound[row] - column_numbers;
+
+    somenumber dst_row = dst(row);
+    if (relative_column_numbers != nullptr)
+      for (std::size_t j = first; j < first_after_diagonal; ++j)
+        dst_row -= luval[j] * dst(row + relative_column_numbers[j]);
+    else
+      for (std::size_t j = first; j < first_after_diagonal; ++j)
+        dst_row -= luval[j] * dst(column_numbers[j]);
+    dst(row) = dst_row;
+  };
 
   // now the backward solve. same
   // procedure, but we need not set
@@ -189,27 +193,42 @@ SparseILU<number>::vmult(Vector<somenumber>       &dst,
   // note that we need to scale now,
   // since the diagonal is not equal to
   // one now
-  for (int row = N - 1; row >= 0; --row)
+  const auto backward_row = [&](const size_type row) {
+    // get end of this row
+    const std::size_t end = rowstart_indices[row + 1];
+    // find the position where the part
+    // right of the diagonal starts
+    const std::size_t first_after_diagonal =
+      this->prebuilt_lower_bound[row] - column_numbers;
+
+    somenumber dst_row = dst(row);
+    if (relative_column_numbers != nullptr)
+      for (std::size_t j = first_after_diagonal; j < end; ++j)
+        dst_row -= luval[j] * dst(row + relative_column_numbers[j]);
+    else
+      for (std::size_t j = first_after_diagonal; j < end; ++j)
+        dst_row -= luval[j] * dst(column_numbers[j]);
+
+    // scale by the diagonal element.
+    // note that the diagonal element
+    // was stored inverted
+    dst(row) = dst_row * this->diag_element(row);
+  };
+
+  // if a level schedule was set up in initialize(), all rows of a level can
+  // be processed concurrently. the operations per row are the same as in the
+  // sequential loops
+  if (this->level_schedule.empty())
     {
-      // get end of this row
-      const size_type *const rowend =
-        &column_numbers[rowstart_indices[row + 1]];
-      // find the position where the part
-      // right of the diagonal starts
-      const size_type *const first_after_diagonal =
-        this->prebuilt_lower_bound[row];
-
-      somenumber    dst_row = dst(row);
-      const number *luval   = this->SparseMatrix<number>::val.get() +
-                            (first_after_diagonal - column_numbers);
-      for (const size_type *col = first_after_diagonal; col != rowend;
-           ++col, ++luval)
-        dst_row -= *luval * dst(*col);
-
-      // scale by the diagonal element.
-      // note that the diagonal element
-      // was stored inverted
-      dst(row) = dst_row * this->diag_element(row);
+      for (size_type row = 0; row < N; ++row)
+        forward_row(row);
+      for (size_type row = N; row > 0;)
+        backward_row(--row);
+    }
+  else
+    {
+      this->level_schedule.apply_forward(forward_row);
+      this->level_schedule.apply_backward(backward_row);
     }
 }
 
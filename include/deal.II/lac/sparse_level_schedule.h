@@ -0,0 +1,285 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_level_schedule_h
+#define dealii_sparse_level_schedule_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/types.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// forward declarations
+#ifndef DOXYGEN
+class SparsityPattern;
+#endif
+
+/**
+ * @addtogroup Sparsity
+ * @{
+ */
+
+/**
+ * A level schedule for the forward and backward substitutions with the lower
+ * and upper triangular parts of a square sparse matrix, as they appear in
+ * the application of SparseILU, PreconditionSOR or PreconditionSSOR.
+ *
+ * In a forward substitution, the unknown of row $i$ can be computed as soon
+ * as all unknowns $j<i$ with a nonzero entry $a_{ij}$ are known. Grouping
+ * the rows by the length of their longest chain of such dependencies gives
+ * a sequence of levels: all rows within a level only depend on rows of
+ * earlier levels and can therefore be processed concurrently. The same
+ * applies to the backward substitution with the dependencies $j>i$. This
+ * class computes both sets of levels from a SparsityPattern and provides
+ * the functions apply_forward() and apply_backward() that run a given
+ * operation on all rows level by level, splitting each level among threads
+ * via parallel::apply_to_subranges().
+ *
+ * Since each row is processed with exactly the same operations as in a
+ * sequential substitution, just in a different order, the results coincide
+ * with the ones of the sequential algorithm up to the last bit.
+ *
+ * The number of levels depends on the numbering of the unknowns. For
+ * lexicographically numbered unknowns on structured meshes, the number of
+ * levels grows like the diameter of the mesh and the levels are small,
+ * whereas random or multicolor-like numberings give few large levels. As
+ * the threads need to synchronize after each level, the schedule only pays
+ * off if the levels contain enough rows. The initialize() function therefore
+ * leaves the object empty, which means that the callers should use their
+ * sequential code path, if the matrix or the average level is smaller than a
+ * given threshold, or if only a single thread is available.
+ */
+class SparseLevelSchedule
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Constructor. Leaves the object empty.
+   */
+  SparseLevelSchedule() = default;
+
+  /**
+   * Compute the levels of the forward and backward substitution for the
+   * square sparsity pattern @p sparsity. If the average number of rows per
+   * level in either of the two substitutions is below
+   * @p minimum_rows_per_level, or if MultithreadInfo::n_threads() is one,
+   * the object is left empty.
+   */
+  void
+  initialize(const SparsityPattern &sparsity,
+             const unsigned int     minimum_rows_per_level = 256);
+
+  /**
+   * Release all memory and return to the state after the default
+   * constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return whether the object is empty, i.e., whether the substitutions
+   * should be done sequentially.
+   */
+  bool
+  empty() const;
+
+  /**
+   * Return the number of levels of the forward substitution.
+   */
+  unsigned int
+  n_forward_levels() const;
+
+  /**
+   * Return the number of levels of the backward substitution.
+   */
+  unsigned int
+  n_backward_levels() const;
+
+  /**
+   * Return the rows of the given level of the forward substitution, sorted
+   * by increasing row index.
+   */
+  ArrayView<const size_type>
+  forward_level(const unsigned int level) const;
+
+  /**
+   * Return the rows of the given level of the backward substitution, sorted
+   * by increasing row index.
+   */
+  ArrayView<const size_type>
+  backward_level(const unsigned int level) const;
+
+  /**
+   * Call <code>operation(row)</code> for all rows of the matrix such that
+   * each row is processed after all rows $j<i$ it depends on. The rows
+   * within each level are processed in parallel.
+   */
+  template <typename RowOperation>
+  void
+  apply_forward(const RowOperation &operation) const;
+
+  /**
+   * Call <code>operation(row)</code> for all rows of the matrix such that
+   * each row is processed after all rows $j>i$ it depends on. The rows
+   * within each level are processed in parallel.
+   */
+  template <typename RowOperation>
+  void
+  apply_backward(const RowOperation &operation) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Run @p operation on the rows of all levels stored in the given arrays.
+   */
+  template <typename RowOperation>
+  static void
+  apply_levels(const std::vector<size_type> &level_start,
+               const std::vector<size_type> &rows,
+               const RowOperation           &operation);
+
+  /**
+   * The start of each level of the forward substitution within
+   * forward_rows, with one additional entry at the end.
+   */
+  std::vector<size_type> forward_level_start;
+
+  /**
+   * The rows sorted by their level in the forward substitution.
+   */
+  std::vector<size_type> forward_rows;
+
+  /**
+   * The start of each level of the backward substitution within
+   * backward_rows, with one additional entry at the end.
+   */
+  std::vector<size_type> backward_level_start;
+
+  /**
+   * The rows sorted by their level in the backward substitution.
+   */
+  std::vector<size_type> backward_rows;
+};
+
+/** @} */
+
+/* ---------------------------------- Inline functions ------------------- */
+
+#ifndef DOXYGEN
+
+inline bool
+SparseLevelSchedule::empty() const
+{
+  return forward_rows.empty();
+}
+
+
+
+inline unsigned int
+SparseLevelSchedule::n_forward_levels() const
+{
+  return forward_level_start.empty() ? 0 : forward_level_start.size() - 1;
+}
+
+
+
+inline unsigned int
+SparseLevelSchedule::n_backward_levels() const
+{
+  return backward_level_start.empty() ? 0 : backward_level_start.size() - 1;
+}
+
+
+
+inline ArrayView<const SparseLevelSchedule::size_type>
+SparseLevelSchedule::forward_level(const unsigned int level) const
+{
+  AssertIndexRange(level, n_forward_levels());
+  return make_array_view(forward_rows.begin() + forward_level_start[level],
+                         forward_rows.begin() +
+                           forward_level_start[level + 1]);
+}
+
+
+
+inline ArrayView<const SparseLevelSchedule::size_type>
+SparseLevelSchedule::backward_level(const unsigned int level) const
+{
+  AssertIndexRange(level, n_backward_levels());
+  return make_array_view(backward_rows.begin() + backward_level_start[level],
+                         backward_rows.begin() +
+                           backward_level_start[level + 1]);
+}
+
+
+
+template <typename RowOperation>
+inline void
+SparseLevelSchedule::apply_levels(const std::vector<size_type> &level_start,
+                                  const std::vector<size_type> &rows,
+                                  const RowOperation           &operation)
+{
+  for (unsigned int level = 0; level + 1 < level_start.size(); ++level)
+    parallel::apply_to_subranges(
+      level_start[level],
+      level_start[level + 1],
+      [&rows, &operation](const size_type begin, const size_type end) {
+        for (size_type i = begin; i < end; ++i)
+          operation(rows[i]);
+      },
+      64);
+}
+
+
+
+template <typename RowOperation>
+inline void
+SparseLevelSchedule::apply_forward(const RowOperation &operation) const
+{
+  Assert(!empty(), ExcNotInitialized());
+  apply_levels(forward_level_start, forward_rows, operation);
+}
+
+
+
+template <typename RowOperation>
+inline void
+SparseLevelSchedule::apply_backward(const RowOperation &operation) const
+{
+  Assert(!empty(), ExcNotInitialized());
+  apply_levels(backward_level_start, backward_rows, operation);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
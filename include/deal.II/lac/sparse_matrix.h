@@ -42,6 +42,7 @@ template <typename Matrix>
 class BlockMatrixBase;
 template <typename number>
 class SparseILU;
+class SparseLevelSchedule;
 #  ifdef DEAL_II_WITH_MPI
 namespace Utilities
 {
@@ -1392,6 +1393,55 @@ public:
                     const Vector<somenumber> &src,
                     const number              omega = 1.) const;
 
+  /**
+   * Apply SSOR preconditioning to <tt>src</tt> with damping <tt>omega</tt>
+   * like the function above, but perform the forward and backward sweeps
+   * level by level on multiple threads as described by @p schedule. The
+   * schedule must have been initialized with the sparsity pattern of this
+   * matrix, and @p pos_right_of_diagonal must be given in this case. The
+   * result coincides with the one of the sequential function, which is
+   * called if @p schedule is empty.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename somenumber>
+  void
+  precondition_SSOR(Vector<somenumber>             &dst,
+                    const Vector<somenumber>       &src,
+                    const number                    omega,
+                    const std::vector<std::size_t> &pos_right_of_diagonal,
+                    const SparseLevelSchedule      &schedule) const;
+
+  /**
+   * Apply SOR preconditioning matrix to <tt>src</tt>, performing the forward
+   * substitution level by level on multiple threads as described by
+   * @p schedule. The result coincides with the one of the sequential
+   * function, which is called if @p schedule is empty.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename somenumber>
+  void
+  precondition_SOR(Vector<somenumber>        &dst,
+                   const Vector<somenumber>  &src,
+                   const number               omega,
+                   const SparseLevelSchedule &schedule) const;
+
+  /**
+   * Apply transpose SOR preconditioning matrix to <tt>src</tt>, performing
+   * the backward substitution level by level on multiple threads as
+   * described by @p schedule. The result coincides with the one of the
+   * sequential function, which is called if @p schedule is empty.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename somenumber>
+  void
+  precondition_TSOR(Vector<somenumber>        &dst,
+                    const Vector<somenumber>  &src,
+                    const number               omega,
+                    const SparseLevelSchedule &schedule) const;
+
   /**
    * Perform SSOR preconditioning in-place.  Apply the preconditioner matrix
    * without copying to a second vector.  <tt>omega</tt> is the relaxation
@@ -24,6 +24,7 @@
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/sparse_level_schedule.h>
 #include <deal.II/lac/sparse_matrix.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/vector.h>
@@ -477,27 +478,56 @@ namespace internal
 {
   namespace SparseMatrixImplementation
   {
+    /**
+     * Return the column of an entry in row @p row from the column index
+     * stored in SparsityPattern::colnums.
+     */
+    inline size_type
+    column_index(const size_type, const size_type column)
+    {
+      return column;
+    }
+
+
+
+    /**
+     * Return the column of an entry in row @p row from the relative column
+     * index stored by SparsityPattern::compute_relative_column_indices().
+     */
+    inline size_type
+    column_index(const size_type row, const std::int32_t relative_column)
+    {
+      return row + relative_column;
+    }
+
+
+
     /**
      * Perform a vmult using the SparseMatrix data structures, but only using
-     * a subinterval for the row indices.
+     * a subinterval for the row indices. The column indices are either the
+     * ones of SparsityPattern::colnums or the relative ones of
+     * SparsityPattern::relative_colnums.
      *
      * In the sequential case, this function is called on all rows, in the
      * parallel case it may be called on a subrange, at the discretion of the
      * task scheduler.
      */
-    template <typename number, typename InVector, typename OutVector>
+    template <typename number,
+              typename ColumnIndex,
+              typename InVector,
+              typename OutVector>
     void
     vmult_on_subrange(const size_type    begin_row,
                       const size_type    end_row,
                       const number      *values,
                       const std::size_t *rowstart,
-                      const size_type   *colnums,
+                      const ColumnIndex *colnums,
                       const InVector    &src,
                       OutVector         &dst,
                       const bool         add)
     {
       const number                *val_ptr    = &values[rowstart[begin_row]];
-      const size_type             *colnum_ptr = &colnums[rowstart[begin_row]];
+      const ColumnIndex           *colnum_ptr = &colnums[rowstart[begin_row]];
       typename OutVector::iterator dst_ptr    = dst.begin() + begin_row;
 
       if (add == false)
@@ -507,7 +537,8 @@ namespace internal
             const number *const val_end_of_row = &values[rowstart[row + 1]];
             while (val_ptr != val_end_of_row)
               s += typename OutVector::value_type(*val_ptr++) *
-                   typename OutVector::value_type(src(*colnum_ptr++));
+                   typename OutVector::value_type(
+                     src(column_index(row, *colnum_ptr++)));
             *dst_ptr++ = s;
           }
       else
@@ -517,7 +548,8 @@ namespace internal
             const number *const val_end_of_row = &values[rowstart[row + 1]];
             while (val_ptr != val_end_of_row)
               s += typename OutVector::value_type(*val_ptr++) *
-                   typename OutVector::value_type(src(*colnum_ptr++));
+                   typename OutVector::value_type(
+                     src(column_index(row, *colnum_ptr++)));
             *dst_ptr++ = s;
           }
     }
@@ -782,15 +814,26 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
     0U,
     m(),
     [this, &src, &dst](const size_type begin_row, const size_type end_row) {
-      internal::SparseMatrixImplementation::vmult_on_subrange(
-        begin_row,
-        end_row,
-        val.get(),
-        cols->rowstart.get(),
-        cols->colnums.get(),
-        src,
-        dst,
-        false);
+      if (cols->relative_colnums != nullptr)
+        internal::SparseMatrixImplementation::vmult_on_subrange(
+          begin_row,
+          end_row,
+          val.get(),
+          cols->rowstart.get(),
+          cols->relative_colnums.get(),
+          src,
+          dst,
+          false);
+      else
+        internal::SparseMatrixImplementation::vmult_on_subrange(
+          begin_row,
+          end_row,
+          val.get(),
+          cols->rowstart.get(),
+          cols->colnums.get(),
+          src,
+          dst,
+          false);
     },
     internal::SparseMatrixImplementation::minimum_parallel_grain_size);
 }
@@ -840,15 +883,26 @@ SparseMatrix<number>::vmult_add(OutVector &dst, const InVector &src) const
     0U,
     m(),
     [this, &src, &dst](const size_type begin_row, const size_type end_row) {
-      internal::SparseMatrixImplementation::vmult_on_subrange(
-        begin_row,
-        end_row,
-        val.get(),
-        cols->rowstart.get(),
-        cols->colnums.get(),
-        src,
-        dst,
-        true);
+      if (cols->relative_colnums != nullptr)
+        internal::SparseMatrixImplementation::vmult_on_subrange(
+          begin_row,
+          end_row,
+          val.get(),
+          cols->rowstart.get(),
+          cols->relative_colnums.get(),
+          src,
+          dst,
+          true);
+      else
+        internal::SparseMatrixImplementation::vmult_on_subrange(
+          begin_row,
+          end_row,
+          val.get(),
+          cols->rowstart.get(),
+          cols->colnums.get(),
+          src,
+          dst,
+          true);
     },
     internal::SparseMatrixImplementation::minimum_parallel_grain_size);
 }
@@ -1299,13 +1353,16 @@ namespace internal
      * parallel case it may be called on a subrange, at the discretion of the
      * task scheduler.
      */
-    template <typename number, typename InVector, typename OutVector>
+    template <typename number,
+              typename ColumnIndex,
+              typename InVector,
+              typename OutVector>
     typename OutVector::value_type
     residual_sqr_on_subrange(const size_type    begin_row,
                              const size_type    end_row,
                              const number      *values,
                              const std::size_t *rowstart,
-                             const size_type   *colnums,
+                             const ColumnIndex *colnums,
                              const InVector    &u,
                              const InVector    &b,
                              OutVector         &dst)
@@ -1316,7 +1373,8 @@ namespace internal
         {
           typename OutVector::value_type s = b(i);
           for (size_type j = rowstart[i]; j < rowstart[i + 1]; ++j)
-            s -= typename OutVector::value_type(values[j]) * u(colnums[j]);
+            s -= typename OutVector::value_type(values[j]) *
+                 u(column_index(i, colnums[j]));
           dst(i) = s;
           norm_sqr +=
             s *
@@ -1345,15 +1403,26 @@ SparseMatrix<number>::residual(Vector<somenumber>       &dst,
 
   return std::sqrt(parallel::accumulate_from_subranges<somenumber>(
     [this, &u, &b, &dst](const size_type begin_row, const size_type end_row) {
-      return internal::SparseMatrixImplementation::residual_sqr_on_subrange(
-        begin_row,
-        end_row,
-        val.get(),
-        cols->rowstart.get(),
-        cols->colnums.get(),
-        u,
-        b,
-        dst);
+      if (cols->relative_colnums != nullptr)
+        return internal::SparseMatrixImplementation::residual_sqr_on_subrange(
+          begin_row,
+          end_row,
+          val.get(),
+          cols->rowstart.get(),
+          cols->relative_colnums.get(),
+          u,
+          b,
+          dst);
+      else
+        return internal::SparseMatrixImplementation::residual_sqr_on_subrange(
+          begin_row,
+          end_row,
+          val.get(),
+          cols->rowstart.get(),
+          cols->colnums.get(),
+          u,
+          b,
+          dst);
     },
     0,
     m(),
@@ -1605,6 +1674,144 @@ SparseMatrix<number>::precondition_TSOR(Vector<somenumber>       &dst,
 }
 
 
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::precondition_SSOR(
+  Vector<somenumber>             &dst,
+  const Vector<somenumber>       &src,
+  const number                    omega,
+  const std::vector<std::size_t> &pos_right_of_diagonal,
+  const SparseLevelSchedule      &schedule) const
+{
+  if (schedule.empty())
+    {
+      precondition_SSOR(dst, src, omega, pos_right_of_diagonal);
+      return;
+    }
+
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+  AssertDimension(pos_right_of_diagonal.size(), n());
+
+  internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
+
+  // the operations on each row are the same as in the sequential function
+  // above, only the order in which the rows are visited differs
+  const std::size_t *rowstart = cols->rowstart.get();
+  const size_type   *colnums  = cols->colnums.get();
+  const number      *values   = val.get();
+
+  schedule.apply_forward([&](const size_type row) {
+    dst(row) = src(row);
+    number s = 0;
+    for (size_type j = rowstart[row] + 1; j < pos_right_of_diagonal[row]; ++j)
+      s += values[j] * number(dst(colnums[j]));
+
+    dst(row) -= s * omega;
+    dst(row) /= values[rowstart[row]];
+  });
+
+  parallel::apply_to_subranges(
+    0U,
+    m(),
+    [&](const size_type begin_row, const size_type end_row) {
+      for (size_type row = begin_row; row < end_row; ++row)
+        dst(row) *= somenumber(omega * (number(2.) - omega)) *
+                    somenumber(values[rowstart[row]]);
+    },
+    internal::VectorImplementation::minimum_parallel_grain_size);
+
+  schedule.apply_backward([&](const size_type row) {
+    number s = 0;
+    for (size_type j = rowstart[row + 1] - 1; j >= pos_right_of_diagonal[row];
+         --j)
+      s += values[j] * number(dst(colnums[j]));
+
+    dst(row) -= s * omega;
+    dst(row) /= values[rowstart[row]];
+  });
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::precondition_SOR(Vector<somenumber>        &dst,
+                                       const Vector<somenumber>  &src,
+                                       const number               omega,
+                                       const SparseLevelSchedule &schedule) const
+{
+  if (schedule.empty())
+    {
+      precondition_SOR(dst, src, omega);
+      return;
+    }
+
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+
+  internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
+
+  dst = src;
+  schedule.apply_forward([&](const size_type row) {
+    somenumber s = dst(row);
+    for (size_type j = cols->rowstart[row]; j < cols->rowstart[row + 1]; ++j)
+      {
+        const size_type col = cols->colnums[j];
+        if (col < row)
+          s -= somenumber(val[j]) * dst(col);
+      }
+
+    dst(row) = s * somenumber(omega) / somenumber(val[cols->rowstart[row]]);
+  });
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::precondition_TSOR(
+  Vector<somenumber>        &dst,
+  const Vector<somenumber>  &src,
+  const number               omega,
+  const SparseLevelSchedule &schedule) const
+{
+  if (schedule.empty())
+    {
+      precondition_TSOR(dst, src, omega);
+      return;
+    }
+
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+
+  internal::SparseMatrixImplementation::AssertNoZerosOnDiagonal(*this);
+
+  dst = src;
+  schedule.apply_backward([&](const size_type row) {
+    somenumber s = dst(row);
+    for (size_type j = cols->rowstart[row]; j < cols->rowstart[row + 1]; ++j)
+      if (cols->colnums[j] > row)
+        s -= somenumber(val[j]) * dst(cols->colnums[j]);
+
+    dst(row) = s * somenumber(omega) / somenumber(val[cols->rowstart[row]]);
+  });
+}
+
+
+
 template <typename number>
 template <typename somenumber>
 void
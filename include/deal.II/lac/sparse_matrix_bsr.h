@@ -0,0 +1,1408 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_bsr_h
+#define dealii_sparse_matrix_bsr_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A sparse matrix in the block compressed sparse row (BSR) format, where
+ * each nonzero entry of the sparsity pattern is a dense block of size
+ * $b\times b$. Compared to a SparseMatrix with the same entries, the column
+ * indices are only stored once per block, which reduces the memory needed
+ * for the indices by a factor of $b^2$, and the entries of the source vector
+ * are accessed in contiguous groups of $b$ values, which increases the
+ * arithmetic intensity of the matrix-vector product.
+ *
+ * The format is designed for vector-valued problems discretized with
+ * elements like FESystem(FE_Q<dim>(degree), dim), e.g., in elasticity or for
+ * the velocity of the Navier-Stokes equations, where all components of a
+ * support point couple with all components of the neighboring support
+ * points. The sparsity pattern passed to reinit() describes the coupling
+ * between the blocks and can be created from a DoFHandler with the scalar
+ * element FE_Q<dim>(degree) on the same mesh, e.g., with
+ * DoFTools::make_sparsity_pattern(). Row $i$ and column $j$ of the block
+ * pattern then represent the rows and columns $i b, \ldots, i b + b - 1$ and
+ * $j b, \ldots, j b + b - 1$ of the matrix. The degrees of freedom of the
+ * vector-valued DoFHandler must be numbered accordingly, i.e., the degree of
+ * freedom of component $c$ at the support point with index $k$ in the
+ * scalar DoFHandler must have the index $k b + c$. This numbering can be
+ * obtained with DoFRenumbering::support_point_wise() on the vector-valued
+ * DoFHandler, as long as both DoFHandler objects keep their original
+ * numbering otherwise. With this numbering, the matrix can be assembled in
+ * the usual way with AffineConstraints::distribute_local_to_global() and the
+ * constraints of the vector-valued DoFHandler, as long as the constraints
+ * only couple degrees of freedom within blocks that are part of the block
+ * pattern, which is the case for hanging node constraints set up on the
+ * scalar DoFHandler and used for the pattern.
+ *
+ * The matrix-vector products vmult(), vmult_add(), and residual() are
+ * multithreaded over block rows using parallel::apply_to_subranges() in the
+ * same way as the respective functions of SparseMatrix. For the common block
+ * sizes 1 to 4, the products of the blocks are compiled for the block size
+ * at hand, so that the loops over the entries of a block are fully unrolled
+ * and can be vectorized by the compiler. The vector types passed to these
+ * functions need to store their entries contiguously in memory, which is the
+ * case for Vector and for LinearAlgebra::distributed::Vector without ghost
+ * entries.
+ *
+ * The classes SparseBlockJacobi and SparseBlockILU provide preconditioners
+ * that operate on the blocks of this matrix format.
+ *
+ * Since the column indices of the blocks are stored as <tt>unsigned
+ * int</tt>, the number of block columns must be representable in this type.
+ */
+template <typename number>
+class SparseMatrixBSR : public Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the matrix entries.
+   */
+  using value_type = number;
+
+  /**
+   * Declare a type that holds real-valued numbers with the same
+   * precision as the template argument to this class.
+   */
+  using real_type = typename numbers::NumberTraits<number>::real_type;
+
+  /**
+   * Constructor. Creates an empty matrix.
+   */
+  SparseMatrixBSR();
+
+  /**
+   * Constructor. Set up the matrix with the sparsity pattern of the blocks
+   * @p block_sparsity and blocks of size @p block_size times @p block_size,
+   * see reinit().
+   */
+  SparseMatrixBSR(const SparsityPattern &block_sparsity,
+                  const unsigned int     block_size);
+
+  /**
+   * Set up the matrix with the sparsity pattern of the blocks
+   * @p block_sparsity and blocks of size @p block_size times @p block_size,
+   * and set all entries to zero. The matrix copies the pattern into its own
+   * data structures with the column indices sorted within each row, so
+   * @p block_sparsity can be released after this call.
+   */
+  void
+  reinit(const SparsityPattern &block_sparsity, const unsigned int block_size);
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Set all entries of the matrix to the given value, which must be zero.
+   */
+  SparseMatrixBSR &
+  operator=(const double d);
+
+  /**
+   * Return the number of rows of the matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the size of the blocks.
+   */
+  unsigned int
+  get_block_size() const;
+
+  /**
+   * Return the number of rows of blocks, i.e., the number of rows of the
+   * block sparsity pattern.
+   */
+  size_type
+  n_block_rows_of_pattern() const;
+
+  /**
+   * Return the number of blocks stored in the matrix.
+   */
+  std::size_t
+  n_nonzero_blocks() const;
+
+  /**
+   * Return the number of entries stored in the matrix, i.e., the number of
+   * blocks times the number of entries per block.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Set the element (<i>i,j</i>) to @p value. The element must be part of a
+   * block of the sparsity pattern.
+   */
+  void
+  set(const size_type i, const size_type j, const number value);
+
+  /**
+   * Add @p value to the element (<i>i,j</i>). The element must be part of a
+   * block of the sparsity pattern unless @p value is zero.
+   */
+  void
+  add(const size_type i, const size_type j, const number value);
+
+  /**
+   * Add an array of values given by @p values in the given global matrix
+   * row at columns specified by @p col_indices. This is the interface used by
+   * AffineConstraints::distribute_local_to_global(), with the same meaning
+   * of the arguments as in SparseMatrix::add().
+   */
+  template <typename number2>
+  void
+  add(const size_type  row,
+      const size_type  n_cols,
+      const size_type *col_indices,
+      const number2   *values,
+      const bool       elide_zero_values      = true,
+      const bool       col_indices_are_sorted = false);
+
+  /**
+   * Return the value of the entry (<i>i,j</i>). The entry must be part of a
+   * block of the sparsity pattern.
+   */
+  number
+  operator()(const size_type i, const size_type j) const;
+
+  /**
+   * Return the value of the entry (<i>i,j</i>), or zero if the entry is not
+   * part of a block of the sparsity pattern.
+   */
+  number
+  el(const size_type i, const size_type j) const;
+
+  /**
+   * Return the main diagonal element in the <i>i</i>th row. The matrix must
+   * be quadratic.
+   */
+  number
+  diag_element(const size_type i) const;
+
+  /**
+   * Copy the entries of @p matrix into this object. All nonzero entries of
+   * @p matrix must be part of a block of the sparsity pattern of this
+   * matrix; entries of the blocks that are not present in @p matrix are set
+   * to zero.
+   */
+  template <typename number2>
+  void
+  copy_from(const SparseMatrix<number2> &matrix);
+
+  /**
+   * Return a pointer to the $b\times b$ entries of the block in block row
+   * @p block_row and block column @p block_col, stored row by row, or a
+   * null pointer if the block is not part of the sparsity pattern.
+   */
+  const number *
+  get_block(const size_type block_row, const size_type block_col) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+   * matrix.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: let $dst += M*src$ with $M$ being
+   * this matrix.
+   */
+  template <typename VectorType>
+  void
+  vmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Matrix-vector multiplication with the transpose of the matrix: let
+   * $dst = M^T*src$. This function is not multithreaded.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication with the transpose of the matrix:
+   * let $dst += M^T*src$. This function is not multithreaded.
+   */
+  template <typename VectorType>
+  void
+  Tvmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Compute the residual $dst = b - M*x$ and return its $l_2$ norm.
+   */
+  template <typename VectorType>
+  typename VectorType::real_type
+  residual(VectorType &dst, const VectorType &x, const VectorType &b) const;
+
+  /**
+   * Return an estimate for the memory consumption, in bytes, of this object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * @addtogroup Exceptions
+   * @{
+   */
+
+  /**
+   * Exception
+   */
+  DeclException2(ExcInvalidIndex,
+                 size_type,
+                 size_type,
+                 << "You are trying to access the matrix entry with index <"
+                 << arg1 << ',' << arg2
+                 << ">, but this entry is not part of a block of the "
+                    "sparsity pattern of this matrix.");
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcSourceEqualsDestination,
+                   "You are attempting an operation on two vectors that "
+                   "are the same object, but the operation requires that the "
+                   "two objects are in fact different.");
+  /** @} */
+
+private:
+  /**
+   * Return the position of the block (<i>block_row,block_col</i>) in the
+   * array of block columns, or numbers::invalid_size_type if the block is not
+   * part of the sparsity pattern.
+   */
+  std::size_t
+  block_index(const size_type block_row, const size_type block_col) const;
+
+  /**
+   * Compute the product of the block rows in the range
+   * [begin_row, end_row) with the vector @p src. If @p rhs is not a null
+   * pointer, the result is subtracted from @p rhs, otherwise it is added to
+   * or written into @p dst depending on @p add.
+   */
+  template <typename Number2>
+  void
+  vmult_on_block_rows(const size_type begin_row,
+                      const size_type end_row,
+                      const Number2  *src,
+                      Number2        *dst,
+                      const Number2  *rhs,
+                      const bool      add) const;
+
+  /**
+   * The size of the blocks.
+   */
+  unsigned int block_size;
+
+  /**
+   * The number of columns of the block sparsity pattern.
+   */
+  size_type n_block_cols;
+
+  /**
+   * The start of each block row in the arrays block_columns and (multiplied
+   * by block_size squared) values. The array has one more entry than there
+   * are block rows.
+   */
+  std::vector<std::size_t> row_start;
+
+  /**
+   * The column of each block, sorted within each block row.
+   */
+  std::vector<unsigned int> block_columns;
+
+  /**
+   * The entries of the blocks, with the entries of each block stored row by
+   * row.
+   */
+  AlignedVector<number> values;
+
+  // the preconditioners access the blocks directly
+  template <typename>
+  friend class SparseBlockJacobi;
+  template <typename>
+  friend class SparseBlockILU;
+};
+
+
+
+/**
+ * Block Jacobi preconditioner for a SparseMatrixBSR: the inverses of the
+ * diagonal blocks of the matrix are computed in initialize(), and vmult()
+ * multiplies each block of the vector by the respective inverse and the
+ * relaxation parameter.
+ */
+template <typename number>
+class SparseBlockJacobi : public Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Parameters of the preconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const double relaxation = 1.);
+
+    /**
+     * Relaxation parameter multiplying the inverse of the diagonal blocks.
+     */
+    double relaxation;
+  };
+
+  /**
+   * Compute the inverses of the diagonal blocks of @p matrix. All diagonal
+   * blocks must be part of the sparsity pattern and invertible.
+   */
+  void
+  initialize(const SparseMatrixBSR<number> &matrix,
+             const AdditionalData          &additional_data = AdditionalData());
+
+  /**
+   * Apply the preconditioner.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return an estimate for the memory consumption, in bytes, of this object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The size of the blocks.
+   */
+  unsigned int block_size = 0;
+
+  /**
+   * The relaxation parameter.
+   */
+  double relaxation = 1.;
+
+  /**
+   * The inverses of the diagonal blocks, stored row by row.
+   */
+  AlignedVector<number> inverse_diagonal;
+};
+
+
+
+/**
+ * Incomplete LU decomposition without fill-in, ILU(0), of a SparseMatrixBSR
+ * computed on the blocks of the matrix: the factors $L$ and $U$ have the
+ * same block sparsity pattern as the matrix, and all operations on the
+ * entries of the scalar ILU(0) decomposition become operations on dense
+ * blocks, with the division by the diagonal entries replaced by the
+ * multiplication with the inverse of the diagonal blocks. For a block size of
+ * one, the result is the same as the one of SparseILU with the default
+ * parameters.
+ *
+ * Since the couplings within a block are factorized exactly, this
+ * preconditioner is usually more robust than a scalar ILU(0) for systems
+ * with strong coupling between the components.
+ */
+template <typename number>
+class SparseBlockILU : public Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Compute the decomposition of @p matrix, which must be quadratic and
+   * contain all diagonal blocks in its sparsity pattern.
+   */
+  void
+  initialize(const SparseMatrixBSR<number> &matrix);
+
+  /**
+   * Apply the preconditioner, i.e., solve $LU dst = src$.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return an estimate for the memory consumption, in bytes, of this object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The size of the blocks.
+   */
+  unsigned int block_size = 0;
+
+  /**
+   * The start of each block row in the arrays block_columns and values,
+   * copied from the matrix.
+   */
+  std::vector<std::size_t> row_start;
+
+  /**
+   * The position of the diagonal block within each block row.
+   */
+  std::vector<std::size_t> diagonal_position;
+
+  /**
+   * The column of each block, sorted within each block row.
+   */
+  std::vector<unsigned int> block_columns;
+
+  /**
+   * The blocks of the factors: the blocks left of the diagonal contain the
+   * factor $L$ (with unit diagonal blocks not stored), the blocks right of
+   * the diagonal the factor $U$, and the diagonal blocks contain the
+   * inverses of the diagonal blocks of $U$.
+   */
+  AlignedVector<number> values;
+};
+
+/** @} */
+
+
+/* ---------------------------------- Inline functions ------------------- */
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SparseMatrixBSRImplementation
+  {
+    /**
+     * Compute dst += sign * block * src for a block of size block_size. The
+     * template argument fixes the block size at compile time if it is
+     * larger than zero.
+     */
+    template <int fixed_size, typename number, typename Number2>
+    inline void
+    add_block_vmult(const unsigned int block_size,
+                    const number      *block,
+                    const Number2     *src,
+                    Number2           *dst,
+                    const bool         subtract)
+    {
+      const unsigned int b = fixed_size > 0 ? fixed_size : block_size;
+      for (unsigned int r = 0; r < b; ++r)
+        {
+          Number2 sum = Number2();
+          for (unsigned int c = 0; c < b; ++c)
+            sum += Number2(block[r * b + c]) * src[c];
+          if (subtract)
+            dst[r] -= sum;
+          else
+            dst[r] += sum;
+        }
+    }
+
+
+
+    /**
+     * Compute result = a * b for two blocks of size block_size.
+     */
+    template <typename number>
+    inline void
+    multiply_blocks(const unsigned int block_size,
+                    const number      *a,
+                    const number      *b,
+                    number            *result)
+    {
+      for (unsigned int i = 0; i < block_size; ++i)
+        for (unsigned int j = 0; j < block_size; ++j)
+          {
+            number sum = number();
+            for (unsigned int k = 0; k < block_size; ++k)
+              sum += a[i * block_size + k] * b[k * block_size + j];
+            result[i * block_size + j] = sum;
+          }
+    }
+
+
+
+    /**
+     * Replace the block of size block_size by its inverse.
+     */
+    template <typename number>
+    inline void
+    invert_block(const unsigned int block_size, number *block)
+    {
+      FullMatrix<number> matrix(block_size, block_size);
+      for (unsigned int i = 0; i < block_size; ++i)
+        for (unsigned int j = 0; j < block_size; ++j)
+          matrix(i, j) = block[i * block_size + j];
+      matrix.gauss_jordan();
+      for (unsigned int i = 0; i < block_size; ++i)
+        for (unsigned int j = 0; j < block_size; ++j)
+          block[i * block_size + j] = matrix(i, j);
+    }
+
+
+
+    /**
+     * Compute dst = inverse * src for the blocks of a vector, where the
+     * inverses of the diagonal blocks are stored one after the other, and
+     * multiply the result by the given factor.
+     */
+    template <int fixed_size, typename number, typename Number2>
+    inline void
+    apply_inverse_diagonal(const unsigned int block_size,
+                           const std::size_t  begin_row,
+                           const std::size_t  end_row,
+                           const number      *inverse_diagonal,
+                           const Number2      factor,
+                           const Number2     *src,
+                           Number2           *dst)
+    {
+      const unsigned int b = fixed_size > 0 ? fixed_size : block_size;
+      for (std::size_t row = begin_row; row < end_row; ++row)
+        {
+          const number *block = inverse_diagonal + row * b * b;
+          for (unsigned int r = 0; r < b; ++r)
+            {
+              Number2 sum = Number2();
+              for (unsigned int c = 0; c < b; ++c)
+                sum += Number2(block[r * b + c]) * src[row * b + c];
+              dst[row * b + r] = factor * sum;
+            }
+        }
+    }
+  } // namespace SparseMatrixBSRImplementation
+} // namespace internal
+
+
+
+template <typename number>
+inline SparseMatrixBSR<number>::SparseMatrixBSR()
+  : block_size(1)
+  , n_block_cols(0)
+{}
+
+
+
+template <typename number>
+inline SparseMatrixBSR<number>::SparseMatrixBSR(
+  const SparsityPattern &block_sparsity,
+  const unsigned int     block_size)
+  : SparseMatrixBSR()
+{
+  reinit(block_sparsity, block_size);
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixBSR<number>::reinit(const SparsityPattern &block_sparsity,
+                                const unsigned int     block_size)
+{
+  Assert(block_sparsity.is_compressed(), SparsityPattern::ExcNotCompressed());
+  Assert(block_size > 0, ExcMessage("The block size must be positive."));
+  AssertThrow(block_sparsity.n_cols() <=
+                std::numeric_limits<unsigned int>::max(),
+              ExcMessage("The number of block columns of a SparseMatrixBSR "
+                         "must fit into an unsigned int."));
+
+  this->block_size = block_size;
+  n_block_cols     = block_sparsity.n_cols();
+
+  const size_type n_block_rows = block_sparsity.n_rows();
+  row_start.resize(n_block_rows + 1);
+  row_start[0] = 0;
+  for (size_type row = 0; row < n_block_rows; ++row)
+    row_start[row + 1] = row_start[row] + block_sparsity.row_length(row);
+
+  // copy the column indices and sort them within each row, since the
+  // SparsityPattern stores the diagonal entry first
+  block_columns.resize(row_start.back());
+  for (size_type row = 0; row < n_block_rows; ++row)
+    {
+      std::size_t index = row_start[row];
+      for (auto entry = block_sparsity.begin(row);
+           entry != block_sparsity.end(row);
+           ++entry, ++index)
+        block_columns[index] = entry->column();
+      std::sort(block_columns.begin() + row_start[row],
+                block_columns.begin() + row_start[row + 1]);
+    }
+
+  values.resize_fast(row_start.back() * block_size * block_size);
+  values.fill(number());
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixBSR<number>::clear()
+{
+  block_size   = 1;
+  n_block_cols = 0;
+  row_start.clear();
+  block_columns.clear();
+  values.clear();
+}
+
+
+
+template <typename number>
+inline SparseMatrixBSR<number> &
+SparseMatrixBSR<number>::operator=(const double d)
+{
+  (void)d;
+  Assert(d == 0, ExcScalarAssignmentOnlyForZeroValue());
+  values.fill(number());
+  return *this;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixBSR<number>::size_type
+SparseMatrixBSR<number>::m() const
+{
+  return row_start.empty() ? 0 : (row_start.size() - 1) * block_size;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixBSR<number>::size_type
+SparseMatrixBSR<number>::n() const
+{
+  return n_block_cols * block_size;
+}
+
+
+
+template <typename number>
+inline unsigned int
+SparseMatrixBSR<number>::get_block_size() const
+{
+  return block_size;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixBSR<number>::size_type
+SparseMatrixBSR<number>::n_block_rows_of_pattern() const
+{
+  return row_start.empty() ? 0 : row_start.size() - 1;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixBSR<number>::n_nonzero_blocks() const
+{
+  return block_columns.size();
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixBSR<number>::n_nonzero_elements() const
+{
+  return values.size();
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixBSR<number>::block_index(const size_type block_row,
+                                     const size_type block_col) const
+{
+  AssertIndexRange(block_row, n_block_rows_of_pattern());
+  const auto begin = block_columns.begin() + row_start[block_row];
+  const auto end   = block_columns.begin() + row_start[block_row + 1];
+  const auto it    = std::lower_bound(begin, end, block_col);
+  if (it != end && *it == block_col)
+    return it - block_columns.begin();
+  else
+    return numbers::invalid_size_type;
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixBSR<number>::set(const size_type i,
+                             const size_type j,
+                             const number    value)
+{
+  AssertIsFinite(value);
+  const std::size_t index = block_index(i / block_size, j / block_size);
+  Assert(index != numbers::invalid_size_type, ExcInvalidIndex(i, j));
+  values[(index * block_size + i % block_size) * block_size + j % block_size] =
+    value;
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixBSR<number>::add(const size_type i,
+                             const size_type j,
+                             const number    value)
+{
+  AssertIsFinite(value);
+  if (value == number())
+    return;
+  const std::size_t index = block_index(i / block_size, j / block_size);
+  Assert(index != numbers::invalid_size_type, ExcInvalidIndex(i, j));
+  values[(index * block_size + i % block_size) * block_size + j % block_size] +=
+    value;
+}
+
+
+
+template <typename number>
+template <typename number2>
+inline void
+SparseMatrixBSR<number>::add(const size_type  row,
+                             const size_type  n_cols,
+                             const size_type *col_indices,
+                             const number2   *values,
+                             const bool       elide_zero_values,
+                             const bool       col_indices_are_sorted)
+{
+  const size_type block_row = row / block_size;
+  AssertIndexRange(block_row, n_block_rows_of_pattern());
+  const unsigned int *const columns_begin =
+    block_columns.data() + row_start[block_row];
+  const unsigned int *const columns_end =
+    block_columns.data() + row_start[block_row + 1];
+  number *const row_values =
+    this->values.data() +
+    row_start[block_row] * block_size * block_size +
+    (row % block_size) * block_size;
+
+  // for sorted column indices, walk through the blocks of the row only once
+  const unsigned int *position = columns_begin;
+  for (size_type k = 0; k < n_cols; ++k)
+    {
+      AssertIsFinite(values[k]);
+      if (elide_zero_values && values[k] == number2())
+        continue;
+
+      const size_type block_col = col_indices[k] / block_size;
+      if (col_indices_are_sorted == false)
+        position = columns_begin;
+      position = std::lower_bound(position, columns_end, block_col);
+      if (position == columns_end || *position != block_col)
+        {
+          Assert(values[k] == number2(),
+                 ExcInvalidIndex(row, col_indices[k]));
+          if (col_indices_are_sorted == false)
+            position = columns_begin;
+          continue;
+        }
+      row_values[(position - columns_begin) * block_size * block_size +
+                 col_indices[k] % block_size] += number(values[k]);
+    }
+}
+
+
+
+template <typename number>
+inline number
+SparseMatrixBSR<number>::operator()(const size_type i, const size_type j) const
+{
+  const std::size_t index = block_index(i / block_size, j / block_size);
+  Assert(index != numbers::invalid_size_type, ExcInvalidIndex(i, j));
+  return values[(index * block_size + i % block_size) * block_size +
+                j % block_size];
+}
+
+
+
+template <typename number>
+inline number
+SparseMatrixBSR<number>::el(const size_type i, const size_type j) const
+{
+  const std::size_t index = block_index(i / block_size, j / block_size);
+  if (index == numbers::invalid_size_type)
+    return number();
+  return values[(index * block_size + i % block_size) * block_size +
+                j % block_size];
+}
+
+
+
+template <typename number>
+inline number
+SparseMatrixBSR<number>::diag_element(const size_type i) const
+{
+  Assert(m() == n(), ExcNotQuadratic());
+  return (*this)(i, i);
+}
+
+
+
+template <typename number>
+template <typename number2>
+inline void
+SparseMatrixBSR<number>::copy_from(const SparseMatrix<number2> &matrix)
+{
+  AssertDimension(matrix.m(), m());
+  AssertDimension(matrix.n(), n());
+
+  values.fill(number());
+  for (size_type row = 0; row < matrix.m(); ++row)
+    for (auto entry = matrix.begin(row); entry != matrix.end(row); ++entry)
+      if (entry->value() != number2())
+        set(row, entry->column(), number(entry->value()));
+}
+
+
+
+template <typename number>
+inline const number *
+SparseMatrixBSR<number>::get_block(const size_type block_row,
+                                   const size_type block_col) const
+{
+  const std::size_t index = block_index(block_row, block_col);
+  if (index == numbers::invalid_size_type)
+    return nullptr;
+  return values.data() + index * block_size * block_size;
+}
+
+
+
+template <typename number>
+template <typename Number2>
+inline void
+SparseMatrixBSR<number>::vmult_on_block_rows(const size_type begin_row,
+                                             const size_type end_row,
+                                             const Number2  *src,
+                                             Number2        *dst,
+                                             const Number2  *rhs,
+                                             const bool      add) const
+{
+  const auto kernel = [&](auto fixed_size) {
+    constexpr int      size = decltype(fixed_size)::value;
+    const unsigned int b    = size > 0 ? size : block_size;
+    for (size_type row = begin_row; row < end_row; ++row)
+      {
+        Number2 *out = dst + row * b;
+        if (rhs != nullptr)
+          for (unsigned int r = 0; r < b; ++r)
+            out[r] = rhs[row * b + r];
+        else if (add == false)
+          for (unsigned int r = 0; r < b; ++r)
+            out[r] = Number2();
+
+        const number *block = values.data() + row_start[row] * b * b;
+        for (std::size_t k = row_start[row]; k < row_start[row + 1];
+             ++k, block += b * b)
+          internal::SparseMatrixBSRImplementation::add_block_vmult<size>(
+            b,
+            block,
+            src + std::size_t(block_columns[k]) * b,
+            out,
+            rhs != nullptr);
+      }
+  };
+
+  switch (block_size)
+    {
+      case 1:
+        kernel(std::integral_constant<int, 1>());
+        break;
+      case 2:
+        kernel(std::integral_constant<int, 2>());
+        break;
+      case 3:
+        kernel(std::integral_constant<int, 3>());
+        break;
+      case 4:
+        kernel(std::integral_constant<int, 4>());
+        break;
+      default:
+        kernel(std::integral_constant<int, 0>());
+    }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixBSR<number>::vmult(VectorType &dst, const VectorType &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    n_block_rows_of_pattern(),
+    [this, &src, &dst](const size_type begin_row, const size_type end_row) {
+      vmult_on_block_rows(begin_row,
+                          end_row,
+                          src.begin(),
+                          dst.begin(),
+                          static_cast<const typename VectorType::value_type *>(
+                            nullptr),
+                          false);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        block_size +
+      1);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixBSR<number>::vmult_add(VectorType &dst, const VectorType &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    n_block_rows_of_pattern(),
+    [this, &src, &dst](const size_type begin_row, const size_type end_row) {
+      vmult_on_block_rows(begin_row,
+                          end_row,
+                          src.begin(),
+                          dst.begin(),
+                          static_cast<const typename VectorType::value_type *>(
+                            nullptr),
+                          true);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        block_size +
+      1);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixBSR<number>::Tvmult(VectorType &dst, const VectorType &src) const
+{
+  dst = 0;
+  Tvmult_add(dst, src);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixBSR<number>::Tvmult_add(VectorType       &dst,
+                                    const VectorType &src) const
+{
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  using Number2 = typename VectorType::value_type;
+
+  const unsigned int b = block_size;
+  for (size_type row = 0; row < n_block_rows_of_pattern(); ++row)
+    for (std::size_t k = row_start[row]; k < row_start[row + 1]; ++k)
+      {
+        const number *block = values.data() + k * b * b;
+        Number2      *out   = dst.begin() + std::size_t(block_columns[k]) * b;
+        for (unsigned int r = 0; r < b; ++r)
+          {
+            const Number2 src_value = src(row * b + r);
+            for (unsigned int c = 0; c < b; ++c)
+              out[c] += Number2(block[r * b + c]) * src_value;
+          }
+      }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline typename VectorType::real_type
+SparseMatrixBSR<number>::residual(VectorType       &dst,
+                                  const VectorType &x,
+                                  const VectorType &b) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(b.size(), m());
+  AssertDimension(x.size(), n());
+  Assert(!PointerComparison::equal(&x, &dst), ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    n_block_rows_of_pattern(),
+    [this, &x, &b, &dst](const size_type begin_row, const size_type end_row) {
+      vmult_on_block_rows(
+        begin_row, end_row, x.begin(), dst.begin(), b.begin(), false);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        block_size +
+      1);
+
+  return dst.l2_norm();
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixBSR<number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(row_start) +
+         MemoryConsumption::memory_consumption(block_columns) +
+         values.memory_consumption();
+}
+
+
+
+template <typename number>
+inline SparseBlockJacobi<number>::AdditionalData::AdditionalData(
+  const double relaxation)
+  : relaxation(relaxation)
+{}
+
+
+
+template <typename number>
+inline void
+SparseBlockJacobi<number>::initialize(const SparseMatrixBSR<number> &matrix,
+                                      const AdditionalData &additional_data)
+{
+  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+  block_size = matrix.get_block_size();
+  relaxation = additional_data.relaxation;
+
+  const unsigned int b            = block_size;
+  const size_type    n_block_rows = matrix.n_block_rows_of_pattern();
+  inverse_diagonal.resize_fast(n_block_rows * b * b);
+  for (size_type row = 0; row < n_block_rows; ++row)
+    {
+      const number *block = matrix.get_block(row, row);
+      Assert(block != nullptr,
+             ExcMessage("The diagonal blocks of the matrix must be part of "
+                        "the sparsity pattern."));
+      std::copy(block, block + b * b, inverse_diagonal.data() + row * b * b);
+      internal::SparseMatrixBSRImplementation::invert_block(
+        b, inverse_diagonal.data() + row * b * b);
+    }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseBlockJacobi<number>::vmult(VectorType &dst, const VectorType &src) const
+{
+  Assert(block_size > 0, ExcNotInitialized());
+  AssertDimension(dst.size(), inverse_diagonal.size() / block_size);
+  AssertDimension(src.size(), dst.size());
+
+  using Number2 = typename VectorType::value_type;
+  const size_type n_block_rows =
+    block_size > 0 ? inverse_diagonal.size() / (block_size * block_size) : 0;
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    n_block_rows,
+    [this, &src, &dst](const size_type begin_row, const size_type end_row) {
+      const Number2 factor = Number2(relaxation);
+      const number *inverse = inverse_diagonal.data();
+      switch (block_size)
+        {
+          case 1:
+            internal::SparseMatrixBSRImplementation::apply_inverse_diagonal<1>(
+              1, begin_row, end_row, inverse, factor, src.begin(), dst.begin());
+            break;
+          case 2:
+            internal::SparseMatrixBSRImplementation::apply_inverse_diagonal<2>(
+              2, begin_row, end_row, inverse, factor, src.begin(), dst.begin());
+            break;
+          case 3:
+            internal::SparseMatrixBSRImplementation::apply_inverse_diagonal<3>(
+              3, begin_row, end_row, inverse, factor, src.begin(), dst.begin());
+            break;
+          case 4:
+            internal::SparseMatrixBSRImplementation::apply_inverse_diagonal<4>(
+              4, begin_row, end_row, inverse, factor, src.begin(), dst.begin());
+            break;
+          default:
+            internal::SparseMatrixBSRImplementation::apply_inverse_diagonal<0>(
+              block_size,
+              begin_row,
+              end_row,
+              inverse,
+              factor,
+              src.begin(),
+              dst.begin());
+        }
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        std::max(block_size, 1U) +
+      1);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseBlockJacobi<number>::Tvmult(VectorType &dst, const VectorType &src) const
+{
+  // the inverse of the transposed diagonal blocks is the transpose of the
+  // inverse
+  AssertDimension(dst.size(), inverse_diagonal.size() / block_size);
+  AssertDimension(src.size(), dst.size());
+
+  using Number2      = typename VectorType::value_type;
+  const unsigned int b = block_size;
+  for (size_type row = 0; row < dst.size() / b; ++row)
+    {
+      const number *block = inverse_diagonal.data() + row * b * b;
+      for (unsigned int c = 0; c < b; ++c)
+        {
+          Number2 sum = Number2();
+          for (unsigned int r = 0; r < b; ++r)
+            sum += Number2(block[r * b + c]) * src(row * b + r);
+          dst(row * b + c) = Number2(relaxation) * sum;
+        }
+    }
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseBlockJacobi<number>::memory_consumption() const
+{
+  return sizeof(*this) + inverse_diagonal.memory_consumption();
+}
+
+
+
+template <typename number>
+inline void
+SparseBlockILU<number>::initialize(const SparseMatrixBSR<number> &matrix)
+{
+  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+  block_size    = matrix.get_block_size();
+  row_start     = matrix.row_start;
+  block_columns = matrix.block_columns;
+  values        = matrix.values;
+
+  const unsigned int b            = block_size;
+  const size_type    n_block_rows = matrix.n_block_rows_of_pattern();
+
+  diagonal_position.resize(n_block_rows);
+  for (size_type row = 0; row < n_block_rows; ++row)
+    {
+      diagonal_position[row] = matrix.block_index(row, row);
+      Assert(diagonal_position[row] != numbers::invalid_size_type,
+             ExcMessage("The diagonal blocks of the matrix must be part of "
+                        "the sparsity pattern."));
+    }
+
+  // ILU(0) in the IKJ variant, operating on blocks: for each block row i
+  // and each block column k < i in that row, compute L_ik = A_ik U_kk^{-1}
+  // and subtract L_ik U_kj from the blocks A_ij with j > k that are part of
+  // the pattern. the blocks are sorted by column, so the rows i and k can be
+  // merged. the diagonal blocks are inverted once the row is done.
+  std::vector<number> l_block(b * b), product(b * b);
+  for (size_type row = 0; row < n_block_rows; ++row)
+    {
+      for (std::size_t ik = row_start[row]; ik < diagonal_position[row]; ++ik)
+        {
+          const size_type k    = block_columns[ik];
+          number         *a_ik = values.data() + ik * b * b;
+          const number   *u_kk_inv =
+            values.data() + diagonal_position[k] * b * b;
+          internal::SparseMatrixBSRImplementation::multiply_blocks(
+            b, a_ik, u_kk_inv, l_block.data());
+          std::copy(l_block.begin(), l_block.end(), a_ik);
+
+          std::size_t ij = ik + 1;
+          for (std::size_t kj = diagonal_position[k] + 1;
+               kj < row_start[k + 1] && ij < row_start[row + 1];
+               ++kj)
+            {
+              while (ij < row_start[row + 1] &&
+                     block_columns[ij] < block_columns[kj])
+                ++ij;
+              if (ij < row_start[row + 1] &&
+                  block_columns[ij] == block_columns[kj])
+                {
+                  internal::SparseMatrixBSRImplementation::multiply_blocks(
+                    b,
+                    l_block.data(),
+                    values.data() + kj * b * b,
+                    product.data());
+                  number *a_ij = values.data() + ij * b * b;
+                  for (unsigned int e = 0; e < b * b; ++e)
+                    a_ij[e] -= product[e];
+                }
+            }
+        }
+
+      internal::SparseMatrixBSRImplementation::invert_block(
+        b, values.data() + diagonal_position[row] * b * b);
+    }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseBlockILU<number>::vmult(VectorType &dst, const VectorType &src) const
+{
+  AssertDimension(dst.size(), diagonal_position.size() * block_size);
+  AssertDimension(src.size(), dst.size());
+
+  using Number2                = typename VectorType::value_type;
+  const unsigned int b         = block_size;
+  const size_type    n_rows    = diagonal_position.size();
+  Number2 *const     dst_ptr   = dst.begin();
+  const Number2     *src_ptr   = src.begin();
+  std::vector<Number2> tmp(b);
+
+  // forward substitution with the unit lower triangular factor L
+  for (size_type row = 0; row < n_rows; ++row)
+    {
+      Number2 *out = dst_ptr + row * b;
+      for (unsigned int r = 0; r < b; ++r)
+        out[r] = src_ptr[row * b + r];
+      for (std::size_t k = row_start[row]; k < diagonal_position[row]; ++k)
+        internal::SparseMatrixBSRImplementation::add_block_vmult<0>(
+          b,
+          values.data() + k * b * b,
+          dst_ptr + std::size_t(block_columns[k]) * b,
+          out,
+          true);
+    }
+
+  // backward substitution with U, whose diagonal blocks are stored inverted
+  for (size_type row = n_rows; row-- > 0;)
+    {
+      Number2 *out = dst_ptr + row * b;
+      for (std::size_t k = diagonal_position[row] + 1; k < row_start[row + 1];
+           ++k)
+        internal::SparseMatrixBSRImplementation::add_block_vmult<0>(
+          b,
+          values.data() + k * b * b,
+          dst_ptr + std::size_t(block_columns[k]) * b,
+          out,
+          true);
+      for (unsigned int r = 0; r < b; ++r)
+        tmp[r] = out[r];
+      for (unsigned int r = 0; r < b; ++r)
+        out[r] = Number2();
+      internal::SparseMatrixBSRImplementation::add_block_vmult<0>(
+        b,
+        values.data() + diagonal_position[row] * b * b,
+        tmp.data(),
+        out,
+        false);
+    }
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseBlockILU<number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(row_start) +
+         MemoryConsumption::memory_consumption(diagonal_position) +
+         MemoryConsumption::memory_consumption(block_columns) +
+         values.memory_consumption();
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
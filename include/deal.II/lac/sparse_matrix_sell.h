@@ -0,0 +1,789 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_sell_h
+#define dealii_sparse_matrix_sell_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/template_constraints.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A sparse matrix stored in the sliced ELLPACK format with row sorting, also
+ * known as SELL-C-$\sigma$ (see M. Kreutzer, G. Hager, G. Wellein, H. Fehske,
+ * A. R. Bishop, "A unified sparse matrix data format for efficient general
+ * sparse matrix-vector multiplication on modern processors with wide SIMD
+ * units", SIAM J. Sci. Comput. 36 (2014), C401-C423).
+ *
+ * The rows of the matrix are grouped into slices of $C$ rows, where $C$ is
+ * the number of lanes of VectorizedArray<number>, i.e., the SIMD width of the
+ * processor. Within each slice, all rows are padded with zeros to the length
+ * of the longest row in the slice, and the entries are stored in a
+ * column-major fashion, such that the $k$-th entry of all $C$ rows of a slice
+ * forms one VectorizedArray. A matrix-vector product then processes all rows
+ * of a slice at once with SIMD instructions, gathering the entries of the
+ * source vector from the column indices of the $C$ rows. In order to keep the
+ * amount of padding small, the rows are sorted by decreasing length within
+ * windows of $\sigma$ consecutive rows before the slices are formed. The
+ * permutation is undone when writing the result, so the vectors passed to
+ * this class are in the original numbering of the SparseMatrix.
+ *
+ * This class does not support assembly. Rather, it is built from an already
+ * assembled SparseMatrix, either in one go via reinit(const SparseMatrix &,
+ * const AdditionalData &), or by first setting up the layout from a
+ * SparsityPattern via reinit(const SparsityPattern &, const AdditionalData &)
+ * and then calling copy_from() every time the values of the matrix have
+ * changed. The latter avoids recomputing the row permutation for matrices
+ * that are re-assembled on a fixed sparsity pattern, e.g., in time stepping.
+ *
+ * The matrix-vector products vmult(), vmult_add(), and residual() are
+ * multithreaded over slices using parallel::apply_to_subranges() in the same
+ * way as the respective functions of SparseMatrix. The vector types passed to
+ * these functions need to store their entries contiguously in memory, which is
+ * the case for Vector and for LinearAlgebra::distributed::Vector without
+ * ghost entries. If the value type of the vectors coincides with @p number,
+ * the products are vectorized using VectorizedArray::gather(); otherwise, a
+ * scalar code path with the same memory layout is used.
+ *
+ * The format typically pays off for matrices whose row lengths do not vary
+ * too much, as is the case for matrices arising from finite element
+ * discretizations on meshes with a bounded number of neighbors per vertex.
+ * The ratio n_nonzero_elements()/n_stored_elements() indicates the fraction
+ * of the stored entries that are not padding.
+ *
+ * Since the column indices are stored in the format expected by
+ * VectorizedArray::gather(), the number of columns of the matrix must be
+ * representable as an <tt>unsigned int</tt>.
+ */
+template <typename number>
+class SparseMatrixSELL : public Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the matrix entries.
+   */
+  using value_type = number;
+
+  /**
+   * Number of rows in a slice, given by the number of lanes of
+   * VectorizedArray<number>.
+   */
+  static constexpr unsigned int chunk_size = VectorizedArray<number>::size();
+
+  /**
+   * Parameters controlling the layout of the matrix.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const unsigned int sigma = 16 * chunk_size);
+
+    /**
+     * The size of the windows of consecutive rows within which the rows are
+     * sorted by decreasing length before slices are formed. A value of one
+     * disables sorting, giving the plain sliced ELLPACK format, whereas
+     * numbers::invalid_unsigned_int sorts all rows of the matrix globally.
+     * Larger values reduce the amount of padding, but also scatter the rows
+     * of a slice further apart, which reduces the locality in the accesses
+     * to the destination vector. The value should be a multiple of
+     * chunk_size.
+     */
+    unsigned int sigma;
+  };
+
+  /**
+   * Constructor. Leaves the matrix empty, it needs to be initialized by one
+   * of the reinit() functions before use.
+   */
+  SparseMatrixSELL();
+
+  /**
+   * Constructor. Sets up the layout from the sparsity pattern of @p matrix
+   * and copies its values. Equivalent to calling reinit(const
+   * SparseMatrix<number2> &, const AdditionalData &).
+   */
+  template <typename number2>
+  explicit SparseMatrixSELL(const SparseMatrix<number2> &matrix,
+                            const AdditionalData &data = AdditionalData());
+
+  /**
+   * Set up the slices and row permutation for the given sparsity pattern,
+   * which must be compressed. All values are set to zero; they can be
+   * filled by copy_from().
+   */
+  void
+  reinit(const SparsityPattern &sparsity,
+         const AdditionalData  &data = AdditionalData());
+
+  /**
+   * Set up the layout from the sparsity pattern of @p matrix and copy its
+   * values.
+   */
+  template <typename number2>
+  void
+  reinit(const SparseMatrix<number2> &matrix,
+         const AdditionalData        &data = AdditionalData());
+
+  /**
+   * Copy the values of @p matrix into the present object, keeping the
+   * layout. The matrix must be based on the same sparsity pattern as the one
+   * passed to the last call of reinit().
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename number2>
+  void
+  copy_from(const SparseMatrix<number2> &matrix);
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of rows of the matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of entries of the underlying sparsity pattern.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the number of stored entries including the zeros padded to the
+   * rows of each slice.
+   */
+  std::size_t
+  n_stored_elements() const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+   * matrix.
+   *
+   * Source and destination must not be the same vector.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication. Add $M*src$ on $dst$ with $M$ being
+   * this matrix.
+   *
+   * Source and destination must not be the same vector.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename VectorType>
+  void
+  vmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M^T*src$ with $M$ being this
+   * matrix. This function does the same as vmult() but takes the transposed
+   * matrix.
+   *
+   * Source and destination must not be the same vector.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication. Add $M^T*src$ to $dst$ with $M$
+   * being this matrix. This function does the same as vmult_add() but takes
+   * the transposed matrix.
+   *
+   * Source and destination must not be the same vector.
+   */
+  template <typename VectorType>
+  void
+  Tvmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Compute the residual of an equation <i>Mx=b</i>, where the residual is
+   * defined to be <i>r=b-Mx</i>. Write the residual into <tt>dst</tt>. The
+   * <i>l<sub>2</sub></i> norm of the residual vector is returned.
+   *
+   * Source <i>x</i> and destination <i>dst</i> must not be the same vector.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename VectorType>
+  typename VectorType::real_type
+  residual(VectorType &dst, const VectorType &x, const VectorType &b) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * @addtogroup Exceptions
+   * @{
+   */
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcDifferentSparsityPatterns,
+                   "The values of a SparseMatrixSELL can only be copied from "
+                   "a matrix that uses the sparsity pattern the layout was "
+                   "set up with.");
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcSourceEqualsDestination,
+                   "You are attempting an operation on two vectors that "
+                   "are the same object, but the operation requires that the "
+                   "two objects are in fact different.");
+  /** @} */
+
+private:
+  /**
+   * Compute the product of the slices in the range
+   * [begin_slice, end_slice) with @p src. If @p rhs is not a null pointer,
+   * the result is subtracted from @p rhs and written into @p dst, otherwise
+   * it is written or, if @p add is true, added into @p dst.
+   */
+  template <typename Number2>
+  void
+  vmult_on_slices(const size_type begin_slice,
+                  const size_type end_slice,
+                  const Number2  *src,
+                  Number2        *dst,
+                  const Number2  *rhs,
+                  const bool      add) const;
+
+  /**
+   * Number of rows of the matrix.
+   */
+  size_type n_rows;
+
+  /**
+   * Number of columns of the matrix.
+   */
+  size_type n_cols;
+
+  /**
+   * Number of entries of the sparsity pattern the matrix was built from.
+   */
+  std::size_t n_nonzeros;
+
+  /**
+   * The offset of each slice into @p values, in units of VectorizedArray
+   * entries. The length of slice @p s is given by
+   * <tt>slice_start[s+1]-slice_start[s]</tt>.
+   */
+  std::vector<std::size_t> slice_start;
+
+  /**
+   * The original row index of each lane of each slice, or
+   * numbers::invalid_dof_index for the lanes that fill up the last slice.
+   */
+  std::vector<size_type> row_indices;
+
+  /**
+   * The column indices, stored with a stride of chunk_size such that the
+   * indices of the $k$-th entries of the rows in slice @p s start at
+   * <tt>(slice_start[s]+k)*chunk_size</tt>.
+   */
+  AlignedVector<unsigned int> column_indices;
+
+  /**
+   * The values of the matrix in the sliced layout.
+   */
+  AlignedVector<VectorizedArray<number>> values;
+};
+
+/** @} */
+
+/* ---------------------------------- Inline functions ------------------- */
+
+#ifndef DOXYGEN
+
+template <typename number>
+inline SparseMatrixSELL<number>::AdditionalData::AdditionalData(
+  const unsigned int sigma)
+  : sigma(sigma)
+{}
+
+
+
+template <typename number>
+inline SparseMatrixSELL<number>::SparseMatrixSELL()
+  : n_rows(0)
+  , n_cols(0)
+  , n_nonzeros(0)
+{}
+
+
+
+template <typename number>
+template <typename number2>
+inline SparseMatrixSELL<number>::SparseMatrixSELL(
+  const SparseMatrix<number2> &matrix,
+  const AdditionalData        &data)
+  : SparseMatrixSELL()
+{
+  reinit(matrix, data);
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixSELL<number>::reinit(const SparsityPattern &sparsity,
+                                 const AdditionalData  &data)
+{
+  Assert(sparsity.is_compressed(), SparsityPattern::ExcNotCompressed());
+  Assert(data.sigma > 0, ExcMessage("The sorting window must not be empty."));
+  AssertThrow(sparsity.n_cols() <= std::numeric_limits<unsigned int>::max(),
+              ExcMessage("The number of columns of a SparseMatrixSELL must "
+                         "fit into an unsigned int."));
+
+  n_rows     = sparsity.n_rows();
+  n_cols     = sparsity.n_cols();
+  n_nonzeros = sparsity.n_nonzero_elements();
+
+  // sort the rows by decreasing length within windows of sigma rows. the
+  // sorting is stable, so rows of equal length stay in their original order
+  std::vector<size_type> permutation(n_rows);
+  std::iota(permutation.begin(), permutation.end(), size_type(0));
+  const size_type window =
+    data.sigma == numbers::invalid_unsigned_int ? n_rows : data.sigma;
+  for (size_type start = 0; start < n_rows; start += window)
+    std::stable_sort(permutation.begin() + start,
+                     permutation.begin() + std::min(start + window, n_rows),
+                     [&sparsity](const size_type a, const size_type b) {
+                       return sparsity.row_length(a) > sparsity.row_length(b);
+                     });
+
+  const size_type n_slices = (n_rows + chunk_size - 1) / chunk_size;
+  row_indices.assign(n_slices * chunk_size, numbers::invalid_dof_index);
+  std::copy(permutation.begin(), permutation.end(), row_indices.begin());
+
+  slice_start.resize(n_slices + 1);
+  slice_start[0] = 0;
+  for (size_type s = 0; s < n_slices; ++s)
+    {
+      unsigned int slice_length = 0;
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        if (row_indices[s * chunk_size + v] != numbers::invalid_dof_index)
+          slice_length = std::max(slice_length,
+                                  sparsity.row_length(
+                                    row_indices[s * chunk_size + v]));
+      slice_start[s + 1] = slice_start[s] + slice_length;
+    }
+
+  // fill the column indices. padded entries point to the last column of the
+  // respective row, which is an index that is accessed anyway, and get a
+  // zero value. empty rows and the lanes beyond the last row take the
+  // columns of the longest row of the slice, so that no other entries of
+  // the source vector are read
+  column_indices.resize_fast(slice_start.back() * chunk_size);
+  for (size_type s = 0; s < n_slices; ++s)
+    {
+      const size_type slice_length = slice_start[s + 1] - slice_start[s];
+      unsigned int   *slice_indices =
+        column_indices.begin() + slice_start[s] * chunk_size;
+      const auto is_empty = [&](const size_type row) {
+        return row == numbers::invalid_dof_index ||
+               sparsity.row_length(row) == 0;
+      };
+      unsigned int longest_lane = 0;
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        {
+          const size_type row = row_indices[s * chunk_size + v];
+          if (is_empty(row))
+            continue;
+          if (sparsity.row_length(row) == slice_length)
+            longest_lane = v;
+          unsigned int *index       = slice_indices + v;
+          unsigned int  last_column = 0;
+          for (auto entry = sparsity.begin(row); entry != sparsity.end(row);
+               ++entry, index += chunk_size)
+            {
+              last_column = entry->column();
+              *index      = last_column;
+            }
+          for (; index < slice_indices + slice_length * chunk_size;
+               index += chunk_size)
+            *index = last_column;
+        }
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        {
+          if (is_empty(row_indices[s * chunk_size + v]))
+            for (size_type k = 0; k < slice_length; ++k)
+              slice_indices[k * chunk_size + v] =
+                slice_indices[k * chunk_size + longest_lane];
+        }
+    }
+
+  values.resize_fast(slice_start.back());
+  values.fill(VectorizedArray<number>());
+}
+
+
+
+template <typename number>
+template <typename number2>
+inline void
+SparseMatrixSELL<number>::reinit(const SparseMatrix<number2> &matrix,
+                                 const AdditionalData        &data)
+{
+  reinit(matrix.get_sparsity_pattern(), data);
+  copy_from(matrix);
+}
+
+
+
+template <typename number>
+template <typename number2>
+inline void
+SparseMatrixSELL<number>::copy_from(const SparseMatrix<number2> &matrix)
+{
+  AssertDimension(matrix.m(), m());
+  AssertDimension(matrix.n(), n());
+  AssertDimension(matrix.n_nonzero_elements(), n_nonzero_elements());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    size_type(slice_start.size() - 1),
+    [this, &matrix](const size_type begin_slice, const size_type end_slice) {
+      for (size_type s = begin_slice; s < end_slice; ++s)
+        for (unsigned int v = 0; v < chunk_size; ++v)
+          {
+            const size_type row = row_indices[s * chunk_size + v];
+            if (row == numbers::invalid_dof_index)
+              continue;
+            VectorizedArray<number> *value = values.begin() + slice_start[s];
+            for (auto entry = matrix.begin(row); entry != matrix.end(row);
+                 ++entry, ++value)
+              {
+                Assert(column_indices[(value - values.begin()) * chunk_size +
+                                      v] == entry->column(),
+                       ExcDifferentSparsityPatterns());
+                (*value)[v] = number(entry->value());
+              }
+          }
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        chunk_size +
+      1);
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixSELL<number>::clear()
+{
+  n_rows     = 0;
+  n_cols     = 0;
+  n_nonzeros = 0;
+  slice_start.clear();
+  row_indices.clear();
+  column_indices.clear();
+  values.clear();
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::n() const
+{
+  return n_cols;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_nonzero_elements() const
+{
+  return n_nonzeros;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_stored_elements() const
+{
+  return values.size() * chunk_size;
+}
+
+
+
+template <typename number>
+template <typename Number2>
+inline void
+SparseMatrixSELL<number>::vmult_on_slices(const size_type begin_slice,
+                                          const size_type end_slice,
+                                          const Number2  *src,
+                                          Number2        *dst,
+                                          const Number2  *rhs,
+                                          const bool      add) const
+{
+  for (size_type s = begin_slice; s < end_slice; ++s)
+    {
+      const VectorizedArray<number> *value = values.begin() + slice_start[s];
+      const VectorizedArray<number> *const end_value =
+        values.begin() + slice_start[s + 1];
+      const unsigned int *index =
+        column_indices.begin() + slice_start[s] * chunk_size;
+
+      Number2 result[chunk_size];
+      if constexpr (std::is_same_v<Number2, number>)
+        {
+          VectorizedArray<number> sum = number();
+          for (; value != end_value; ++value, index += chunk_size)
+            {
+              VectorizedArray<number> src_values;
+              src_values.gather(src, index);
+              sum += *value * src_values;
+            }
+          sum.store(result);
+        }
+      else
+        {
+          for (unsigned int v = 0; v < chunk_size; ++v)
+            result[v] = Number2();
+          for (; value != end_value; ++value, index += chunk_size)
+            for (unsigned int v = 0; v < chunk_size; ++v)
+              result[v] += Number2((*value)[v]) * src[index[v]];
+        }
+
+      const size_type *rows = row_indices.data() + s * chunk_size;
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        if (rows[v] != numbers::invalid_dof_index)
+          {
+            if (rhs != nullptr)
+              dst[rows[v]] = rhs[rows[v]] - result[v];
+            else if (add)
+              dst[rows[v]] += result[v];
+            else
+              dst[rows[v]] = result[v];
+          }
+    }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixSELL<number>::vmult(VectorType &dst, const VectorType &src) const
+{
+  Assert(m() == 0 || !slice_start.empty(), ExcNotInitialized());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    size_type(row_indices.size() / chunk_size),
+    [this, &src, &dst](const size_type begin_slice, const size_type end_slice) {
+      vmult_on_slices(begin_slice,
+                      end_slice,
+                      src.begin(),
+                      dst.begin(),
+                      static_cast<const typename VectorType::value_type *>(
+                        nullptr),
+                      false);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        chunk_size +
+      1);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixSELL<number>::vmult_add(VectorType       &dst,
+                                    const VectorType &src) const
+{
+  Assert(m() == 0 || !slice_start.empty(), ExcNotInitialized());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    size_type(row_indices.size() / chunk_size),
+    [this, &src, &dst](const size_type begin_slice, const size_type end_slice) {
+      vmult_on_slices(begin_slice,
+                      end_slice,
+                      src.begin(),
+                      dst.begin(),
+                      static_cast<const typename VectorType::value_type *>(
+                        nullptr),
+                      true);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        chunk_size +
+      1);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixSELL<number>::Tvmult(VectorType &dst, const VectorType &src) const
+{
+  dst = 0;
+  Tvmult_add(dst, src);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixSELL<number>::Tvmult_add(VectorType       &dst,
+                                     const VectorType &src) const
+{
+  Assert(m() == 0 || !slice_start.empty(), ExcNotInitialized());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  using Number2 = typename VectorType::value_type;
+
+  // the rows of a slice may share columns, so the transposed product is not
+  // split among threads, just like SparseMatrix::Tvmult_add()
+  const size_type n_slices = row_indices.size() / chunk_size;
+  for (size_type s = 0; s < n_slices; ++s)
+    {
+      Number2          src_values[chunk_size];
+      const size_type *rows = row_indices.data() + s * chunk_size;
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        src_values[v] =
+          rows[v] != numbers::invalid_dof_index ? src(rows[v]) : Number2();
+
+      const unsigned int *index = column_indices.begin() +
+                                  slice_start[s] * chunk_size;
+      for (std::size_t k = slice_start[s]; k < slice_start[s + 1];
+           ++k, index += chunk_size)
+        for (unsigned int v = 0; v < chunk_size; ++v)
+          dst(index[v]) += Number2(values[k][v]) * src_values[v];
+    }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline typename VectorType::real_type
+SparseMatrixSELL<number>::residual(VectorType       &dst,
+                                   const VectorType &x,
+                                   const VectorType &b) const
+{
+  Assert(m() == 0 || !slice_start.empty(), ExcNotInitialized());
+  AssertDimension(dst.size(), m());
+  AssertDimension(b.size(), m());
+  AssertDimension(x.size(), n());
+  Assert(!PointerComparison::equal(&x, &dst), ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    size_type(row_indices.size() / chunk_size),
+    [this, &x, &b, &dst](const size_type begin_slice,
+                         const size_type end_slice) {
+      vmult_on_slices(
+        begin_slice, end_slice, x.begin(), dst.begin(), b.begin(), false);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+        chunk_size +
+      1);
+
+  return dst.l2_norm();
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(slice_start) +
+         MemoryConsumption::memory_consumption(row_indices) +
+         column_indices.memory_consumption() + values.memory_consumption();
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
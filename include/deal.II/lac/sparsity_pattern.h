@@ -36,6 +36,7 @@
 #include <boost/serialization/split_member.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -47,6 +48,7 @@ DEAL_II_NAMESPACE_OPEN
 class SparsityPattern;
 class DynamicSparsityPattern;
 class ChunkSparsityPattern;
+class ThreadLocalSparsityPattern;
 template <typename number>
 class FullMatrix;
 template <typename number>
@@ -682,6 +684,17 @@ public:
   void
   copy_from(const DynamicSparsityPattern &dsp);
 
+  /**
+   * Copy data from a ThreadLocalSparsityPattern, merging the entries the
+   * different threads have added. The rows are processed in parallel, first
+   * to count the entries of each row and then to write them into the arrays
+   * of this object. The ThreadLocalSparsityPattern must be compressed.
+   * Previous content of this object is lost, and the sparsity pattern is in
+   * compressed mode afterwards.
+   */
+  void
+  copy_from(const ThreadLocalSparsityPattern &tlsp);
+
   /**
    * Copy data from a SparsityPattern. Previous content of this object is
    * lost, and the sparsity pattern is in compressed mode afterwards.
@@ -849,6 +862,36 @@ public:
   unsigned int
   row_length(const size_type row) const;
 
+  /**
+   * Compute and store, in addition to the column indices, the distance
+   * $j-i$ of the column index $j$ of each entry from its row index $i$ as a
+   * 32-bit integer. SparseMatrix::vmult(), SparseMatrix::vmult_add(),
+   * SparseMatrix::residual() and SparseILU::vmult() then read these relative
+   * column indices instead of the full column indices. If deal.II is
+   * configured with 64-bit indices, i.e., types::global_dof_index is a
+   * 64-bit integer, this reduces the index data read per nonzero entry in
+   * these memory bandwidth bound functions from 8 to 4 bytes, at the cost of
+   * storing the additional array. With 32-bit indices, there is no benefit.
+   *
+   * If the distance of some entry from the diagonal does not fit into a
+   * 32-bit signed integer, nothing is stored, which can be queried via
+   * has_relative_column_indices(). The relative column indices are deleted
+   * by all functions that change the sparsity pattern, like reinit(),
+   * copy_from() or compress().
+   *
+   * This function may only be called for a compressed sparsity pattern.
+   */
+  void
+  compute_relative_column_indices();
+
+  /**
+   * Return whether relative column indices have been computed by
+   * compute_relative_column_indices() for the current layout of the sparsity
+   * pattern.
+   */
+  bool
+  has_relative_column_indices() const;
+
   /**
    * Determine an estimate for the memory consumption (in bytes) of this
    * object. See MemoryConsumption.
@@ -1145,6 +1188,14 @@ private:
    */
   std::unique_ptr<size_type[]> colnums;
 
+  /**
+   * Array of the column numbers of all entries relative to their row, i.e.,
+   * entry <i>p</i> of row <i>r</i> stores #colnums[<i>p</i>]-<i>r</i>. This
+   * array is only allocated by compute_relative_column_indices() and has
+   * the size #rowstart[#rows] in that case.
+   */
+  std::unique_ptr<std::int32_t[]> relative_colnums;
+
   /**
    * Store whether the compress() function was called for this object.
    */
@@ -1331,6 +1382,14 @@ SparsityPattern::stores_only_added_elements() const
 
 
 
+inline bool
+SparsityPattern::has_relative_column_indices() const
+{
+  return relative_colnums != nullptr;
+}
+
+
+
 inline unsigned int
 SparsityPattern::row_length(const size_type row) const
 {
@@ -1558,6 +1617,7 @@ SparsityPattern::load(Archive &ar, const unsigned int)
     }
   else
     colnums.reset();
+  relative_colnums.reset();
   ar &store_diagonal_first_in_row;
 }
 
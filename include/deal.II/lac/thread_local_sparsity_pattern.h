@@ -0,0 +1,248 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_thread_local_sparsity_pattern_h
+#define dealii_thread_local_sparsity_pattern_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/thread_local_storage.h>
+
+#include <deal.II/lac/sparsity_pattern_base.h>
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declaration
+#ifndef DOXYGEN
+class SparsityPattern;
+#endif
+
+/**
+ * @addtogroup Sparsity
+ * @{
+ */
+
+/**
+ * A sparsity pattern into which several threads can write at the same time,
+ * intended as the intermediate object between the assembly of the
+ * couplings, e.g. by DoFTools::make_sparsity_pattern(), and the final
+ * SparsityPattern.
+ *
+ * Unlike DynamicSparsityPattern, which stores one sorted array of column
+ * indices per row and can therefore only be filled by one thread at a time,
+ * this class gives every thread that adds entries its own buffer of
+ * (row, column) pairs. Adding entries hence needs no synchronization between
+ * the threads. Each buffer is sorted and stripped of duplicates whenever it
+ * has grown by a sizable amount since the last time, so its size stays
+ * proportional to the number of distinct entries the thread has added.
+ *
+ * SparsityPattern::copy_from() then merges the buffers in two passes over
+ * blocks of rows that run in parallel: the first pass counts the distinct
+ * entries per row, the second one writes the column indices directly into
+ * the arrays of the SparsityPattern. This avoids building the complete
+ * pattern twice, as happens when first filling a DynamicSparsityPattern and
+ * then copying it.
+ *
+ * A typical use looks as follows:
+ * @code
+ *   ThreadLocalSparsityPattern tlsp(dof_handler.n_dofs(),
+ *                                   dof_handler.n_dofs());
+ *   DoFTools::make_sparsity_pattern(dof_handler, tlsp, constraints, false);
+ *
+ *   SparsityPattern sparsity_pattern;
+ *   sparsity_pattern.copy_from(tlsp);
+ * @endcode
+ * The functions in DoFTools that build sparsity patterns detect objects of
+ * this type and then loop over the cells in parallel.
+ *
+ * Only the functions adding entries may be called concurrently. The object
+ * can not be queried for its entries; it is only meant to be converted into
+ * a SparsityPattern.
+ */
+class ThreadLocalSparsityPattern : public SparsityPatternBase
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Constructor. Sets up an empty (zero-by-zero) object.
+   */
+  ThreadLocalSparsityPattern();
+
+  /**
+   * Constructor. Sets up an empty object representing a @p m by @p n
+   * pattern.
+   */
+  ThreadLocalSparsityPattern(const size_type m, const size_type n);
+
+  /**
+   * The thread buffers are tied to the object, so copying is not supported.
+   */
+  ThreadLocalSparsityPattern(const ThreadLocalSparsityPattern &) = delete;
+
+  /**
+   * Copy assignment is not supported either.
+   */
+  ThreadLocalSparsityPattern &
+  operator=(const ThreadLocalSparsityPattern &) = delete;
+
+  /**
+   * Remove all entries and set the size to @p m by @p n.
+   */
+  void
+  reinit(const size_type m, const size_type n);
+
+  /**
+   * Add the entry (@p i, @p j). This function can be called concurrently
+   * from several threads.
+   */
+  void
+  add(const size_type i, const size_type j);
+
+  /**
+   * Add the given column indices to row @p row. This function can be called
+   * concurrently from several threads.
+   */
+  virtual void
+  add_row_entries(const size_type                  &row,
+                  const ArrayView<const size_type> &columns,
+                  const bool indices_are_sorted = false) override;
+
+  /**
+   * Add a list of (row, column) pairs. This function can be called
+   * concurrently from several threads.
+   */
+  virtual void
+  add_entries(const ArrayView<const std::pair<size_type, size_type>> &entries)
+    override;
+
+  /**
+   * Sort all thread buffers and remove duplicates in them, in parallel.
+   * This function must be called after the last entry has been added and
+   * before SparsityPattern::copy_from(), and not while other threads add
+   * entries. The functions in DoFTools call it at their end.
+   */
+  void
+  compress();
+
+  /**
+   * Return whether all buffers are sorted and free of duplicates, i.e.,
+   * whether compress() has been called after the last entry was added.
+   */
+  bool
+  is_compressed() const;
+
+  /**
+   * Return the number of thread buffers that have been created.
+   */
+  unsigned int
+  n_buffers() const;
+
+  /**
+   * Return an estimate of the memory used by this object, in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The entries added by one thread.
+   */
+  struct Buffer
+  {
+    /**
+     * The (row, column) pairs. Sorted and free of duplicates after a call
+     * to compress().
+     */
+    std::vector<std::pair<size_type, size_type>> entries;
+
+    /**
+     * Size of #entries beyond which the buffer is compressed again.
+     */
+    std::size_t compress_threshold;
+
+    /**
+     * Whether #entries is sorted and free of duplicates.
+     */
+    bool is_compressed;
+
+    /**
+     * Sort the entries, remove duplicates, and update the threshold.
+     */
+    void
+    compress();
+  };
+
+  /**
+   * Return the buffer of the current thread, creating it if necessary.
+   */
+  Buffer &
+  get_buffer();
+
+  /**
+   * The buffers of all threads that have added entries so far.
+   */
+  std::vector<std::unique_ptr<Buffer>> buffers;
+
+  /**
+   * Pointer from each thread to its element in #buffers.
+   */
+  Threads::ThreadLocalStorage<Buffer *> thread_buffer;
+
+  /**
+   * Mutex for creating new elements in #buffers.
+   */
+  std::mutex buffer_mutex;
+
+  friend class SparsityPattern;
+};
+
+/**
+ * @}
+ */
+
+
+/* ---------------------------- Inline functions ---------------------------- */
+
+#ifndef DOXYGEN
+
+inline void
+ThreadLocalSparsityPattern::add(const size_type i, const size_type j)
+{
+  AssertIndexRange(i, n_rows());
+  AssertIndexRange(j, n_cols());
+
+  Buffer &buffer = get_buffer();
+  buffer.entries.emplace_back(i, j);
+  buffer.is_compressed = false;
+  if (buffer.entries.size() > buffer.compress_threshold)
+    buffer.compress();
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -20,15 +20,29 @@
 
 #include <deal.II/base/mutex.h>
 #include <deal.II/base/smartpointer.h>
+#include <deal.II/base/template_constraints.h>
 
 #include <deal.II/lac/vector.h>
 
 #include <iostream>
+#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
+// forward declarations
+#ifndef DOXYGEN
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
+#endif
 
 /**
  * @addtogroup VMemory
@@ -149,6 +163,26 @@ public:
   virtual void
   free(const VectorType *const) = 0;
 
+  /**
+   * Return a pointer to a vector that has been reinitialized with the layout
+   * of @p model, i.e., the result of calling
+   * <code>v->reinit(model, omit_zeroing_entries)</code> on a vector obtained
+   * from alloc(). This is how iterative solvers set up their temporary
+   * vectors, and derived classes can use the information about the layout to
+   * return a vector that already has the right size and does not need to
+   * allocate new memory in reinit().
+   *
+   * The default implementation calls alloc() followed by reinit(). It is
+   * only available for vector types that provide a function
+   * <code>reinit(const VectorType &, const bool)</code>.
+   *
+   * The same warning as for alloc() applies, i.e., you should consider using
+   * the VectorMemory::Pointer class instead of calling this function
+   * directly.
+   */
+  virtual VectorType *
+  alloc_like(const VectorType &model, const bool omit_zeroing_entries);
+
   /**
    * @addtogroup Exceptions
    * @{
@@ -216,6 +250,15 @@ public:
      */
     Pointer(VectorMemory<VectorType> &mem);
 
+    /**
+     * Constructor. This constructor automatically allocates a vector from
+     * the given vector memory object @p mem and reinitializes it with the
+     * layout of @p model, see VectorMemory::alloc_like().
+     */
+    Pointer(VectorMemory<VectorType> &mem,
+            const VectorType         &model,
+            const bool                omit_zeroing_entries = false);
+
     /**
      * Destructor, automatically releasing the vector from the memory pool.
      */
@@ -308,6 +351,32 @@ public:
  * GrowingVectorMemory object whenever needed without the performance penalty
  * of creating a new memory pool every time. A drawback of this policy is that
  * vectors once allocated are only released at the end of the program run.
+ *
+ * <h3>Reuse of vectors with the same layout</h3>
+ *
+ * Nested solvers, like an inner conjugate gradient method on each level of a
+ * multigrid hierarchy within an outer Schur complement solver, allocate and
+ * release many temporary vectors of different sizes. If the pool handed out
+ * an arbitrary unused vector, a vector last used on one level would often
+ * be reinitialized for another level and would have to reallocate its
+ * memory. To avoid this, the pool sorts the unused vectors into buckets by
+ * their layout, described by their size and, for
+ * LinearAlgebra::distributed::Vector, the address of their partitioner. The
+ * function alloc_like(), which is used by the solvers through the
+ * VectorMemory::Pointer class, then prefers a vector of the bucket that
+ * matches the layout of the given model vector. For such a vector, the
+ * subsequent call to reinit() neither allocates memory nor sets up a new
+ * partitioner. Since the pool is shared by all objects of this class for
+ * the same vector type, the vectors returned by an inner solver are
+ * directly reused by the next inner solve on the same level, regardless of
+ * which object or thread requests them.
+ *
+ * All operations on the pool run in a time that is logarithmic in the number
+ * of vectors in the pool, so that the lock protecting the pool is only held
+ * for a short time. The number of requests that could be served by a vector
+ * of matching layout, the number of requests that could not, and the memory
+ * held by the pool are recorded and can be queried by get_statistics() for
+ * tuning purposes.
  */
 template <typename VectorType = dealii::Vector<double>>
 class GrowingVectorMemory : public VectorMemory<VectorType>
@@ -374,12 +443,75 @@ public:
   virtual void
   free(const VectorType *const) override;
 
+  /**
+   * Return a pointer to a vector that has been reinitialized with the layout
+   * of @p model. The function prefers an unused vector whose layout already
+   * matches the one of @p model, see the class documentation.
+   *
+   * The same warning as for alloc() applies, i.e., you should consider using
+   * the VectorMemory::Pointer class instead of calling this function
+   * directly.
+   */
+  virtual VectorType *
+  alloc_like(const VectorType &model,
+             const bool        omit_zeroing_entries) override;
+
   /**
    * Release all vectors that are not currently in use.
    */
   static void
   release_unused_memory();
 
+  /**
+   * A structure collecting statistics of the usage of the pool shared by all
+   * GrowingVectorMemory objects of the same vector type.
+   */
+  struct Statistics
+  {
+    /**
+     * Number of calls to alloc_like() that were served by an unused vector
+     * with a layout matching the model vector.
+     */
+    std::size_t n_hits;
+
+    /**
+     * Number of calls to alloc_like() that had to reinitialize an unused
+     * vector of different layout or to create a new vector.
+     */
+    std::size_t n_misses;
+
+    /**
+     * Number of vectors currently held by the pool, whether in use or not.
+     */
+    std::size_t n_vectors;
+
+    /**
+     * Memory held by the vectors of the pool in bytes. The memory of a
+     * vector is recorded when it is returned to the pool and when it is
+     * handed out by alloc_like().
+     */
+    std::size_t memory;
+
+    /**
+     * Maximum of the memory held by the pool since the start of the program
+     * or the last call to reset_statistics(), in bytes.
+     */
+    std::size_t peak_memory;
+  };
+
+  /**
+   * Return the statistics of the pool for the current vector type.
+   */
+  static Statistics
+  get_statistics();
+
+  /**
+   * Reset the counters of hits and misses and set the peak memory to the
+   * memory currently held by the pool.
+   */
+  static void
+  reset_statistics();
+
   /**
    * Memory consumed by this class and all currently allocated vectors.
    */
@@ -387,13 +519,35 @@ public:
   memory_consumption() const;
 
 private:
+  /**
+   * A type that describes the layout of a vector: its size and, if
+   * applicable, the address of the object describing its parallel
+   * partitioning.
+   */
+  using layout_type = std::pair<types::global_dof_index, const void *>;
+
   /**
    * A type that describes this entries of an array that represents
-   * the vectors stored by this object. The first component of the pair
-   * is be a flag telling whether the vector is used, the second
-   * a pointer to the vector itself.
+   * the vectors stored by this object.
    */
-  using entry_type = std::pair<bool, std::unique_ptr<VectorType>>;
+  struct entry_type
+  {
+    /**
+     * A flag telling whether the vector is used.
+     */
+    bool in_use;
+
+    /**
+     * A pointer to the vector itself.
+     */
+    std::unique_ptr<VectorType> vector;
+
+    /**
+     * The memory consumption of the vector at the time it was last
+     * handed out by alloc_like() or returned to the pool.
+     */
+    std::size_t memory;
+  };
 
   /**
    * The class providing the actual storage for the memory pool.
@@ -420,10 +574,35 @@ private:
     void
     initialize(const size_type size);
 
+    /**
+     * Mark the vector at position @p index of the storage object as unused,
+     * with the given layout and memory consumption.
+     */
+    void
+    release(const std::size_t  index,
+            const layout_type &layout,
+            const std::size_t  memory);
+
     /**
      * Pointer to the storage object
      */
     std::vector<entry_type> *data;
+
+    /**
+     * The position of each vector within the storage object.
+     */
+    std::map<const VectorType *, std::size_t> indices;
+
+    /**
+     * The positions of the vectors that are currently not in use, sorted by
+     * the layout of the vectors.
+     */
+    std::multimap<layout_type, std::size_t> unused_vectors;
+
+    /**
+     * The statistics of this pool.
+     */
+    Statistics statistics;
   };
 
   /**
@@ -464,7 +643,54 @@ namespace internal
   {
     void
     release_all_unused_memory();
-  }
+
+    template <typename VectorType>
+    using reinit_like_t = decltype(std::declval<VectorType &>().reinit(
+      std::declval<const VectorType &>(),
+      std::declval<bool>()));
+
+    /**
+     * Reinitialize @p vector with the layout of @p model, for vector types
+     * that support this operation.
+     */
+    template <typename VectorType>
+    void
+    reinit_like(VectorType       &vector,
+                const VectorType &model,
+                const bool        omit_zeroing_entries)
+    {
+      if constexpr (is_supported_operation<reinit_like_t, VectorType>)
+        vector.reinit(model, omit_zeroing_entries);
+      else
+        {
+          (void)vector;
+          (void)model;
+          (void)omit_zeroing_entries;
+          AssertThrow(false, ExcNotImplemented());
+        }
+    }
+
+    /**
+     * Return a value identifying the parallel partitioning of @p vector,
+     * which together with its size describes the layout of a vector. This
+     * is the address of the partitioner for vector types that share their
+     * partitioner between vectors, and @p nullptr otherwise.
+     */
+    template <typename VectorType>
+    const void *
+    get_partitioner_address(const VectorType &)
+    {
+      return nullptr;
+    }
+
+    template <typename Number, typename MemorySpace>
+    const void *
+    get_partitioner_address(
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace> &vector)
+    {
+      return vector.get_partitioner().get();
+    }
+  } // namespace GrowingVectorMemoryImplementation
 } // namespace internal
 
 /** @} */
@@ -482,6 +708,39 @@ inline VectorMemory<VectorType>::Pointer::Pointer(VectorMemory<VectorType> &mem)
 
 
 
+template <typename VectorType>
+inline VectorMemory<VectorType>::Pointer::Pointer(
+  VectorMemory<VectorType> &mem,
+  const VectorType         &model,
+  const bool                omit_zeroing_entries)
+  : std::unique_ptr<VectorType, std::function<void(VectorType *)>>(
+      mem.alloc_like(model, omit_zeroing_entries),
+      [&mem](VectorType *v) { mem.free(v); })
+{}
+
+
+
+template <typename VectorType>
+VectorType *
+VectorMemory<VectorType>::alloc_like(const VectorType &model,
+                                     const bool        omit_zeroing_entries)
+{
+  VectorType *v = alloc();
+  try
+    {
+      internal::GrowingVectorMemoryImplementation::reinit_like(
+        *v, model, omit_zeroing_entries);
+    }
+  catch (...)
+    {
+      free(v);
+      throw;
+    }
+  return v;
+}
+
+
+
 template <typename VectorType>
 VectorType *
 PrimitiveVectorMemory<VectorType>::alloc()
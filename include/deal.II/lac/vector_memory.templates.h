@@ -24,6 +24,7 @@
 
 #include <deal.II/lac/vector_memory.h>
 
+#include <algorithm>
 #include <memory>
 
 DEAL_II_NAMESPACE_OPEN
@@ -61,6 +62,7 @@ Threads::Mutex GrowingVectorMemory<VectorType>::mutex;
 template <typename VectorType>
 inline GrowingVectorMemory<VectorType>::Pool::Pool()
   : data(nullptr)
+  , statistics{0, 0, 0, 0, 0}
 {}
 
 
@@ -87,17 +89,41 @@ GrowingVectorMemory<VectorType>::Pool::initialize(const size_type size)
     {
       data = new std::vector<entry_type>(size);
 
-      for (typename std::vector<entry_type>::iterator i = data->begin();
-           i != data->end();
-           ++i)
+      for (std::size_t i = 0; i < data->size(); ++i)
         {
-          i->first  = false;
-          i->second = std::make_unique<VectorType>();
+          entry_type &entry = (*data)[i];
+          entry.vector      = std::make_unique<VectorType>();
+          entry.memory      = 0;
+          indices.emplace(entry.vector.get(), i);
+          release(i,
+                  layout_type(entry.vector->size(),
+                              internal::GrowingVectorMemoryImplementation::
+                                get_partitioner_address(*entry.vector)),
+                  MemoryConsumption::memory_consumption(*entry.vector));
         }
+      statistics.n_vectors = data->size();
     }
 }
 
 
+
+template <typename VectorType>
+inline void
+GrowingVectorMemory<VectorType>::Pool::release(const std::size_t  index,
+                                               const layout_type &layout,
+                                               const std::size_t  memory)
+{
+  entry_type &entry = (*data)[index];
+  entry.in_use      = false;
+  unused_vectors.emplace(layout, index);
+
+  statistics.memory      = statistics.memory - entry.memory + memory;
+  statistics.peak_memory = std::max(statistics.peak_memory, statistics.memory);
+  entry.memory           = memory;
+}
+
+
+
 template <typename VectorType>
 inline GrowingVectorMemory<VectorType>::GrowingVectorMemory(
   const size_type initial_size,
@@ -142,22 +168,92 @@ GrowingVectorMemory<VectorType>::alloc()
   ++total_alloc;
   ++current_alloc;
 
+  Pool &pool = get_pool();
+
   // See if there is a currently unused vector available in our list
-  for (entry_type &i : *get_pool().data)
+  if (pool.unused_vectors.empty() == false)
     {
-      if (i.first == false)
-        {
-          i.first = true;
-          return i.second.get();
-        }
+      const std::size_t index = pool.unused_vectors.begin()->second;
+      pool.unused_vectors.erase(pool.unused_vectors.begin());
+      (*pool.data)[index].in_use = true;
+      return (*pool.data)[index].vector.get();
     }
 
   // No currently unused vector found, so let's just allocate a new one
   // and return it:
   const auto &new_entry =
-    get_pool().data->emplace_back(true, std::make_unique<VectorType>());
+    pool.data->emplace_back(entry_type{true, std::make_unique<VectorType>(), 0});
+  pool.indices.emplace(new_entry.vector.get(), pool.data->size() - 1);
+  pool.statistics.n_vectors = pool.data->size();
 
-  return new_entry.second.get();
+  return new_entry.vector.get();
+}
+
+
+
+template <typename VectorType>
+inline VectorType *
+GrowingVectorMemory<VectorType>::alloc_like(const VectorType &model,
+                                            const bool omit_zeroing_entries)
+{
+  const layout_type layout(
+    model.size(),
+    internal::GrowingVectorMemoryImplementation::get_partitioner_address(
+      model));
+
+  VectorType *v = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    Pool &pool = get_pool();
+
+    const auto match = pool.unused_vectors.find(layout);
+    if (match != pool.unused_vectors.end())
+      {
+        ++total_alloc;
+        ++current_alloc;
+        ++pool.statistics.n_hits;
+
+        (*pool.data)[match->second].in_use = true;
+        v = (*pool.data)[match->second].vector.get();
+        pool.unused_vectors.erase(match);
+      }
+  }
+
+  // For a vector of matching layout, reinit() only needs to set the
+  // entries. Otherwise, take any vector from the pool and record the memory
+  // it holds after reinitialization.
+  const bool is_hit = (v != nullptr);
+  if (is_hit == false)
+    v = alloc();
+
+  try
+    {
+      internal::GrowingVectorMemoryImplementation::reinit_like(
+        *v, model, omit_zeroing_entries);
+    }
+  catch (...)
+    {
+      free(v);
+      throw;
+    }
+
+  if (is_hit == false)
+    {
+      const std::size_t memory = MemoryConsumption::memory_consumption(*v);
+
+      std::lock_guard<std::mutex> lock(mutex);
+
+      Pool       &pool  = get_pool();
+      entry_type &entry = (*pool.data)[pool.indices[v]];
+      ++pool.statistics.n_misses;
+      pool.statistics.memory = pool.statistics.memory - entry.memory + memory;
+      pool.statistics.peak_memory =
+        std::max(pool.statistics.peak_memory, pool.statistics.memory);
+      entry.memory = memory;
+    }
+
+  return v;
 }
 
 
@@ -166,17 +262,23 @@ template <typename VectorType>
 inline void
 GrowingVectorMemory<VectorType>::free(const VectorType *const v)
 {
+  // Determine the layout of the vector before acquiring the lock, since the
+  // vector is still owned by the caller
+  const layout_type layout(
+    v->size(),
+    internal::GrowingVectorMemoryImplementation::get_partitioner_address(*v));
+  const std::size_t memory = MemoryConsumption::memory_consumption(*v);
+
   std::lock_guard<std::mutex> lock(mutex);
 
   // Find the vector to be de-allocated and mark it as now unused:
-  for (entry_type &i : *get_pool().data)
+  Pool      &pool  = get_pool();
+  const auto entry = pool.indices.find(v);
+  if (entry != pool.indices.end() && (*pool.data)[entry->second].in_use)
     {
-      if (v == i.second.get())
-        {
-          i.first = false;
-          --current_alloc;
-          return;
-        }
+      pool.release(entry->second, layout, memory);
+      --current_alloc;
+      return;
     }
 
   // If we got here, someone is trying to free a vector that has not
@@ -192,8 +294,40 @@ GrowingVectorMemory<VectorType>::release_unused_memory()
 {
   std::lock_guard<std::mutex> lock(mutex);
 
-  if (get_pool().data != nullptr)
-    get_pool().data->clear();
+  Pool &pool = get_pool();
+  if (pool.data != nullptr)
+    {
+      pool.data->clear();
+      pool.indices.clear();
+      pool.unused_vectors.clear();
+      pool.statistics.n_vectors = 0;
+      pool.statistics.memory    = 0;
+    }
+}
+
+
+
+template <typename VectorType>
+inline typename GrowingVectorMemory<VectorType>::Statistics
+GrowingVectorMemory<VectorType>::get_statistics()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  return get_pool().statistics;
+}
+
+
+
+template <typename VectorType>
+inline void
+GrowingVectorMemory<VectorType>::reset_statistics()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Statistics &statistics = get_pool().statistics;
+  statistics.n_hits      = 0;
+  statistics.n_misses    = 0;
+  statistics.peak_memory = statistics.memory;
 }
 
 
@@ -205,9 +339,11 @@ GrowingVectorMemory<VectorType>::memory_consumption() const
   std::lock_guard<std::mutex> lock(mutex);
 
   std::size_t result = sizeof(*this);
-  for (const auto &[_, ptr] : *get_pool().data)
-    result += sizeof(ptr) + (ptr ? MemoryConsumption::memory_consumption(*ptr) :
-                                   MemoryConsumption::memory_consumption(ptr));
+  for (const entry_type &entry : *get_pool().data)
+    result += sizeof(entry.vector) +
+              (entry.vector ?
+                 MemoryConsumption::memory_consumption(*entry.vector) :
+                 MemoryConsumption::memory_consumption(entry.vector));
 
   return result;
 }
@@ -160,7 +160,12 @@ namespace internal
 
   /**
    * Specialization for MatrixFreeFunctions::tensor_none, which cannot use the
-   * sum-factorization kernels.
+   * sum-factorization kernels. For wedge elements described by
+   * MatrixFreeFunctions::WedgeShapeData, the interpolation is split into a
+   * dense product on the triangle and a one-dimensional product in z
+   * direction, which needs fewer operations than the dense product with the
+   * full shape function matrix. This data is only set up for FE_WedgeP of
+   * degree 2; for degree 1, the dense product is cheaper.
    */
   template <int dim, int fe_degree, int n_q_points_1d, typename Number>
   struct FEEvaluationImpl<MatrixFreeFunctions::tensor_none,
@@ -181,6 +186,20 @@ namespace internal
               Number                                *values_dofs_actual,
               FEEvaluationData<dim, Number, false>  &fe_eval,
               const bool                             add_into_values_array);
+
+  private:
+    static void
+    evaluate_wedge(const unsigned int                     n_components,
+                   const EvaluationFlags::EvaluationFlags evaluation_flag,
+                   const Number                          *values_dofs_actual,
+                   FEEvaluationData<dim, Number, false>  &fe_eval);
+
+    static void
+    integrate_wedge(const unsigned int                     n_components,
+                    const EvaluationFlags::EvaluationFlags integration_flag,
+                    Number                                *values_dofs_actual,
+                    FEEvaluationData<dim, Number, false>  &fe_eval,
+                    const bool add_into_values_array);
   };
 
 
@@ -622,6 +641,15 @@ namespace internal
   {
     Assert(!(evaluation_flag & EvaluationFlags::hessians), ExcNotImplemented());
 
+    if (!fe_eval.get_shape_info().wedge_data.empty())
+      {
+        evaluate_wedge(n_components,
+                       evaluation_flag,
+                       values_dofs_actual,
+                       fe_eval);
+        return;
+      }
+
     const std::size_t n_dofs =
       fe_eval.get_shape_info().dofs_per_component_on_cell;
     const std::size_t n_q_points = fe_eval.get_shape_info().n_q_points;
@@ -690,6 +718,16 @@ namespace internal
     Assert(!(integration_flag & EvaluationFlags::hessians),
            ExcNotImplemented());
 
+    if (!fe_eval.get_shape_info().wedge_data.empty())
+      {
+        integrate_wedge(n_components,
+                        integration_flag,
+                        values_dofs_actual,
+                        fe_eval,
+                        add_into_values_array);
+        return;
+      }
+
     const std::size_t n_dofs =
       fe_eval.get_shape_info().dofs_per_component_on_cell;
     const std::size_t n_q_points = fe_eval.get_shape_info().n_q_points;
@@ -760,6 +798,235 @@ namespace internal
 
 
 
+  template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+  inline void
+  FEEvaluationImpl<MatrixFreeFunctions::tensor_none,
+                   dim,
+                   fe_degree,
+                   n_q_points_1d,
+                   Number>::
+    evaluate_wedge(const unsigned int                     n_components,
+                   const EvaluationFlags::EvaluationFlags evaluation_flag,
+                   const Number                          *values_dofs_actual,
+                   FEEvaluationData<dim, Number, false>  &fe_eval)
+  {
+    using Number2 =
+      typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
+    const MatrixFreeFunctions::WedgeShapeData<Number2> &wedge_data =
+      fe_eval.get_shape_info().wedge_data;
+
+    const unsigned int n_dofs_t   = wedge_data.n_dofs_triangle;
+    const unsigned int n_dofs_l   = wedge_data.n_dofs_line;
+    const unsigned int n_q_t      = wedge_data.n_q_points_triangle;
+    const unsigned int n_q_l      = wedge_data.n_q_points_line;
+    const unsigned int n_dofs     = n_dofs_t * n_dofs_l;
+    const unsigned int n_q_points = n_q_t * n_q_l;
+
+    // unknowns in the numbering of the product, followed by the result of
+    // the product on the triangle for all shape functions on the line
+    Number *dofs_tensor = fe_eval.get_scratch_data().begin();
+    Number *temp        = dofs_tensor + n_dofs;
+    Assert(n_dofs + n_dofs_l * n_q_t <= fe_eval.get_scratch_data().size(),
+           ExcInternalError());
+
+    // product on the triangle for all shape functions on the line, with the
+    // loop over the quadrature points innermost to access contiguous data
+    const auto apply_triangle = [&](const Number2 *shape) {
+      for (unsigned int l = 0; l < n_dofs_l; ++l)
+        {
+          const Number *in  = dofs_tensor + l * n_dofs_t;
+          Number       *out = temp + l * n_q_t;
+          for (unsigned int qt = 0; qt < n_q_t; ++qt)
+            out[qt] = shape[qt] * in[0];
+          for (unsigned int i = 1; i < n_dofs_t; ++i)
+            {
+              const Number   in_i    = in[i];
+              const Number2 *shape_i = shape + i * n_q_t;
+              for (unsigned int qt = 0; qt < n_q_t; ++qt)
+                out[qt] += shape_i[qt] * in_i;
+            }
+        }
+    };
+
+    // product in z direction, writing into every stride-th entry of out
+    const auto apply_line = [&](const Number2     *shape,
+                                Number            *out,
+                                const unsigned int stride) {
+      for (unsigned int ql = 0; ql < n_q_l; ++ql)
+        {
+          Number *out_ql = out + ql * n_q_t * stride;
+          for (unsigned int qt = 0; qt < n_q_t; ++qt)
+            out_ql[qt * stride] = shape[ql] * temp[qt];
+          for (unsigned int l = 1; l < n_dofs_l; ++l)
+            {
+              const Number2 shape_l = shape[l * n_q_l + ql];
+              const Number *in      = temp + l * n_q_t;
+              for (unsigned int qt = 0; qt < n_q_t; ++qt)
+                out_ql[qt * stride] += shape_l * in[qt];
+            }
+        }
+    };
+
+    for (unsigned int c = 0; c < n_components; ++c)
+      {
+        const Number *values_dofs = values_dofs_actual + c * n_dofs;
+        Number       *values_quad = fe_eval.begin_values() + c * n_q_points;
+        Number       *gradients_quad =
+          fe_eval.begin_gradients() + c * dim * n_q_points;
+
+        for (unsigned int i = 0; i < n_dofs; ++i)
+          dofs_tensor[i] = values_dofs[wedge_data.dof_numbering[i]];
+
+        // values on the triangle give the values and the derivative in z
+        // direction
+        apply_triangle(wedge_data.shape_values_triangle.data());
+        if (evaluation_flag & EvaluationFlags::values)
+          apply_line(wedge_data.shape_values_line.data(), values_quad, 1);
+        if (evaluation_flag & EvaluationFlags::gradients)
+          apply_line(wedge_data.shape_gradients_line.data(),
+                     gradients_quad + dim - 1,
+                     dim);
+
+        // derivatives on the triangle give the derivatives in x and y
+        // direction
+        if (evaluation_flag & EvaluationFlags::gradients)
+          for (unsigned int d = 0; d < dim - 1; ++d)
+            {
+              apply_triangle(wedge_data.shape_gradients_triangle.data() +
+                             d * n_dofs_t * n_q_t);
+              apply_line(wedge_data.shape_values_line.data(),
+                         gradients_quad + d,
+                         dim);
+            }
+      }
+  }
+
+
+
+  template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+  inline void
+  FEEvaluationImpl<MatrixFreeFunctions::tensor_none,
+                   dim,
+                   fe_degree,
+                   n_q_points_1d,
+                   Number>::
+    integrate_wedge(const unsigned int                     n_components,
+                    const EvaluationFlags::EvaluationFlags integration_flag,
+                    Number                                *values_dofs_actual,
+                    FEEvaluationData<dim, Number, false>  &fe_eval,
+                    const bool add_into_values_array)
+  {
+    if (!(integration_flag &
+          (EvaluationFlags::values | EvaluationFlags::gradients)))
+      return;
+
+    using Number2 =
+      typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
+    const MatrixFreeFunctions::WedgeShapeData<Number2> &wedge_data =
+      fe_eval.get_shape_info().wedge_data;
+
+    const unsigned int n_dofs_t   = wedge_data.n_dofs_triangle;
+    const unsigned int n_dofs_l   = wedge_data.n_dofs_line;
+    const unsigned int n_q_t      = wedge_data.n_q_points_triangle;
+    const unsigned int n_q_l      = wedge_data.n_q_points_line;
+    const unsigned int n_dofs     = n_dofs_t * n_dofs_l;
+    const unsigned int n_q_points = n_q_t * n_q_l;
+
+    Number *dofs_tensor = fe_eval.get_scratch_data().begin();
+    Number *temp        = dofs_tensor + n_dofs;
+    Assert(n_dofs + n_dofs_l * n_q_t <= fe_eval.get_scratch_data().size(),
+           ExcInternalError());
+
+    // transpose of the product in z direction, reading every stride-th
+    // entry of in and adding into the result on the triangle if requested
+    const auto apply_line = [&](const Number2     *shape,
+                                const Number      *in,
+                                const unsigned int stride,
+                                const bool         add) {
+      for (unsigned int l = 0; l < n_dofs_l; ++l)
+        {
+          const Number2 *shape_l = shape + l * n_q_l;
+          Number        *out     = temp + l * n_q_t;
+          if (!add)
+            for (unsigned int qt = 0; qt < n_q_t; ++qt)
+              out[qt] = shape_l[0] * in[qt * stride];
+          for (unsigned int ql = add ? 0 : 1; ql < n_q_l; ++ql)
+            {
+              const Number2 shape_lq = shape_l[ql];
+              const Number *in_ql    = in + ql * n_q_t * stride;
+              for (unsigned int qt = 0; qt < n_q_t; ++qt)
+                out[qt] += shape_lq * in_ql[qt * stride];
+            }
+        }
+    };
+
+    // transpose of the product on the triangle for all shape functions on
+    // the line
+    const auto apply_triangle = [&](const Number2 *shape, const bool add) {
+      for (unsigned int l = 0; l < n_dofs_l; ++l)
+        {
+          const Number *in  = temp + l * n_q_t;
+          Number       *out = dofs_tensor + l * n_dofs_t;
+          for (unsigned int i = 0; i < n_dofs_t; ++i)
+            {
+              const Number2 *shape_i = shape + i * n_q_t;
+              Number         sum     = shape_i[0] * in[0];
+              for (unsigned int qt = 1; qt < n_q_t; ++qt)
+                sum += shape_i[qt] * in[qt];
+              if (add)
+                out[i] += sum;
+              else
+                out[i] = sum;
+            }
+        }
+    };
+
+    for (unsigned int c = 0; c < n_components; ++c)
+      {
+        Number       *values_dofs = values_dofs_actual + c * n_dofs;
+        const Number *values_quad = fe_eval.begin_values() + c * n_q_points;
+        const Number *gradients_quad =
+          fe_eval.begin_gradients() + c * dim * n_q_points;
+
+        // values and derivatives in z direction are tested by the values on
+        // the triangle
+        if (integration_flag & EvaluationFlags::values)
+          apply_line(wedge_data.shape_values_line.data(),
+                     values_quad,
+                     1,
+                     false);
+        if (integration_flag & EvaluationFlags::gradients)
+          apply_line(wedge_data.shape_gradients_line.data(),
+                     gradients_quad + dim - 1,
+                     dim,
+                     (integration_flag & EvaluationFlags::values) != 0u);
+        apply_triangle(wedge_data.shape_values_triangle.data(), false);
+
+        // derivatives in x and y direction are tested by the derivatives on
+        // the triangle
+        if (integration_flag & EvaluationFlags::gradients)
+          for (unsigned int d = 0; d < dim - 1; ++d)
+            {
+              apply_line(wedge_data.shape_values_line.data(),
+                         gradients_quad + d,
+                         dim,
+                         false);
+              apply_triangle(wedge_data.shape_gradients_triangle.data() +
+                               d * n_dofs_t * n_q_t,
+                             true);
+            }
+
+        if (add_into_values_array)
+          for (unsigned int i = 0; i < n_dofs; ++i)
+            values_dofs[wedge_data.dof_numbering[i]] += dofs_tensor[i];
+        else
+          for (unsigned int i = 0; i < n_dofs; ++i)
+            values_dofs[wedge_data.dof_numbering[i]] = dofs_tensor[i];
+      }
+  }
+
+
+
   /**
    * This struct implements the change between two different bases. This is an
    * ingredient in the FEEvaluationImplTransformToCollocation class where we
@@ -19,6 +19,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <iterator>
+
 #ifndef FE_EVAL_FACTORY_DEGREE_MAX
 #  define FE_EVAL_FACTORY_DEGREE_MAX 6
 #endif
@@ -27,6 +29,27 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace internal
 {
+  /**
+   * Pairs of polynomial degree and number of 1d quadrature points for which
+   * the evaluation kernels are precompiled in addition to the ones selected
+   * by FE_EVAL_FACTORY_DEGREE_MAX. The list can be set by the macro
+   * `FE_EVAL_FACTORY_ADDITIONAL_PAIRS` in the form `{7,8},{7,10}`, which is
+   * populated by the CMake variable `DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_PAIRS`
+   * when configuring deal.II.
+   */
+#ifdef FE_EVAL_FACTORY_ADDITIONAL_PAIRS
+  inline constexpr unsigned int fe_eval_factory_additional_pairs[][2] = {
+    FE_EVAL_FACTORY_ADDITIONAL_PAIRS};
+  inline constexpr unsigned int n_fe_eval_factory_additional_pairs =
+    std::size(fe_eval_factory_additional_pairs);
+#else
+  inline constexpr unsigned int fe_eval_factory_additional_pairs[][2] = {
+    {0, 0}};
+  inline constexpr unsigned int n_fe_eval_factory_additional_pairs = 0;
+#endif
+
+
+
   /**
    * This struct is used to implement
    * FEEvaluation::fast_evaluation_supported() and
@@ -42,6 +65,43 @@ namespace internal
     }
   };
 
+  /**
+   * Go through the list of additional pairs of degree and number of
+   * quadrature points, starting at the given index, and call the templated
+   * evaluator for a matching pair. If no pair matches, the slow path with
+   * run-time loop bounds is selected.
+   */
+  template <unsigned int index, typename EvaluatorType, typename... Args>
+  bool
+  instantiation_helper_additional_run(const unsigned int given_degree,
+                                      const unsigned int n_q_points_1d,
+                                      Args &...args)
+  {
+    if constexpr (index < n_fe_eval_factory_additional_pairs)
+      {
+        constexpr unsigned int degree =
+          fe_eval_factory_additional_pairs[index][0];
+        constexpr unsigned int n_q_points =
+          fe_eval_factory_additional_pairs[index][1];
+        static_assert(degree > 0 && n_q_points > 0,
+                      "Precompiled degrees and quadrature points must be "
+                      "positive");
+        if (given_degree == degree && n_q_points_1d == n_q_points)
+          return EvaluatorType::template run<degree, n_q_points>(args...);
+        else
+          return instantiation_helper_additional_run<index + 1,
+                                                     EvaluatorType>(
+            given_degree, n_q_points_1d, args...);
+      }
+    else
+      {
+        (void)given_degree;
+        (void)n_q_points_1d;
+        // slow path
+        return EvaluatorType::template run<-1, 0>(args...);
+      }
+  }
+
   template <int degree, typename EvaluatorType, typename... Args>
   bool
   instantiation_helper_run(const unsigned int given_degree,
@@ -62,16 +122,49 @@ namespace internal
         else if ((n_q_points_1d == (2 * degree)) && (degree <= 4))
           return EvaluatorType::template run<degree, (2 * degree)>(args...);
         else
-          // slow path
-          return EvaluatorType::template run<-1, 0>(args...);
+          return instantiation_helper_additional_run<0, EvaluatorType>(
+            given_degree, n_q_points_1d, args...);
       }
     else if (degree < FE_EVAL_FACTORY_DEGREE_MAX)
       return instantiation_helper_run<
         (degree < FE_EVAL_FACTORY_DEGREE_MAX ? degree + 1 : degree),
         EvaluatorType>(given_degree, n_q_points_1d, args...);
     else
-      // slow path
-      return EvaluatorType::template run<-1, 0>(args...);
+      return instantiation_helper_additional_run<0, EvaluatorType>(
+        given_degree, n_q_points_1d, args...);
+  }
+
+  /**
+   * Same as instantiation_helper_additional_run(), but for the evaluators
+   * that are only templated on the polynomial degree: go through the degrees
+   * of the additional pairs, starting at the given index, and call the
+   * templated evaluator for a matching degree.
+   */
+  template <unsigned int index, typename EvaluatorType, typename... Args>
+  bool
+  instantiation_helper_additional_degree_run(const unsigned int given_degree,
+                                             Args &...args)
+  {
+    if constexpr (index < n_fe_eval_factory_additional_pairs)
+      {
+        constexpr unsigned int degree =
+          fe_eval_factory_additional_pairs[index][0];
+        static_assert(degree > 0,
+                      "Precompiled degrees and quadrature points must be "
+                      "positive");
+        if (given_degree == degree)
+          return EvaluatorType::template run<degree>(args...);
+        else
+          return instantiation_helper_additional_degree_run<index + 1,
+                                                            EvaluatorType>(
+            given_degree, args...);
+      }
+    else
+      {
+        (void)given_degree;
+        // slow path
+        return EvaluatorType::template run<-1>(args...);
+      }
   }
 
   template <int degree, typename EvaluatorType, typename... Args>
@@ -88,8 +181,8 @@ namespace internal
         (degree < FE_EVAL_FACTORY_DEGREE_MAX ? degree + 1 : degree),
         EvaluatorType>(given_degree, args...);
     else
-      // slow path
-      return EvaluatorType::template run<-1>(args...);
+      return instantiation_helper_additional_degree_run<0, EvaluatorType>(
+        given_degree, args...);
   }
 
 } // end of namespace internal
@@ -1180,8 +1180,8 @@ using FEEvaluationAccess DEAL_II_DEPRECATED =
  * instantiating the classes FEEvaluationFactory and FEFaceEvaluationFactory
  * (the latter for FEFaceEvaluation) creates paths to templated functions for
  * a possibly larger set of degrees. This can both be set when configuring
- * deal.II by passing the flag `-D FE_EVAL_FACTORY_DEGREE_MAX=8` (in case you
- * want to compile all degrees up to eight; recommended setting) or by
+ * deal.II by passing the flag `-D DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX=8` (in
+ * case you want to compile all degrees up to eight; recommended setting) or by
  * compiling `evaluation_template_factory.templates.h` and
  * `evaluation_template_face_factory.templates.h` with the
  * `FE_EVAL_FACTORY_DEGREE_MAX` overridden to the desired value. In the second
@@ -1192,6 +1192,20 @@ using FEEvaluationAccess DEAL_II_DEPRECATED =
  * calling FEEvaluation::fast_evaluation_supported() or
  * FEFaceEvaluation::fast_evaluation_supported().
  *
+ * Individual combinations of polynomial degree and number of quadrature
+ * points, e.g. for an over-integration that is not among the variants
+ * compiled for every degree, can be added with the configuration flag
+ * `-D DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_PAIRS="8:12;10:15"`, listing pairs
+ * of the form `degree:n_q_points_1d`. The degrees of these pairs are also
+ * used for the operations that only depend on the polynomial degree, like
+ * the interpolation to faces and the application of hanging-node
+ * constraints. For all other combinations, the generic kernels with run-time
+ * loop bounds are used. For up to 12 points or basis functions per
+ * direction, these kernels round the length of the one-dimensional sums up
+ * to an even number known at compile time, which allows the compiler to
+ * unroll them. The test `tests/performance/timing_matrix_free_runtime_degree`
+ * compares these kernels with the templated ones.
+ *
  * <h3>Handling multi-component systems</h3>
  *
  * FEEvaluation also allows for treating vector-valued problems through a
@@ -6455,8 +6469,19 @@ FEEvaluation<dim,
 
   const unsigned int offsets =
     this->mapping_data->data_index_offsets[cell_index];
-  this->jacobian = &this->mapping_data->jacobians[0][offsets];
-  this->J_value  = &this->mapping_data->JxW_values[offsets];
+  if (this->matrix_free->get_mapping_info().cell_geometry_computed_on_the_fly(
+        cell_index))
+    {
+      this->matrix_free->get_mapping_info().compute_cell_geometry_on_the_fly(
+        cell_index, this->quad_no, this->geometry_on_the_fly);
+      this->jacobian = this->geometry_on_the_fly.jacobians.data();
+      this->J_value  = this->geometry_on_the_fly.JxW_values.data();
+    }
+  else
+    {
+      this->jacobian = &this->mapping_data->jacobians[0][offsets];
+      this->J_value  = &this->mapping_data->JxW_values[offsets];
+    }
   if (!this->mapping_data->jacobian_gradients[0].empty())
     {
       this->jacobian_gradients =
@@ -6604,6 +6629,7 @@ FEEvaluation<dim,
   this->quadrature_points = this_quadrature_points_data.data();
 
   // fill internal data storage lane by lane
+  unsigned int batch_computed_on_the_fly = numbers::invalid_unsigned_int;
   for (unsigned int v = 0; v < n_lanes; ++v)
     {
       const unsigned int cell_index = cell_ids[v];
@@ -6665,6 +6691,26 @@ FEEvaluation<dim,
             this->matrix_free->get_mapping_info().get_cell_type(
               cell_batch_index);
 
+          // the geometry might need to be computed from the mapping support
+          // points, which we do only once for several lanes from the same
+          // cell batch
+          const VectorizedArrayType *JxW_values =
+            this->mapping_data->JxW_values.data() + offsets;
+          const Tensor<2, dim, VectorizedArrayType> *jacobians =
+            this->mapping_data->jacobians[0].data() + offsets;
+          if (this->matrix_free->get_mapping_info()
+                .cell_geometry_computed_on_the_fly(cell_batch_index))
+            {
+              if (cell_batch_index != batch_computed_on_the_fly)
+                this->matrix_free->get_mapping_info()
+                  .compute_cell_geometry_on_the_fly(cell_batch_index,
+                                                    this->quad_no,
+                                                    this->geometry_on_the_fly);
+              batch_computed_on_the_fly = cell_batch_index;
+              JxW_values = this->geometry_on_the_fly.JxW_values.data();
+              jacobians  = this->geometry_on_the_fly.jacobians.data();
+            }
+
           for (unsigned int q = 0; q < this->n_quadrature_points; ++q)
             {
               const unsigned int q_src =
@@ -6673,14 +6719,12 @@ FEEvaluation<dim,
                   0 :
                   q;
 
-              this_J_value_data[q][v] =
-                this->mapping_data->JxW_values[offsets + q_src][lane];
+              this_J_value_data[q][v] = JxW_values[q_src][lane];
 
               for (unsigned int i = 0; i < dim; ++i)
                 for (unsigned int j = 0; j < dim; ++j)
                   this_jacobian_data[q][i][j][v] =
-                    this->mapping_data
-                      ->jacobians[0][offsets + q_src][i][j][lane];
+                    jacobians[q_src][i][j][lane];
 
               const auto &update_flags_cells =
                 this->matrix_free->get_mapping_info().update_flags_cells;
@@ -989,6 +989,13 @@ protected:
     internal::MatrixFreeFunctions::MappingDataOnTheFly<dim, Number>>
     mapped_geometry;
 
+  /**
+   * Geometry data of the present cell batch in case MappingInfo only stores
+   * the mapping support points of the cells, computed within reinit().
+   */
+  internal::MatrixFreeFunctions::GeometryScratchData<dim, Number>
+    geometry_on_the_fly;
+
   /**
    * Bool indicating if the divergence is requested. Used internally in the case
    * of the Piola transform.
@@ -0,0 +1,75 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_matrix_free_hilbert_ordering_internal_h
+#define dealii_matrix_free_hilbert_ordering_internal_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/point.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    /**
+     * Return the position of each coarse cell of @p tria along a Hilbert
+     * curve through the cell centers, indexed by cell->index() on level
+     * zero. See MatrixFreeTools::compute_hilbert_rank_of_coarse_cells() for
+     * the user-facing interface.
+     */
+    template <int dim>
+    std::vector<unsigned int>
+    compute_hilbert_rank_of_coarse_cells(const Triangulation<dim> &tria)
+    {
+      std::vector<Point<dim>> centers;
+      centers.reserve(tria.n_cells(0));
+      for (const auto &cell : tria.cell_iterators_on_level(0))
+        centers.push_back(cell->center());
+
+      const std::vector<std::array<std::uint64_t, dim>> hilbert_indices =
+        Utilities::inverse_Hilbert_space_filling_curve(centers);
+
+      std::vector<unsigned int> order(centers.size());
+      std::iota(order.begin(), order.end(), 0U);
+      std::stable_sort(order.begin(),
+                       order.end(),
+                       [&](const unsigned int a, const unsigned int b) {
+                         return hilbert_indices[a] < hilbert_indices[b];
+                       });
+
+      std::vector<unsigned int> rank(order.size());
+      for (unsigned int i = 0; i < order.size(); ++i)
+        rank[order[i]] = i;
+      return rank;
+    }
+  } // namespace MatrixFreeFunctions
+} // namespace internal
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
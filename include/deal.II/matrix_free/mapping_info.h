@@ -60,6 +60,11 @@ namespace internal
        * for different kinds of iterators, e.g. standard DoFHandler,
        * multigrid, etc.)  on a fixed Triangulation. In addition, a mapping
        * and several 1d quadrature formulas are given.
+       *
+       * If @p store_mapping_support_points is set, the Jacobians and JxW
+       * values on cells of type GeometryType::general are not tabulated but
+       * only the mapping support points of these cells are kept, see
+       * compute_cell_geometry_on_the_fly().
        */
       void
       initialize(
@@ -73,7 +78,8 @@ namespace internal
         const UpdateFlags update_flags_boundary_faces,
         const UpdateFlags update_flags_inner_faces,
         const UpdateFlags update_flags_faces_by_cells,
-        const bool        piola_transform);
+        const bool        piola_transform,
+        const bool        store_mapping_support_points = false);
 
       /**
        * Update the information in the given cells and faces that is the
@@ -95,6 +101,30 @@ namespace internal
       GeometryType
       get_cell_type(const unsigned int cell_chunk_no) const;
 
+      /**
+       * Return whether the Jacobians and JxW values on the given cell batch
+       * are not stored in @p cell_data and must be computed by
+       * compute_cell_geometry_on_the_fly() instead.
+       */
+      bool
+      cell_geometry_computed_on_the_fly(const unsigned int cell_batch) const;
+
+      /**
+       * Compute the inverse transposed Jacobians and the JxW values of the
+       * cell batch with index @p cell_batch for the quadrature formula with
+       * index @p quad_no from the mapping support points stored in
+       * @p mapping_support_points. The derivatives of the polynomial
+       * description of the geometry are evaluated with the sum-factorization
+       * kernels of the matrix-free framework, which involves $dim^2$ sweeps
+       * through the $dim$ coordinate components. The result is placed in the
+       * fields of @p geometry, which get resized as needed.
+       */
+      void
+      compute_cell_geometry_on_the_fly(
+        const unsigned int                             cell_batch,
+        const unsigned int                             quad_no,
+        GeometryScratchData<dim, VectorizedArrayType> &geometry) const;
+
       /**
        * Clear all data fields in this class.
        */
@@ -184,6 +214,42 @@ namespace internal
       std::vector<MappingInfoStorage<dim - 1, dim, VectorizedArrayType>>
         face_data_by_cells;
 
+      /**
+       * Stores whether only the mapping support points rather than the
+       * Jacobians and JxW values should be kept on cells of type
+       * GeometryType::general, as requested by the argument of the same name
+       * to initialize().
+       */
+      bool store_mapping_support_points;
+
+      /**
+       * The positions of the support points of the mapping on the cell
+       * batches whose geometry is computed on the fly. The points are stored
+       * component by component in lexicographic order, relative to the first
+       * support point of the respective cell in order to retain the accuracy
+       * of their differences in reduced precision. Cell batches that differ
+       * by a translation only share the same entries.
+       *
+       * Indexed by @p mapping_support_point_offsets.
+       */
+      AlignedVector<VectorizedArrayType> mapping_support_points;
+
+      /**
+       * Stores the index offset of each cell batch into
+       * @p mapping_support_points, or numbers::invalid_unsigned_int if the
+       * geometry of the cell batch is stored in @p cell_data. Empty if no
+       * geometry is computed on the fly.
+       */
+      std::vector<unsigned int> mapping_support_point_offsets;
+
+      /**
+       * The values and gradients of the one-dimensional Lagrange polynomials
+       * of the mapping evaluated in the one-dimensional quadrature points of
+       * each quadrature formula, for use in
+       * compute_cell_geometry_on_the_fly().
+       */
+      std::vector<std::array<AlignedVector<Number>, 2>> mapping_shape_data;
+
       /**
        * The pointer to the underlying hp::MappingCollection object.
        */
@@ -308,6 +374,20 @@ namespace internal
       return cell_type[cell_no];
     }
 
+
+
+    template <int dim, typename Number, typename VectorizedArrayType>
+    inline bool
+    MappingInfo<dim, Number, VectorizedArrayType>::
+      cell_geometry_computed_on_the_fly(const unsigned int cell_batch) const
+    {
+      if (mapping_support_point_offsets.empty())
+        return false;
+      AssertIndexRange(cell_batch, mapping_support_point_offsets.size());
+      return mapping_support_point_offsets[cell_batch] !=
+             numbers::invalid_unsigned_int;
+    }
+
   } // end of namespace MatrixFreeFunctions
 } // end of namespace internal
 
@@ -32,6 +32,7 @@
 #include <deal.II/matrix_free/fe_evaluation_data.h>
 #include <deal.II/matrix_free/mapping_info.h>
 #include <deal.II/matrix_free/mapping_info_storage.templates.h>
+#include <deal.II/matrix_free/tensor_product_kernels.h>
 #include <deal.II/matrix_free/util.h>
 
 #include <limits>
@@ -52,6 +53,9 @@ namespace internal
       face_data_by_cells.clear();
       cell_type.clear();
       face_type.clear();
+      mapping_support_points.clear();
+      mapping_support_point_offsets.clear();
+      mapping_shape_data.clear();
       mapping_collection = nullptr;
       mapping            = nullptr;
     }
@@ -71,11 +75,13 @@ namespace internal
       const UpdateFlags update_flags_boundary_faces,
       const UpdateFlags update_flags_inner_faces,
       const UpdateFlags update_flags_faces_by_cells,
-      const bool        piola_transform)
+      const bool        piola_transform,
+      const bool        store_mapping_support_points)
     {
       clear();
-      this->mapping_collection = mapping;
-      this->mapping            = &mapping->operator[](0);
+      this->mapping_collection           = mapping;
+      this->mapping                      = &mapping->operator[](0);
+      this->store_mapping_support_points = store_mapping_support_points;
 
       cell_data.resize(quad.size());
       face_data.resize(quad.size());
@@ -219,6 +225,9 @@ namespace internal
         data.clear_data_fields();
       for (auto &data : face_data_by_cells)
         data.clear_data_fields();
+      mapping_support_points.clear();
+      mapping_support_point_offsets.clear();
+      mapping_shape_data.clear();
 
       this->mapping_collection = mapping;
       this->mapping            = &mapping->operator[](0);
@@ -1169,6 +1178,7 @@ namespace internal
         const std::vector<GeometryType>                          &cell_type,
         const std::vector<bool>                                  &process_cell,
         const UpdateFlags            update_flags_cells,
+        const bool                   geometry_on_the_fly,
         const AlignedVector<double> &plain_quadrature_points,
         const ShapeInfo<double>     &shape_info,
         MappingInfoStorage<dim, dim, VectorizedArrayType> &my_data)
@@ -1230,8 +1240,12 @@ namespace internal
                           quadrature_points[q][d]);
                 }
 
+              // on general cells, the Jacobians are not stored if they are
+              // computed on the fly from the mapping support points
               const unsigned int n_points =
-                cell_type[cell] <= affine ? 1 : n_q_points;
+                cell_type[cell] <= affine ? 1 :
+                geometry_on_the_fly       ? 0 :
+                                            n_q_points;
               if (process_cell[cell])
                 for (unsigned int q = 0; q < n_points; ++q)
                   {
@@ -2781,6 +2795,68 @@ namespace internal
                               preliminary_cell_type.data() + cell + n_lanes);
         }
 
+      // step 3b: if requested, keep only the support points of the mapping
+      // on the general cells rather than the Jacobians on all quadrature
+      // points. This needs tensor-product quadrature formulas and is not
+      // done if derivatives of the Jacobians are requested.
+      bool geometry_on_the_fly =
+        store_mapping_support_points &&
+        (update_flags_cells & update_jacobian_grads) == 0;
+      for (const auto &data : cell_data)
+        if (data.descriptor[0].quadrature_1d.size() == 0)
+          geometry_on_the_fly = false;
+      if (geometry_on_the_fly)
+        {
+          mapping_shape_data.resize(cell_data.size());
+          for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
+            {
+              const UnivariateShapeData<double> &shape_data =
+                shape_infos[my_q].get_shape_data();
+              for (unsigned int i = 0; i < 2; ++i)
+                {
+                  const AlignedVector<double> &source =
+                    i == 0 ? shape_data.shape_values :
+                             shape_data.shape_gradients;
+                  mapping_shape_data[my_q][i].resize_fast(source.size());
+                  for (unsigned int j = 0; j < source.size(); ++j)
+                    mapping_shape_data[my_q][i][j] = source[j];
+                }
+            }
+
+          mapping_support_point_offsets.resize(cell_type.size(),
+                                               numbers::invalid_unsigned_int);
+          unsigned int n_stored_points = 0;
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] == general)
+              {
+                if (process_cell[cell] == false)
+                  mapping_support_point_offsets[cell] =
+                    mapping_support_point_offsets[cell_data_index_vect[cell]];
+                else
+                  {
+                    mapping_support_point_offsets[cell] = n_stored_points;
+                    n_stored_points += dim * n_mapping_points;
+                  }
+              }
+
+          mapping_support_points.resize_fast(n_stored_points);
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] == general && process_cell[cell])
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                for (unsigned int d = 0; d < dim; ++d)
+                  {
+                    const double *points =
+                      plain_quadrature_points.data() +
+                      (dim * (cell * n_lanes + v) + d) * n_mapping_points;
+                    VectorizedArrayType *stored_points =
+                      mapping_support_points.data() +
+                      mapping_support_point_offsets[cell] +
+                      d * n_mapping_points;
+                    for (unsigned int i = 0; i < n_mapping_points; ++i)
+                      stored_points[i][v] = points[i] - points[0];
+                  }
+        }
+
       // step 4: compute the data on cells from the cached quadrature
       // points, filling up all SIMD lanes as appropriate
       for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
@@ -2803,7 +2879,9 @@ namespace internal
               max_size =
                 std::max(max_size,
                          my_data.data_index_offsets[cell] +
-                           (cell_type[cell] <= affine ? 2 : n_q_points));
+                           (cell_type[cell] <= affine ? 2 :
+                            geometry_on_the_fly       ? 0 :
+                                                        n_q_points));
             }
 
           my_data.JxW_values.resize_fast(max_size);
@@ -2846,6 +2924,7 @@ namespace internal
                 cell_type,
                 process_cell,
                 update_flags_cells,
+                geometry_on_the_fly,
                 plain_quadrature_points,
                 shape_infos[my_q],
                 my_data);
@@ -3034,6 +3113,104 @@ namespace internal
 
 
 
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    MappingInfo<dim, Number, VectorizedArrayType>::
+      compute_cell_geometry_on_the_fly(
+        const unsigned int                             cell_batch,
+        const unsigned int                             quad_no,
+        GeometryScratchData<dim, VectorizedArrayType> &geometry) const
+    {
+      Assert(cell_geometry_computed_on_the_fly(cell_batch),
+             ExcMessage("The geometry of this cell batch is stored in "
+                        "MappingInfo and not computed on the fly."));
+      AssertIndexRange(quad_no, mapping_shape_data.size());
+
+      const unsigned int n_q_points =
+        cell_data[quad_no].descriptor[0].n_q_points;
+      const unsigned int n_q_points_1d =
+        cell_data[quad_no].descriptor[0].quadrature_1d.size();
+      const unsigned int n_points_1d =
+        mapping_shape_data[quad_no][0].size() / n_q_points_1d;
+      const unsigned int n_points = Utilities::pow(n_points_1d, dim);
+      const unsigned int n_intermediate =
+        Utilities::pow(std::max(n_points_1d, n_q_points_1d), dim);
+
+      geometry.JxW_values.resize_fast(n_q_points);
+      geometry.jacobians.resize_fast(n_q_points);
+      geometry.scratch_data.resize_fast(dim * dim * n_q_points +
+                                        2 * n_intermediate);
+      VectorizedArrayType *gradients = geometry.scratch_data.data();
+      VectorizedArrayType *tmp0      = gradients + dim * dim * n_q_points;
+      VectorizedArrayType *tmp1      = tmp0 + n_intermediate;
+
+      // the derivative of coordinate component d in direction e is computed
+      // with the gradient matrix in direction e and the value matrix in the
+      // other directions, going through the directions in ascending order
+      EvaluatorTensorProduct<evaluate_general,
+                             dim,
+                             0,
+                             0,
+                             VectorizedArrayType,
+                             Number>
+        eval(mapping_shape_data[quad_no][0].data(),
+             mapping_shape_data[quad_no][1].data(),
+             nullptr,
+             n_points_1d,
+             n_q_points_1d);
+
+      const VectorizedArrayType *support_points =
+        mapping_support_points.data() +
+        mapping_support_point_offsets[cell_batch];
+      for (unsigned int d = 0; d < dim; ++d)
+        for (unsigned int e = 0; e < dim; ++e)
+          {
+            const VectorizedArrayType *in = support_points + d * n_points;
+            VectorizedArrayType *out = gradients + (d * dim + e) * n_q_points;
+            if constexpr (dim == 1)
+              eval.template gradients<0, true, false>(in, out);
+            else
+              {
+                if (e == 0)
+                  eval.template gradients<0, true, false>(in, tmp0);
+                else
+                  eval.template values<0, true, false>(in, tmp0);
+                if constexpr (dim == 2)
+                  {
+                    if (e == 1)
+                      eval.template gradients<1, true, false>(tmp0, out);
+                    else
+                      eval.template values<1, true, false>(tmp0, out);
+                  }
+                else
+                  {
+                    if (e == 1)
+                      eval.template gradients<1, true, false>(tmp0, tmp1);
+                    else
+                      eval.template values<1, true, false>(tmp0, tmp1);
+                    if (e == 2)
+                      eval.template gradients<2, true, false>(tmp1, out);
+                    else
+                      eval.template values<2, true, false>(tmp1, out);
+                  }
+              }
+          }
+
+      const Number *weights =
+        cell_data[quad_no].descriptor[0].quadrature_weights.data();
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          Tensor<2, dim, VectorizedArrayType> jac;
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int e = 0; e < dim; ++e)
+              jac[d][e] = gradients[(d * dim + e) * n_q_points + q];
+          geometry.JxW_values[q] = determinant(jac) * weights[q];
+          geometry.jacobians[q]  = transpose(invert(jac));
+        }
+    }
+
+
+
     template <int dim, typename Number, typename VectorizedArrayType>
     void
     MappingInfo<dim, Number, VectorizedArrayType>::initialize_faces_by_cells(
@@ -3164,6 +3341,21 @@ namespace internal
       FE_Nothing<dim> dummy_fe;
       // currently no hp-indices implemented
       const unsigned int fe_index = 0;
+
+      // FEFaceValues lists the quadrature points of a face in the standard
+      // orientation of the face, whereas FEFaceEvaluation::reinit(cell, face)
+      // works with the points in the lexicographic order of the face as seen
+      // from the cell. For faces in non-standard orientation in 3d, we
+      // therefore look up the point of FEFaceValues that matches each point
+      // of the cell, in the same way as the evaluation kernels of the
+      // face-centric loops translate between the two sides of a face
+      std::vector<Table<2, unsigned int>> orientation_tables(n_quads);
+      if (dim == 3)
+        for (unsigned int my_q = 0; my_q < n_quads; ++my_q)
+          orientation_tables[my_q] =
+            ShapeInfo<double>::compute_orientation_table(
+              face_data_by_cells[my_q].descriptor[0].quadrature_1d.size());
+
       std::vector<std::vector<std::shared_ptr<dealii::FEFaceValues<dim>>>>
         fe_face_values(face_data_by_cells.size());
       for (unsigned int i = 0; i < fe_face_values.size(); ++i)
@@ -3209,6 +3401,17 @@ namespace internal
                     cells[cell * n_lanes + v].second);
                   fe_val.reinit(cell_it, face);
 
+                  const unsigned int orientation =
+                    dim == 3 ? (!cell_it->face_orientation(face) +
+                                2 * cell_it->face_flip(face) +
+                                4 * cell_it->face_rotation(face)) :
+                               0;
+                  const auto q_fe_values = [&](const unsigned int q) {
+                    return orientation == 0 ?
+                             q :
+                             orientation_tables[my_q](orientation, q);
+                  };
+
                   const unsigned int cell_neighbor =
                     compute_neighbor_index(cell, face, v);
 
@@ -3280,13 +3483,13 @@ namespace internal
                         for (unsigned int q = 0; q < fe_val.n_quadrature_points;
                              ++q)
                           face_data_by_cells[my_q].JxW_values[offset + q][v] =
-                            fe_val.JxW(q);
+                            fe_val.JxW(q_fe_values(q));
                       if (update_flags & update_jacobians)
                         for (unsigned int q = 0; q < fe_val.n_quadrature_points;
                              ++q)
                           {
                             DerivativeForm<1, dim, dim> inv_jac =
-                              fe_val.jacobian(q).covariant_form();
+                              fe_val.jacobian(q_fe_values(q)).covariant_form();
                             for (unsigned int d = 0; d < dim; ++d)
                               for (unsigned int e = 0; e < dim; ++e)
                                 {
@@ -3304,7 +3507,8 @@ namespace internal
                              ++q)
                           {
                             DerivativeForm<1, dim, dim> inv_jac =
-                              fe_val_neigh.jacobian(q).covariant_form();
+                              fe_val_neigh.jacobian(q_fe_values(q))
+                                .covariant_form();
                             for (unsigned int d = 0; d < dim; ++d)
                               for (unsigned int e = 0; e < dim; ++e)
                                 {
@@ -3326,7 +3530,7 @@ namespace internal
                           for (unsigned int d = 0; d < dim; ++d)
                             face_data_by_cells[my_q]
                               .normal_vectors[offset + q][d][v] =
-                              fe_val.normal_vector(q)[d];
+                              fe_val.normal_vector(q_fe_values(q))[d];
                     }
                   if (update_flags & update_quadrature_points)
                     for (unsigned int q = 0; q < fe_val.n_quadrature_points;
@@ -3335,7 +3539,8 @@ namespace internal
                         face_data_by_cells[my_q].quadrature_points
                           [face_data_by_cells[my_q].quadrature_point_offsets
                              [cell * GeometryInfo<dim>::faces_per_cell + face] +
-                           q][d][v] = fe_val.quadrature_point(q)[d];
+                           q][d][v] =
+                          fe_val.quadrature_point(q_fe_values(q))[d];
                 }
               if (update_flags & update_normal_vectors &&
                   update_flags & update_jacobians)
@@ -3373,6 +3578,10 @@ namespace internal
       memory += face_type.capacity() * sizeof(GeometryType);
       memory += faces_by_cells_type.capacity() *
                 GeometryInfo<dim>::faces_per_cell * sizeof(GeometryType);
+      memory += mapping_support_points.memory_consumption();
+      memory +=
+        MemoryConsumption::memory_consumption(mapping_support_point_offsets);
+      memory += MemoryConsumption::memory_consumption(mapping_shape_data);
       memory += sizeof(*this);
       return memory;
     }
@@ -3401,6 +3610,13 @@ namespace internal
                                           GeometryInfo<dim>::faces_per_cell *
                                           sizeof(GeometryType));
 
+      if (!mapping_support_point_offsets.empty())
+        {
+          out << "    Mapping support points:          ";
+          task_info.print_memory_statistics(
+            out, mapping_support_points.memory_consumption());
+        }
+
       for (unsigned int j = 0; j < cell_data.size(); ++j)
         {
           out << "    Data component " << j << std::endl;
@@ -350,6 +350,36 @@ namespace internal
 
 
 
+    /**
+     * A structure holding the geometry of a single cell batch when it is not
+     * stored in MappingInfoStorage but recomputed from the mapping support
+     * points within FEEvaluation::reinit(), see
+     * MappingInfo::compute_cell_geometry_on_the_fly().
+     *
+     * @ingroup matrixfree
+     */
+    template <int dim, typename Number>
+    struct GeometryScratchData
+    {
+      /**
+       * The Jacobian determinant times the quadrature weight on the
+       * quadrature points.
+       */
+      AlignedVector<Number> JxW_values;
+
+      /**
+       * The inverse and transposed Jacobians on the quadrature points.
+       */
+      AlignedVector<Tensor<2, dim, Number>> jacobians;
+
+      /**
+       * Temporary storage for the sum-factorization sweeps.
+       */
+      AlignedVector<Number> scratch_data;
+    };
+
+
+
     /* ------------------- inline functions ----------------------------- */
 
     template <int structdim, int spacedim, typename Number>
@@ -246,6 +246,8 @@ public:
       , initialize_mapping(initialize_mapping)
       , overlap_communication_computation(overlap_communication_computation)
       , hold_all_faces_to_owned_cells(hold_all_faces_to_owned_cells)
+      , store_mapping_support_points(false)
+      , order_cells_along_hilbert_curve(false)
       , cell_vectorization_categories_strict(
           cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
@@ -271,6 +273,9 @@ public:
       , overlap_communication_computation(
           other.overlap_communication_computation)
       , hold_all_faces_to_owned_cells(other.hold_all_faces_to_owned_cells)
+      , store_mapping_support_points(other.store_mapping_support_points)
+      , order_cells_along_hilbert_curve(other.order_cells_along_hilbert_curve)
+      , coarse_cell_hilbert_rank(other.coarse_cell_hilbert_rank)
       , cell_vectorization_category(other.cell_vectorization_category)
       , cell_vectorization_categories_strict(
           other.cell_vectorization_categories_strict)
@@ -298,8 +303,11 @@ public:
       initialize_mapping  = other.initialize_mapping;
       overlap_communication_computation =
         other.overlap_communication_computation;
-      hold_all_faces_to_owned_cells = other.hold_all_faces_to_owned_cells;
-      cell_vectorization_category   = other.cell_vectorization_category;
+      hold_all_faces_to_owned_cells   = other.hold_all_faces_to_owned_cells;
+      store_mapping_support_points    = other.store_mapping_support_points;
+      order_cells_along_hilbert_curve = other.order_cells_along_hilbert_curve;
+      coarse_cell_hilbert_rank        = other.coarse_cell_hilbert_rank;
+      cell_vectorization_category     = other.cell_vectorization_category;
       cell_vectorization_categories_strict =
         other.cell_vectorization_categories_strict;
       allow_ghosted_vectors_in_loops = other.allow_ghosted_vectors_in_loops;
@@ -501,6 +509,61 @@ public:
      */
     bool hold_all_faces_to_owned_cells;
 
+    /**
+     * On curved cells, i.e., cells where the Jacobian is not constant, the
+     * inverse Jacobians and JxW values are by default tabulated on all
+     * quadrature points, which for high polynomial degrees takes more memory
+     * than the solution vectors and makes operator evaluation limited by the
+     * transfer of the geometry. If this option is enabled, only the support
+     * points of the mapping are stored on these cells (in the precision of
+     * the vectorized array type and shared among cell batches that are
+     * translations of each other) and FEEvaluation::reinit() recomputes the
+     * inverse Jacobians and JxW values from them with sum factorization. In
+     * other words, this trades memory transfer for arithmetic work. The
+     * quadrature points, if requested through @p mapping_update_flags, are
+     * still stored.
+     *
+     * This option only takes effect if the mapping is a MappingQ, the
+     * quadrature formulas are tensor products of one-dimensional formulas,
+     * no hp-capabilities are used, and @p mapping_update_flags does not
+     * request second derivatives (which need the derivatives of the
+     * Jacobians). It only affects the data of cells, not the data of faces.
+     * The default is false.
+     */
+    bool store_mapping_support_points;
+
+    /**
+     * By default, the cells are collected by going through the cells on the
+     * coarsest level in the order of the triangulation and then recursively
+     * descending into the children, which gives a Z-ordering within each
+     * coarse cell. For meshes with many coarse cells, e.g. generated by
+     * external mesh generators, the order of the coarse cells is often
+     * arbitrary, such that consecutive cell batches access entries of the
+     * vectors that are far apart in memory. If this option is enabled, the
+     * coarse cells are instead sorted along a Hilbert space-filling curve
+     * through their centers before descending into the children (for the
+     * level cells in multigrid, the cells are sorted by the position of
+     * their coarse cell on the curve). This increases the reuse of vector
+     * entries in caches between cell batches, in particular when combined
+     * with DoFRenumbering::matrix_free_data_locality() (called with the same
+     * AdditionalData) and with the fused vector operations of the
+     * @p operation_before_loop and @p operation_after_loop arguments of
+     * cell_loop(), which are scheduled according to the order of the cell
+     * batches. The default is false.
+     */
+    bool order_cells_along_hilbert_curve;
+
+    /**
+     * The position of each coarse cell along the Hilbert curve used by
+     * @p order_cells_along_hilbert_curve, indexed by cell->index() on level
+     * zero. If empty, the positions are computed in reinit(). When MatrixFree
+     * objects are set up for all levels of a multigrid hierarchy, the
+     * positions can instead be computed once with
+     * MatrixFreeTools::compute_hilbert_rank_of_coarse_cells() and stored in
+     * this field, which avoids repeating the computation on each level.
+     */
+    std::vector<unsigned int> coarse_cell_hilbert_rank;
+
     /**
      * This data structure allows to assign a fraction of cells to different
      * categories when building the information for vectorization. It is used
@@ -1491,6 +1554,66 @@ public:
    * FEFaceEvaluation::reinit(cell, face_no) to access quantities on arbitrary
    * faces of a cell and the respective neighbors.
    *
+   * Since all faces of a cell are visited within the same call, the values
+   * on the interior side of a face need not be read from the vector again:
+   * they can be interpolated from the cell's own degrees of freedom that
+   * were already read for the cell integral, and the face contributions can
+   * be accumulated into a cell-local array that is written to the result
+   * vector once, together with the cell integral. Only the neighbor's values
+   * are read from @p src on each face. A typical implementation of this
+   * fused cell-plus-face kernel looks as follows:
+   * @code
+   * FEEvaluation<dim, degree>     phi(matrix_free);
+   * FEFaceEvaluation<dim, degree> phi_m(matrix_free, true);
+   * FEFaceEvaluation<dim, degree> phi_p(matrix_free, false);
+   * AlignedVector<VectorizedArray<double>> face_integrals(phi.dofs_per_cell);
+   *
+   * for (unsigned int cell = range.first; cell < range.second; ++cell)
+   *   {
+   *     phi.reinit(cell);
+   *     phi.read_dof_values(src);
+   *     phi.evaluate(EvaluationFlags::gradients);
+   *
+   *     face_integrals.fill(VectorizedArray<double>());
+   *     for (const unsigned int face : GeometryInfo<dim>::face_indices())
+   *       {
+   *         phi_m.reinit(cell, face);
+   *         // interpolate from the cell values, no access to src
+   *         phi_m.evaluate(phi.begin_dof_values(),
+   *                        EvaluationFlags::values |
+   *                          EvaluationFlags::gradients);
+   *         if (matrix_free.get_faces_by_cells_boundary_id(cell, face)[0] ==
+   *             numbers::internal_face_boundary_id)
+   *           {
+   *             phi_p.reinit(cell, face);
+   *             phi_p.gather_evaluate(src,
+   *                                   EvaluationFlags::values |
+   *                                     EvaluationFlags::gradients);
+   *           }
+   *         // ... compute the flux with phi_m and phi_p ...
+   *         phi_m.integrate(EvaluationFlags::values |
+   *                           EvaluationFlags::gradients,
+   *                         face_integrals.data(),
+   *                         true);
+   *       }
+   *
+   *     for (const unsigned int q : phi.quadrature_point_indices())
+   *       phi.submit_gradient(phi.get_gradient(q), q);
+   *     phi.integrate(EvaluationFlags::gradients);
+   *     for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+   *       phi.begin_dof_values()[i] += face_integrals[i];
+   *     phi.set_dof_values(dst);
+   *   }
+   * @endcode
+   * Note that the interior face values must be computed before the cell
+   * integral overwrites the degrees of freedom of @p phi. The flag
+   * MatrixFree::AdditionalData::mapping_update_flags_faces_by_cells needs to
+   * be set to make the geometry of the faces accessible from the cells, and
+   * MatrixFree::AdditionalData::hold_all_faces_to_owned_cells needs to be
+   * enabled in parallel computations. Querying the boundary id of the first
+   * lane only is valid if all cells of a batch share the same boundary ids,
+   * which can be ensured with MatrixFreeTools::categorize_by_boundary_ids().
+   *
    * @param cell_operation Pointer to member function of `CLASS` with the
    * signature <tt>cell_operation (const MatrixFree<dim,Number> &, OutVector &,
    * InVector &, std::pair<unsigned int,unsigned int> &)</tt> where the first
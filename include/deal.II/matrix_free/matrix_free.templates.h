@@ -25,6 +25,7 @@
 #include <deal.II/base/polynomials_piecewise.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/tensor_product_polynomials.h>
+#include <deal.II/base/utilities.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -43,6 +44,7 @@
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/face_setup_internal.h>
 #include <deal.II/matrix_free/hanging_nodes_internal.h>
+#include <deal.II/matrix_free/hilbert_ordering_internal.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
 #ifdef DEAL_II_WITH_TBB
@@ -51,7 +53,9 @@
 #  include <tbb/concurrent_unordered_map.h>
 #endif
 
+#include <algorithm>
 #include <fstream>
+#include <numeric>
 
 //
 // TBB with oneAPI API has deprecated and removed the
@@ -844,7 +848,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         additional_data.mapping_update_flags_boundary_faces,
         additional_data.mapping_update_flags_inner_faces,
         additional_data.mapping_update_flags_faces_by_cells,
-        piola_transform);
+        piola_transform,
+        additional_data.store_mapping_support_points);
 
       mapping_is_initialized = true;
     }
@@ -954,6 +959,21 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_dof_handlers(
 
   const Triangulation<dim> &tria  = dof_handlers[0]->get_triangulation();
   const unsigned int        level = additional_data.mg_level;
+
+  // position of the coarse cells along the Hilbert curve, unless provided by
+  // the user
+  std::vector<unsigned int> computed_rank;
+  if (additional_data.order_cells_along_hilbert_curve &&
+      additional_data.coarse_cell_hilbert_rank.empty())
+    computed_rank =
+      internal::MatrixFreeFunctions::compute_hilbert_rank_of_coarse_cells(tria);
+  const std::vector<unsigned int> &rank =
+    additional_data.coarse_cell_hilbert_rank.empty() ?
+      computed_rank :
+      additional_data.coarse_cell_hilbert_rank;
+  if (additional_data.order_cells_along_hilbert_curve)
+    AssertDimension(rank.size(), tria.n_cells(0));
+
   if (level == numbers::invalid_unsigned_int)
     {
       cell_level_index.reserve(tria.n_active_cells());
@@ -962,8 +982,21 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_dof_handlers(
       // children. This gives a z-ordering of the cells, which is beneficial
       // when setting up neighboring relations between cells for thread
       // parallelization
-      for (const auto &cell : tria.cell_iterators_on_level(0))
-        internal::MatrixFreeFunctions::resolve_cell(cell, cell_level_index);
+      if (additional_data.order_cells_along_hilbert_curve)
+        {
+          // visit the coarse cells in the order of the Hilbert curve through
+          // their centers
+          std::vector<unsigned int> coarse_cells(rank.size());
+          for (unsigned int i = 0; i < rank.size(); ++i)
+            coarse_cells[rank[i]] = i;
+          for (const unsigned int index : coarse_cells)
+            internal::MatrixFreeFunctions::resolve_cell(
+              typename Triangulation<dim>::cell_iterator(&tria, 0, index),
+              cell_level_index);
+        }
+      else
+        for (const auto &cell : tria.cell_iterators_on_level(0))
+          internal::MatrixFreeFunctions::resolve_cell(cell, cell_level_index);
 
       Assert(task_info.n_procs > 1 ||
                cell_level_index.size() == tria.n_active_cells(),
@@ -978,6 +1011,31 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_dof_handlers(
           for (const auto &cell : tria.cell_iterators_on_level(level))
             if (cell->is_locally_owned_on_level())
               cell_level_index.emplace_back(cell->level(), cell->index());
+
+          // sort the cells by the position of their coarse cell along the
+          // Hilbert curve, keeping the order of the cells within each coarse
+          // cell
+          if (additional_data.order_cells_along_hilbert_curve)
+            {
+              std::vector<std::pair<unsigned int, unsigned int>> rank_and_cell(
+                cell_level_index.size());
+              for (unsigned int i = 0; i < cell_level_index.size(); ++i)
+                {
+                  typename Triangulation<dim>::cell_iterator cell(
+                    &tria,
+                    cell_level_index[i].first,
+                    cell_level_index[i].second);
+                  while (cell->level() > 0)
+                    cell = cell->parent();
+                  rank_and_cell[i] = {rank[cell->index()], i};
+                }
+              std::sort(rank_and_cell.begin(), rank_and_cell.end());
+              std::vector<std::pair<unsigned int, unsigned int>> sorted_cells(
+                cell_level_index.size());
+              for (unsigned int i = 0; i < rank_and_cell.size(); ++i)
+                sorted_cells[i] = cell_level_index[rank_and_cell[i].second];
+              cell_level_index.swap(sorted_cells);
+            }
         }
     }
 
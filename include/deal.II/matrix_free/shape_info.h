@@ -379,6 +379,98 @@ namespace internal
 
 
 
+    /**
+     * This struct stores the shape functions of elements on wedges (prisms)
+     * that are products of shape functions on the triangle and shape
+     * functions on the line in z direction, such as FE_WedgeP, evaluated in
+     * a quadrature formula that is the product of a formula on the triangle
+     * and a one-dimensional formula, such as QGaussWedge. This allows to
+     * interpolate between the unknowns and the quadrature points with a
+     * dense product on the triangle followed by a one-dimensional product in
+     * z direction, similar to sum factorization, rather than with a dense
+     * product involving all shape functions of the element.
+     *
+     * The quadrature points are expected to be numbered with the points on
+     * the triangle running fastest, i.e., the point with index
+     * <code>q_line * n_q_points_triangle + q_triangle</code> is the product
+     * of the points with indices @p q_triangle and @p q_line.
+     */
+    template <typename Number>
+    struct WedgeShapeData
+    {
+      /**
+       * Empty constructor. Sets default configuration.
+       */
+      WedgeShapeData();
+
+      /**
+       * Return whether the data has been set up, i.e., whether the
+       * factorized evaluation can be used.
+       */
+      bool
+      empty() const;
+
+      /**
+       * Return the memory consumption of this class in bytes.
+       */
+      std::size_t
+      memory_consumption() const;
+
+      /**
+       * Number of shape functions on the triangle.
+       */
+      unsigned int n_dofs_triangle;
+
+      /**
+       * Number of shape functions on the line.
+       */
+      unsigned int n_dofs_line;
+
+      /**
+       * Number of quadrature points on the triangle.
+       */
+      unsigned int n_q_points_triangle;
+
+      /**
+       * Number of quadrature points on the line.
+       */
+      unsigned int n_q_points_line;
+
+      /**
+       * The values of the shape functions on the triangle in the quadrature
+       * points on the triangle, with the quadrature points running fastest.
+       */
+      AlignedVector<Number> shape_values_triangle;
+
+      /**
+       * The derivatives of the shape functions on the triangle in x and y
+       * direction, stored one after the other in the same layout as
+       * @p shape_values_triangle.
+       */
+      AlignedVector<Number> shape_gradients_triangle;
+
+      /**
+       * The values of the shape functions on the line in the quadrature
+       * points on the line, with the quadrature points running fastest.
+       */
+      AlignedVector<Number> shape_values_line;
+
+      /**
+       * The derivatives of the shape functions on the line.
+       */
+      AlignedVector<Number> shape_gradients_line;
+
+      /**
+       * The index of the shape function of the element that is the product
+       * of the shape function @p i on the triangle and the shape function
+       * @p j on the line, stored at position
+       * <code>j * n_dofs_triangle + i</code>.
+       */
+      std::vector<unsigned int> dof_numbering;
+    };
+
+
+
     /**
      * This struct stores a tensor (Kronecker) product view of the finite
      * element and quadrature formula used for evaluation. It is based on a
@@ -622,12 +714,35 @@ namespace internal
        * quadrature points to represent the correct order.
        */
       dealii::Table<2, unsigned int> face_orientations_quad;
+
+      /**
+       * Shape data for evaluating wedge elements with a dense product on the
+       * triangle and a one-dimensional product in z direction.
+       *
+       * @note This object is only filled in case @p element_type evaluates to
+       * @p tensor_none for an FE_WedgeP element of degree 2, and the
+       * quadrature formula is a product of a formula on the triangle and a
+       * one-dimensional formula with at least half as many points as the
+       * element has shape functions in z direction. For degree 1, the dense
+       * product with all shape functions is cheaper.
+       */
+      WedgeShapeData<Number> wedge_data;
     };
 
 
 
     // ------------------------------------------ inline functions
 
+    template <typename Number>
+    inline bool
+    WedgeShapeData<Number>::empty() const
+    {
+      return dof_numbering.empty();
+    }
+
+
+
+
     template <typename Number>
     inline const UnivariateShapeData<Number> &
     ShapeInfo<Number>::get_shape_data(const unsigned int dimension,
@@ -20,8 +20,10 @@
 
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/polynomial.h>
+#include <deal.II/base/polynomials_barycentric.h>
 #include <deal.II/base/polynomials_piecewise.h>
 #include <deal.II/base/polynomials_raviart_thomas.h>
+#include <deal.II/base/polynomials_wedge.h>
 #include <deal.II/base/qprojector.h>
 #include <deal.II/base/tensor_product_polynomials.h>
 #include <deal.II/base/utilities.h>
@@ -198,8 +200,159 @@ namespace internal
     }
 
 
+    // Set up the shape data for evaluating FE_WedgeP with a product on the
+    // triangle and a product in z direction, see WedgeShapeData. Leaves the
+    // data empty if the element or the quadrature formula do not allow for
+    // this factorization.
+    template <int dim, int spacedim, typename Number>
+    void
+    compute_wedge_shape_data(const FiniteElement<dim, spacedim> &fe,
+                             const Quadrature<dim>              &quad,
+                             const AlignedVector<Number>        &shape_values,
+                             WedgeShapeData<Number>             &wedge_data)
+    {
+      wedge_data = WedgeShapeData<Number>();
+
+      if constexpr (dim == 3)
+        {
+          const auto fe_poly =
+            dynamic_cast<const FE_Poly<dim, spacedim> *>(&fe);
+          // for linear elements, the dense product with the 6 x 6 shape
+          // function matrix is faster than the two stages of the factorized
+          // kernel, so only use the factorization from degree 2 on
+          if (fe_poly == nullptr ||
+              dynamic_cast<const ScalarLagrangePolynomialWedge<dim> *>(
+                &fe_poly->get_poly_space()) == nullptr ||
+              fe.degree != 2 || quad.empty())
+            return;
+
+          // the points on the triangle are the leading points that share the
+          // z coordinate of the first point; check that the other points are
+          // the products with the points in z direction
+          const unsigned int n_q_points          = quad.size();
+          unsigned int       n_q_points_triangle = 1;
+          while (n_q_points_triangle < n_q_points &&
+                 quad.point(n_q_points_triangle)[2] == quad.point(0)[2])
+            ++n_q_points_triangle;
+          if (n_q_points % n_q_points_triangle != 0)
+            return;
+          const unsigned int n_q_points_line = n_q_points / n_q_points_triangle;
+          for (unsigned int ql = 0; ql < n_q_points_line; ++ql)
+            for (unsigned int qt = 0; qt < n_q_points_triangle; ++qt)
+              {
+                const Point<dim> &p = quad.point(ql * n_q_points_triangle + qt);
+                if (p[0] != quad.point(qt)[0] || p[1] != quad.point(qt)[1] ||
+                    p[2] != quad.point(ql * n_q_points_triangle)[2])
+                  return;
+              }
+
+          // the intermediate result on the triangle must fit into the scratch
+          // data of FEEvaluation, which holds two entries per quadrature point
+          // in addition to the unknowns
+          const unsigned int n_dofs_line = fe.degree + 1;
+          if (n_dofs_line > 2 * n_q_points_line)
+            return;
+
+          const BarycentricPolynomials<2> poly_triangle =
+            BarycentricPolynomials<2>::get_fe_p_basis(fe.degree);
+          const BarycentricPolynomials<1> poly_line =
+            BarycentricPolynomials<1>::get_fe_p_basis(fe.degree);
+          const unsigned int n_dofs_triangle = poly_triangle.n();
+          AssertDimension(n_dofs_triangle * n_dofs_line, fe.n_dofs_per_cell());
+
+          wedge_data.n_dofs_triangle     = n_dofs_triangle;
+          wedge_data.n_dofs_line         = n_dofs_line;
+          wedge_data.n_q_points_triangle = n_q_points_triangle;
+          wedge_data.n_q_points_line     = n_q_points_line;
+
+          wedge_data.shape_values_triangle.resize(n_dofs_triangle *
+                                                  n_q_points_triangle);
+          wedge_data.shape_gradients_triangle.resize(2 * n_dofs_triangle *
+                                                     n_q_points_triangle);
+          for (unsigned int i = 0; i < n_dofs_triangle; ++i)
+            for (unsigned int q = 0; q < n_q_points_triangle; ++q)
+              {
+                const Point<2> p(quad.point(q)[0], quad.point(q)[1]);
+                wedge_data.shape_values_triangle[i * n_q_points_triangle + q] =
+                  poly_triangle.compute_value(i, p);
+                const Tensor<1, 2> grad = poly_triangle.compute_grad(i, p);
+                for (unsigned int d = 0; d < 2; ++d)
+                  wedge_data.shape_gradients_triangle
+                    [(d * n_dofs_triangle + i) * n_q_points_triangle + q] =
+                    grad[d];
+              }
+
+          wedge_data.shape_values_line.resize(n_dofs_line * n_q_points_line);
+          wedge_data.shape_gradients_line.resize(n_dofs_line *
+                                                 n_q_points_line);
+          for (unsigned int i = 0; i < n_dofs_line; ++i)
+            for (unsigned int q = 0; q < n_q_points_line; ++q)
+              {
+                const Point<1> p(quad.point(q * n_q_points_triangle)[2]);
+                wedge_data.shape_values_line[i * n_q_points_line + q] =
+                  poly_line.compute_value(i, p);
+                wedge_data.shape_gradients_line[i * n_q_points_line + q] =
+                  poly_line.compute_grad(i, p)[0];
+              }
+
+          wedge_data.dof_numbering.resize(fe.n_dofs_per_cell());
+          for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+            {
+              const auto pair = internal::wedge_table_2[i];
+              wedge_data.dof_numbering[pair[1] * n_dofs_triangle + pair[0]] = i;
+            }
+
+          // make sure that the factorization reproduces the shape functions
+          // of the element
+          using ScalarNumber =
+            typename VectorizedArrayTrait<Number>::value_type;
+          const double tolerance =
+            100. * std::numeric_limits<ScalarNumber>::epsilon();
+          for (unsigned int j = 0; j < n_dofs_line; ++j)
+            for (unsigned int i = 0; i < n_dofs_triangle; ++i)
+              for (unsigned int ql = 0; ql < n_q_points_line; ++ql)
+                for (unsigned int qt = 0; qt < n_q_points_triangle; ++qt)
+                  {
+                    const unsigned int dof =
+                      wedge_data.dof_numbering[j * n_dofs_triangle + i];
+                    const double value_triangle = get_first_array_element(
+                      wedge_data.shape_values_triangle[i * n_q_points_triangle +
+                                                       qt]);
+                    const double value_line = get_first_array_element(
+                      wedge_data.shape_values_line[j * n_q_points_line + ql]);
+                    const double value = get_first_array_element(
+                      shape_values[dof * n_q_points + ql * n_q_points_triangle +
+                                   qt]);
+                    if (std::abs(value - value_triangle * value_line) >
+                        tolerance)
+                      {
+                        wedge_data = WedgeShapeData<Number>();
+                        return;
+                      }
+                  }
+        }
+      else
+        {
+          (void)fe;
+          (void)quad;
+          (void)shape_values;
+        }
+    }
+
+
+
     // ----------------- actual ShapeInfo implementation --------------------
 
+    template <typename Number>
+    WedgeShapeData<Number>::WedgeShapeData()
+      : n_dofs_triangle(0)
+      , n_dofs_line(0)
+      , n_q_points_triangle(0)
+      , n_q_points_line(0)
+    {}
+
+
+
     template <typename Number>
     ShapeInfo<Number>::ShapeInfo()
       : element_type(tensor_general)
@@ -574,6 +727,8 @@ namespace internal
                     DEAL_II_NOT_IMPLEMENTED();
                 }
             }
+          compute_wedge_shape_data(fe, quad, shape_values, wedge_data);
+
           // TODO: set up face_to_cell_index_nodal, face_to_cell_index_hermite,
           //  face_orientations
 
@@ -1320,6 +1475,22 @@ namespace internal
       std::size_t memory = sizeof(*this);
       for (const auto &univariate_shape_data : data)
         memory += univariate_shape_data.memory_consumption();
+      memory += wedge_data.memory_consumption();
+      return memory;
+    }
+
+
+
+    template <typename Number>
+    std::size_t
+    WedgeShapeData<Number>::memory_consumption() const
+    {
+      std::size_t memory = sizeof(*this);
+      memory += MemoryConsumption::memory_consumption(shape_values_triangle);
+      memory += MemoryConsumption::memory_consumption(shape_gradients_triangle);
+      memory += MemoryConsumption::memory_consumption(shape_values_line);
+      memory += MemoryConsumption::memory_consumption(shape_gradients_line);
+      memory += MemoryConsumption::memory_consumption(dof_numbering);
       return memory;
     }
 
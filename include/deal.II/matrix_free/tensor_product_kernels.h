@@ -185,6 +185,59 @@ namespace internal
 
 
 
+  /**
+   * Matrix-vector kernel for run-time loop bounds where the length of the
+   * summation is rounded up to the compile-time bound @p mm_max, used for
+   * short summations in the generic evaluator. The input is copied into a
+   * zero-padded array, and the matrix entries beyond the actual length are
+   * replaced by the last valid entry, such that the fully unrolled loop
+   * gives the same result as the loop with run-time bounds. As all input
+   * entries are read before the output is written, @p in and @p out may
+   * overlap.
+   */
+  template <int  mm_max,
+            bool transpose_matrix,
+            bool add,
+            typename Number,
+            typename Number2>
+  inline void
+  apply_matrix_vector_product_bucketed(const Number2 *matrix,
+                                       const Number  *in,
+                                       Number        *out,
+                                       const int      n_rows,
+                                       const int      n_columns,
+                                       const int      stride_in,
+                                       const int      stride_out)
+  {
+    const int mm = transpose_matrix ? n_rows : n_columns,
+              nn = transpose_matrix ? n_columns : n_rows;
+    Assert(mm > 0 && mm <= mm_max, ExcIndexRange(mm, 1, mm_max + 1));
+
+    std::array<Number, mm_max> x;
+    std::array<int, mm_max>    matrix_offset;
+    for (int i = 0; i < mm_max; ++i)
+      {
+        x[i] = (i < mm) ? in[stride_in * i] : Number();
+        matrix_offset[i] =
+          std::min(i, mm - 1) * (transpose_matrix ? n_columns : 1);
+      }
+
+    for (int col = 0; col < nn; ++col)
+      {
+        const Number2 *matrix_ptr =
+          transpose_matrix ? matrix + col : matrix + col * n_columns;
+        Number res0 = matrix_ptr[matrix_offset[0]] * x[0];
+        for (int i = 1; i < mm_max; ++i)
+          res0 += matrix_ptr[matrix_offset[i]] * x[i];
+        if (add)
+          out[stride_out * col] += res0;
+        else
+          out[stride_out * col] = res0;
+      }
+  }
+
+
+
   /**
    * Specialization of the matrix-vector kernel for run-time loop bounds in
    * the generic evaluator.
@@ -1819,39 +1872,85 @@ namespace internal
 
     constexpr int stride_in  = !contract_over_rows ? stride : 1;
     constexpr int stride_out = contract_over_rows ? stride : 1;
-    for (int i2 = 0; i2 < n_blocks2; ++i2)
-      {
-        for (int i1 = 0; i1 < n_blocks1; ++i1)
-          {
-            // the empty template case can only run the general evaluator or
-            // evenodd
-            constexpr EvaluatorVariant restricted_variant =
-              variant == evaluate_evenodd ? evaluate_evenodd : evaluate_general;
-            apply_matrix_vector_product<restricted_variant,
-                                        quantity,
-                                        contract_over_rows,
-                                        add,
-                                        (direction != 0 || stride != 1)>(
-              shape_data,
-              in,
-              out,
-              n_rows,
-              n_columns,
-              stride_operation * stride_in,
-              stride_operation * stride_out);
 
-            if (one_line == false)
-              {
-                in += stride_in;
-                out += stride_out;
-              }
-          }
-        if (one_line == false)
+    // loop over all lines in the given direction, calling the given kernel
+    // for the matrix-vector product along each line
+    const auto apply_on_lines = [&](const auto &kernel) {
+      for (int i2 = 0; i2 < n_blocks2; ++i2)
+        {
+          for (int i1 = 0; i1 < n_blocks1; ++i1)
+            {
+              kernel(in, out);
+
+              if (one_line == false)
+                {
+                  in += stride_in;
+                  out += stride_out;
+                }
+            }
+          if (one_line == false)
+            {
+              in += stride_operation * (mm - 1) * stride_in;
+              out += stride_operation * (nn - 1) * stride_out;
+            }
+        }
+    };
+
+    // the empty template case can only run the general evaluator or
+    // evenodd
+    constexpr EvaluatorVariant restricted_variant =
+      variant == evaluate_evenodd ? evaluate_evenodd : evaluate_general;
+
+    // for the general evaluator with short sums, round the length of the
+    // summation up to an even number known at compile time, selected once
+    // for all lines, which lets the compiler unroll the loops and keep the
+    // input of the line in registers
+    const auto apply_bucketed = [&](auto mm_max) {
+      apply_on_lines([&](const Number *in_line, Number *out_line) {
+        apply_matrix_vector_product_bucketed<decltype(mm_max)::value,
+                                             contract_over_rows,
+                                             add>(shape_data,
+                                                  in_line,
+                                                  out_line,
+                                                  n_rows,
+                                                  n_columns,
+                                                  stride_operation * stride_in,
+                                                  stride_operation *
+                                                    stride_out);
+      });
+    };
+    if constexpr (restricted_variant == evaluate_general)
+      {
+        if (mm >= 1 && mm <= 12)
           {
-            in += stride_operation * (mm - 1) * stride_in;
-            out += stride_operation * (nn - 1) * stride_out;
+            if (mm <= 4)
+              apply_bucketed(std::integral_constant<int, 4>());
+            else if (mm <= 6)
+              apply_bucketed(std::integral_constant<int, 6>());
+            else if (mm <= 8)
+              apply_bucketed(std::integral_constant<int, 8>());
+            else if (mm <= 10)
+              apply_bucketed(std::integral_constant<int, 10>());
+            else
+              apply_bucketed(std::integral_constant<int, 12>());
+            return;
           }
       }
+
+    apply_on_lines([&](const Number *in_line, Number *out_line) {
+      apply_matrix_vector_product<restricted_variant,
+                                  quantity,
+                                  contract_over_rows,
+                                  add,
+                                  (direction != 0 || stride != 1)>(
+        shape_data,
+        in_line,
+        out_line,
+        n_rows,
+        n_columns,
+        stride_operation * stride_in,
+        stride_operation * stride_out);
+    });
   }
 
 
@@ -20,6 +20,7 @@
 #include <deal.II/grid/tria.h>
 
 #include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/hilbert_ordering_internal.h>
 #include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/matrix_free/vector_access_internal.h>
 
@@ -70,6 +71,19 @@ namespace MatrixFreeTools
 
 
 
+  /**
+   * Return the position of each coarse cell of @p tria along a Hilbert curve
+   * through the cell centers, indexed by cell->index() on level zero. The
+   * result can be stored in
+   * MatrixFree::AdditionalData::coarse_cell_hilbert_rank to share it between
+   * the MatrixFree objects of the levels of a multigrid hierarchy.
+   */
+  template <int dim>
+  std::vector<unsigned int>
+  compute_hilbert_rank_of_coarse_cells(const Triangulation<dim> &tria);
+
+
+
   /**
    * Compute the diagonal of a linear operator (@p diagonal_global), given
    * @p matrix_free and the local cell integral operation @p cell_operation. The
@@ -687,6 +701,16 @@ namespace MatrixFreeTools
       additional_data.mapping_update_flags_boundary_faces;
   }
 
+
+
+  template <int dim>
+  std::vector<unsigned int>
+  compute_hilbert_rank_of_coarse_cells(const Triangulation<dim> &tria)
+  {
+    return dealii::internal::MatrixFreeFunctions::
+      compute_hilbert_rank_of_coarse_cells(tria);
+  }
+
   namespace internal
   {
     template <typename Number>
@@ -870,6 +870,112 @@ IndexSet::index_within_set_binary_search(const size_type n) const
 
 
 
+namespace
+{
+  // Return the first element in [first, last) for which comp(element, value)
+  // is false, like std::lower_bound, but search with exponentially growing
+  // steps from first, which is cheaper if the result is close to first.
+  template <typename Iterator, typename T, typename Comparator>
+  Iterator
+  exponential_lower_bound(Iterator         first,
+                          const Iterator   last,
+                          const T         &value,
+                          const Comparator comp)
+  {
+    if (first == last || !comp(*first, value))
+      return first;
+
+    std::size_t step = 1;
+    while (step < static_cast<std::size_t>(last - first) &&
+           comp(*(first + step), value))
+      {
+        first += step;
+        step *= 2;
+      }
+    return std::lower_bound(first + 1,
+                            first + std::min<std::size_t>(step, last - first),
+                            value,
+                            comp);
+  }
+} // namespace
+
+
+
+void
+IndexSet::nth_index_in_set(const ArrayView<const size_type> &local_indices,
+                           const ArrayView<size_type> &global_indices) const
+{
+  AssertDimension(local_indices.size(), global_indices.size());
+
+  compress();
+
+  // 'range' points to the first range that ends after the previous index,
+  // which is where the search for the next index starts
+  std::vector<Range>::const_iterator range = ranges.begin();
+  for (unsigned int i = 0; i < local_indices.size(); ++i)
+    {
+      const size_type n = local_indices[i];
+      AssertIndexRange(n, n_elements());
+
+      Range r(n, n + 1);
+      r.nth_index_in_set = n;
+      if (range != ranges.begin() &&
+          n < std::prev(range)->nth_index_in_set +
+                (std::prev(range)->end - std::prev(range)->begin))
+        range = Utilities::lower_bound(ranges.cbegin(),
+                                       range,
+                                       r,
+                                       Range::nth_index_compare);
+      else
+        range = exponential_lower_bound(range,
+                                        ranges.cend(),
+                                        r,
+                                        Range::nth_index_compare);
+
+      Assert(range != ranges.end(), ExcInternalError());
+      global_indices[i] = range->begin + (n - range->nth_index_in_set);
+    }
+}
+
+
+
+void
+IndexSet::index_within_set(const ArrayView<const size_type> &global_indices,
+                           const ArrayView<size_type> &local_indices) const
+{
+  AssertDimension(global_indices.size(), local_indices.size());
+
+  // to make this call thread-safe, compress() must not be called through this
+  // function
+  Assert(is_compressed == true, ExcMessage("IndexSet must be compressed."));
+
+  // 'range' points to the first range that ends after the previous index,
+  // which is where the search for the next index starts
+  std::vector<Range>::const_iterator range = ranges.begin();
+  for (unsigned int i = 0; i < global_indices.size(); ++i)
+    {
+      const size_type n = global_indices[i];
+      AssertIndexRange(n, size());
+
+      const Range r(n + 1, n + 1);
+      if (range != ranges.begin() && n < std::prev(range)->end)
+        range = Utilities::lower_bound(ranges.cbegin(),
+                                       range,
+                                       r,
+                                       Range::end_compare);
+      else
+        range =
+          exponential_lower_bound(range, ranges.cend(), r, Range::end_compare);
+
+      if (range != ranges.end() && range->begin <= n)
+        local_indices[i] = (n - range->begin) + range->nth_index_in_set;
+      else
+        local_indices[i] = numbers::invalid_dof_index;
+    }
+}
+
+
+
 IndexSet::ElementIterator
 IndexSet::at(const size_type global_index) const
 {
@@ -17,8 +17,11 @@
 
 #include <algorithm>
 #include <cstdlib> // for std::getenv
+#include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #ifdef DEAL_II_WITH_TBB
 #  ifdef DEAL_II_TBB_WITH_ONEAPI
@@ -26,6 +29,12 @@
 #  else
 #    include <tbb/task_scheduler_init.h>
 #  endif
+#  include <tbb/task_arena.h>
+#  include <tbb/task_scheduler_observer.h>
+#endif
+
+#ifdef __linux__
+#  include <sched.h>
 #endif
 
 
@@ -36,6 +45,66 @@
 DEAL_II_NAMESPACE_OPEN
 
 
+#if defined(DEAL_II_WITH_TBB) && defined(__linux__)
+namespace
+{
+  /**
+   * An observer of the task scheduler that binds each thread entering it
+   * to a core, chosen by the index of the thread within the scheduler.
+   */
+  class ThreadPinningObserver : public tbb::task_scheduler_observer
+  {
+  public:
+    ThreadPinningObserver(const MultithreadInfo::ThreadAffinity affinity,
+                          const std::vector<int>               &cpus,
+                          const unsigned int                    n_threads)
+      : affinity(affinity)
+      , cpus(cpus)
+      , n_threads(std::max(n_threads, 1U))
+    {
+      observe(true);
+    }
+
+    ~ThreadPinningObserver() override
+    {
+      observe(false);
+    }
+
+    virtual void
+    on_scheduler_entry(bool /*is_worker*/) override
+    {
+      const int thread_index = tbb::this_task_arena::current_thread_index();
+      if (thread_index < 0 || cpus.empty())
+        return;
+
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      if (affinity == MultithreadInfo::ThreadAffinity::none)
+        for (const int cpu : cpus)
+          CPU_SET(cpu, &cpu_set);
+      else
+        {
+          const std::size_t n_cpus = cpus.size();
+          std::size_t       index  = thread_index % n_cpus;
+          if (affinity == MultithreadInfo::ThreadAffinity::scatter &&
+              n_threads < n_cpus)
+            index = (thread_index % n_threads) * n_cpus / n_threads;
+          CPU_SET(cpus[index], &cpu_set);
+        }
+      // failures only mean that the thread keeps its previous placement
+      sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+    }
+
+  private:
+    const MultithreadInfo::ThreadAffinity affinity;
+    const std::vector<int>                cpus;
+    const std::size_t                     n_threads;
+  };
+} // namespace
+#endif
+
+
+
 unsigned int
 MultithreadInfo::n_cores()
 {
@@ -155,11 +224,68 @@ MultithreadInfo::initialize_multithreading()
   static std::once_flag is_initialized;
   std::call_once(is_initialized, []() {
     MultithreadInfo::set_thread_limit(numbers::invalid_unsigned_int);
+
+    if (const char *penv = std::getenv("DEAL_II_THREAD_AFFINITY"))
+      {
+        const std::string value(penv);
+        if (value == "compact")
+          MultithreadInfo::set_thread_affinity(ThreadAffinity::compact);
+        else if (value == "scatter")
+          MultithreadInfo::set_thread_affinity(ThreadAffinity::scatter);
+        else
+          AssertThrow(value == "none",
+                      ExcMessage("When specifying the "
+                                 "<DEAL_II_THREAD_AFFINITY> environment "
+                                 "variable, it needs to be one of <none>, "
+                                 "<compact>, or <scatter>. The text you have "
+                                 "in the environment variable is <" +
+                                 value + ">"));
+      }
   });
 }
 
 
 
+void
+MultithreadInfo::set_thread_affinity(const ThreadAffinity affinity)
+{
+  thread_affinity = affinity;
+
+#if defined(DEAL_II_WITH_TBB) && defined(__linux__)
+  // Record the cores the process may run on before any thread gets bound to
+  // a single one, so that later calls see the same set.
+  static const std::vector<int> cpus = []() {
+    std::vector<int> cpus;
+    cpu_set_t        cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0)
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        if (CPU_ISSET(cpu, &cpu_set))
+          cpus.push_back(cpu);
+    return cpus;
+  }();
+
+  // Like tbb::global_control in set_thread_limit(), the observer must live
+  // as long as the policy is active. For ThreadAffinity::none, it releases
+  // threads that have been bound before.
+  static std::unique_ptr<ThreadPinningObserver> observer;
+  observer.reset();
+  if (cpus.size() > 0)
+    observer =
+      std::make_unique<ThreadPinningObserver>(affinity, cpus, n_threads());
+#endif
+}
+
+
+
+MultithreadInfo::ThreadAffinity
+MultithreadInfo::get_thread_affinity()
+{
+  return thread_affinity;
+}
+
+
+
 #ifdef DEAL_II_WITH_TASKFLOW
 tf::Executor &
 MultithreadInfo::get_taskflow_executor()
@@ -179,6 +305,9 @@ std::unique_ptr<tf::Executor> MultithreadInfo::executor = nullptr;
 
 unsigned int MultithreadInfo::n_max_threads = numbers::invalid_unsigned_int;
 
+MultithreadInfo::ThreadAffinity MultithreadInfo::thread_affinity =
+  MultithreadInfo::ThreadAffinity::none;
+
 namespace
 {
   // Force the first call to set_thread_limit happen before any tasks in TBB are
@@ -19,6 +19,8 @@
 #include <boost/serialization/utility.hpp>
 
 #include <limits>
+#include <list>
+#include <mutex>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -27,6 +29,154 @@ namespace Utilities
 {
   namespace MPI
   {
+    namespace
+    {
+      /**
+       * A communication pattern computed by Partitioner::set_ghost_indices(),
+       * together with the index sets and the communicator it was computed
+       * for.
+       */
+      struct CachedCommunicationPattern
+      {
+        MPI_Comm                                           communicator;
+        unsigned int                                       generation;
+        std::size_t                                        hash;
+        IndexSet                                           locally_owned_range;
+        IndexSet                                           ghost_indices;
+        std::vector<std::pair<unsigned int, unsigned int>> ghost_targets;
+        std::vector<std::pair<unsigned int, unsigned int>> import_targets;
+        std::vector<std::pair<unsigned int, unsigned int>> import_indices;
+        std::vector<unsigned int> import_indices_chunks_by_rank;
+        unsigned int              n_import_indices;
+      };
+
+
+
+      /**
+       * The cache of communication patterns, with the most recently used
+       * pattern first. The generation counter is incremented for every
+       * pattern added to the cache; all processes of a communicator agree on
+       * the generation of a new pattern, which identifies the patterns that
+       * were computed together. The number of lookups that could and could
+       * not use a cached pattern is recorded in @p n_hits and @p n_misses.
+       */
+      struct CommunicationPatternCache
+      {
+        std::mutex                            mutex;
+        std::list<CachedCommunicationPattern> patterns;
+        unsigned int                          generation = 0;
+        unsigned int                          n_hits     = 0;
+        unsigned int                          n_misses   = 0;
+      };
+
+
+
+      /**
+       * The maximal number of patterns kept in the cache.
+       */
+      constexpr unsigned int max_n_cached_communication_patterns = 32;
+
+
+
+      CommunicationPatternCache &
+      get_communication_pattern_cache()
+      {
+        static CommunicationPatternCache cache;
+        return cache;
+      }
+
+
+
+#  ifdef DEAL_II_WITH_MPI
+      /**
+       * Remove the patterns of a communicator from the cache. This function
+       * is the delete callback of the attribute set by
+       * attach_cache_eviction(), which MPI calls when the communicator is
+       * freed, i.e., before its handle can be reused for a different
+       * communicator.
+       */
+      int
+      evict_communication_patterns(MPI_Comm communicator,
+                                   int /*keyval*/,
+                                   void * /*attribute_value*/,
+                                   void * /*extra_state*/)
+      {
+        CommunicationPatternCache  &cache = get_communication_pattern_cache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.patterns.remove_if(
+          [communicator](const CachedCommunicationPattern &entry) {
+            return entry.communicator == communicator;
+          });
+        return MPI_SUCCESS;
+      }
+
+
+
+      /**
+       * Make sure that the patterns cached for @p communicator are removed
+       * from the cache when the communicator is freed, by attaching an
+       * attribute with evict_communication_patterns() as delete callback.
+       * The attribute is not copied to duplicates of the communicator.
+       */
+      void
+      attach_cache_eviction(const MPI_Comm communicator)
+      {
+        static const int keyval = []() {
+          int       keyval;
+          const int ierr =
+            MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                                   &evict_communication_patterns,
+                                   &keyval,
+                                   nullptr);
+          AssertThrowMPI(ierr);
+          return keyval;
+        }();
+
+        void *attribute_value;
+        int   flag;
+        int   ierr =
+          MPI_Comm_get_attr(communicator, keyval, &attribute_value, &flag);
+        AssertThrowMPI(ierr);
+        if (flag == 0)
+          {
+            ierr = MPI_Comm_set_attr(communicator, keyval, nullptr);
+            AssertThrowMPI(ierr);
+          }
+      }
+
+
+
+      /**
+       * Compute a hash of the ranges of two index sets.
+       */
+      std::size_t
+      compute_hash(const IndexSet &locally_owned_range,
+                   const IndexSet &ghost_indices)
+      {
+        std::size_t hash    = 0;
+        const auto  combine = [&hash](const types::global_dof_index value) {
+          hash ^= std::hash<types::global_dof_index>()(value) + 0x9e3779b9 +
+                  (hash << 6) + (hash >> 2);
+        };
+        combine(locally_owned_range.size());
+        for (const IndexSet *set : {&locally_owned_range, &ghost_indices})
+          {
+            combine(set->n_intervals());
+            for (auto interval = set->begin_intervals();
+                 interval != set->end_intervals();
+                 ++interval)
+              {
+                combine(*interval->begin());
+                combine(interval->last());
+              }
+          }
+        return hash;
+      }
+#  endif
+    } // namespace
+
+
+
     Partitioner::Partitioner()
       : global_size(0)
       , local_range_data(
@@ -262,50 +412,297 @@ namespace Utilities
           local_range_data.second = my_shift + old_locally_owned_size;
         }
 
-      std::vector<unsigned int> owning_ranks_of_ghosts(
-        ghost_indices_data.n_elements());
-
-      // set up dictionary
-      internal::ComputeIndexOwner::ConsensusAlgorithmsPayload process(
-        locally_owned_range_data,
-        ghost_indices_data,
-        communicator,
-        owning_ranks_of_ghosts,
-        /* track origins of ghosts*/ true);
-
-      // read dictionary by communicating with the process who owns the index
-      // in the static partition (i.e. in the dictionary). This process
-      // returns the actual owner of the index.
-      ConsensusAlgorithms::Selector<
-        std::vector<
-          std::pair<types::global_dof_index, types::global_dof_index>>,
-        std::vector<unsigned int>>
-        consensus_algorithm;
-      consensus_algorithm.run(process, communicator);
-
+      // Look up the communication pattern in the cache. The pattern can
+      // only be reused if all processes find an entry of the same
+      // generation, because the pattern also depends on the index sets of
+      // the other processes. To check this with a single reduction, we
+      // compute the minimum of the generation and of the bitwise complement
+      // of the generation (which gives the maximum), together with the
+      // maximum of the generation counter to be used for a new entry.
+      CommunicationPatternCache &cache = get_communication_pattern_cache();
+      const std::size_t hash =
+        compute_hash(locally_owned_range_data, ghost_indices_data);
+      unsigned int local_generation[3] = {numbers::invalid_unsigned_int,
+                                          0,
+                                          0};
       {
-        ghost_targets_data = {};
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        local_generation[2] = ~cache.generation;
+        for (const CachedCommunicationPattern &pattern : cache.patterns)
+          if (pattern.hash == hash && pattern.communicator == communicator &&
+              pattern.locally_owned_range == locally_owned_range_data &&
+              pattern.ghost_indices == ghost_indices_data)
+            {
+              // copy the data already now; it gets overwritten below in case
+              // the other processes do not agree
+              local_generation[0] = pattern.generation;
+              ghost_targets_data  = pattern.ghost_targets;
+              import_targets_data = pattern.import_targets;
+              import_indices_data = pattern.import_indices;
+              import_indices_chunks_by_rank_data =
+                pattern.import_indices_chunks_by_rank;
+              n_import_indices_data = pattern.n_import_indices;
+              break;
+            }
+      }
+      local_generation[1] = ~local_generation[0];
+      unsigned int global_generation[3];
+      Utilities::MPI::min(local_generation, communicator, global_generation);
+
+      if (global_generation[0] == numbers::invalid_unsigned_int ||
+          global_generation[0] != ~global_generation[1])
+        {
+          attach_cache_eviction(communicator);
+
+          std::vector<unsigned int> owning_ranks_of_ghosts(
+            ghost_indices_data.n_elements());
+
+          // set up dictionary
+          internal::ComputeIndexOwner::ConsensusAlgorithmsPayload process(
+            locally_owned_range_data,
+            ghost_indices_data,
+            communicator,
+            owning_ranks_of_ghosts,
+            /* track origins of ghosts*/ true);
+
+          // read dictionary by communicating with the process who owns the
+          // index in the static partition (i.e. in the dictionary). This
+          // process returns the actual owner of the index.
+          ConsensusAlgorithms::Selector<
+            std::vector<
+              std::pair<types::global_dof_index, types::global_dof_index>>,
+            std::vector<unsigned int>>
+            consensus_algorithm;
+          consensus_algorithm.run(process, communicator);
+
+          ghost_targets_data = {};
+          if (owning_ranks_of_ghosts.size() > 0)
+            {
+              ghost_targets_data.emplace_back(owning_ranks_of_ghosts[0], 0);
+              for (auto i : owning_ranks_of_ghosts)
+                {
+                  Assert(i >= ghost_targets_data.back().first,
+                         ExcInternalError(
+                           "Expect result of ConsensusAlgorithms::Process to "
+                           "be sorted."));
+                  if (i == ghost_targets_data.back().first)
+                    ghost_targets_data.back().second++;
+                  else
+                    ghost_targets_data.emplace_back(i, 1);
+                }
+            }
+
+          // find how much the individual processes that want import from me
+          set_import_data(process.get_requesters());
+
+          // store the new pattern, replacing older entries for the same
+          // index sets
+          CachedCommunicationPattern pattern;
+          pattern.communicator        = communicator;
+          pattern.generation          = ~global_generation[2] + 1;
+          pattern.hash                = hash;
+          pattern.locally_owned_range = locally_owned_range_data;
+          pattern.ghost_indices       = ghost_indices_data;
+          pattern.ghost_targets       = ghost_targets_data;
+          pattern.import_targets      = import_targets_data;
+          pattern.import_indices      = import_indices_data;
+          pattern.import_indices_chunks_by_rank =
+            import_indices_chunks_by_rank_data;
+          pattern.n_import_indices = n_import_indices_data;
+
+          std::lock_guard<std::mutex> lock(cache.mutex);
+          ++cache.n_misses;
+          cache.generation = pattern.generation;
+          cache.patterns.remove_if(
+            [&](const CachedCommunicationPattern &entry) {
+              return entry.hash == hash && entry.communicator == communicator &&
+                     entry.locally_owned_range == locally_owned_range_data &&
+                     entry.ghost_indices == ghost_indices_data;
+            });
+          cache.patterns.push_front(std::move(pattern));
+          if (cache.patterns.size() > max_n_cached_communication_patterns)
+            cache.patterns.pop_back();
+        }
+      else
+        {
+          // move the entry to the front of the list
+          std::lock_guard<std::mutex> lock(cache.mutex);
+          ++cache.n_hits;
+          for (auto it = cache.patterns.begin(); it != cache.patterns.end();
+               ++it)
+            if (it->generation == global_generation[0] && it->hash == hash &&
+                it->communicator == communicator)
+              {
+                cache.patterns.splice(cache.patterns.begin(),
+                                      cache.patterns,
+                                      it);
+                break;
+              }
+        }
+
+#  endif // #ifdef DEAL_II_WITH_MPI
+
+      finish_ghost_indices_setup(larger_ghost_index_set);
+    }
+
 
-        if (owning_ranks_of_ghosts.size() > 0)
+
+    void
+    Partitioner::reinit_from_superset(const Partitioner &superset,
+                                      const IndexSet    &ghost_indices_in,
+                                      const IndexSet    &larger_ghost_index_set)
+    {
+      global_size              = superset.global_size;
+      locally_owned_range_data = superset.locally_owned_range_data;
+      local_range_data         = superset.local_range_data;
+      my_pid                   = superset.my_pid;
+      n_procs                  = superset.n_procs;
+      communicator             = superset.communicator;
+
+      ghost_indices_data = ghost_indices_in;
+      if (ghost_indices_data.size() != locally_owned_range_data.size())
+        ghost_indices_data.set_size(locally_owned_range_data.size());
+      ghost_indices_data.subtract_set(locally_owned_range_data);
+      ghost_indices_data.compress();
+      Assert((ghost_indices_data & superset.ghost_indices_data) ==
+               ghost_indices_data,
+             ExcMessage("The ghost indices must be a subset of the ghost "
+                        "indices of the given partitioner."));
+      n_ghost_indices_data = ghost_indices_data.n_elements();
+
+      have_ghost_indices =
+        Utilities::MPI::max(n_ghost_indices_data, communicator) > 0;
+
+#  ifdef DEAL_II_WITH_MPI
+      if (n_procs < 2)
+        {
+          Assert(ghost_indices_data.n_elements() == 0, ExcInternalError());
+          Assert(n_ghost_indices_data == 0, ExcInternalError());
+          n_import_indices_data = 0;
+          return;
+        }
+
+      // find the owner of each ghost index through its position in the ghost
+      // indices of the superset, whose ghost_targets_data lists the owners
+      // in the same order, and collect the indices requested from each owner
+      const std::vector<types::global_dof_index> ghost_indices =
+        ghost_indices_data.get_index_vector();
+      std::vector<types::global_dof_index> positions_in_superset(
+        ghost_indices.size());
+      superset.ghost_indices_data.compress();
+      superset.ghost_indices_data.index_within_set(
+        make_array_view(ghost_indices), make_array_view(positions_in_superset));
+
+      std::vector<std::vector<types::global_dof_index>> requested_indices(
+        superset.ghost_targets_data.size());
+      {
+        unsigned int            target     = 0;
+        types::global_dof_index target_end = 0;
+        for (unsigned int i = 0; i < ghost_indices.size(); ++i)
           {
-            ghost_targets_data.emplace_back(owning_ranks_of_ghosts[0], 0);
-            for (auto i : owning_ranks_of_ghosts)
+            Assert(positions_in_superset[i] != numbers::invalid_dof_index,
+                   ExcInternalError());
+            while (positions_in_superset[i] >= target_end)
               {
-                Assert(i >= ghost_targets_data.back().first,
-                       ExcInternalError(
-                         "Expect result of ConsensusAlgorithms::Process to be "
-                         "sorted."));
-                if (i == ghost_targets_data.back().first)
-                  ghost_targets_data.back().second++;
-                else
-                  ghost_targets_data.emplace_back(i, 1);
+                AssertIndexRange(target, superset.ghost_targets_data.size());
+                target_end += superset.ghost_targets_data[target].second;
+                ++target;
               }
+            requested_indices[target - 1].push_back(ghost_indices[i]);
           }
       }
 
-      // find how much the individual processes that want import from me
-      std::map<unsigned int, IndexSet> import_data = process.get_requesters();
+      ghost_targets_data = {};
+      for (unsigned int p = 0; p < requested_indices.size(); ++p)
+        if (requested_indices[p].size() > 0)
+          ghost_targets_data.emplace_back(superset.ghost_targets_data[p].first,
+                                          requested_indices[p].size());
+
+      // send the requested indices to all processes the superset imports
+      // from, including empty messages, so that every process knows which
+      // messages to expect from the import targets of the superset
+      const int mpi_tag =
+        Utilities::MPI::internal::Tags::partitioner_reinit_from_superset;
+      std::vector<MPI_Request> requests(requested_indices.size());
+      for (unsigned int p = 0; p < requested_indices.size(); ++p)
+        {
+          const int ierr = MPI_Isend(requested_indices[p].data(),
+                                     static_cast<int>(
+                                       requested_indices[p].size()),
+                                     DEAL_II_DOF_INDEX_MPI_TYPE,
+                                     superset.ghost_targets_data[p].first,
+                                     mpi_tag,
+                                     communicator,
+                                     &requests[p]);
+          AssertThrowMPI(ierr);
+        }
 
+      std::map<unsigned int, IndexSet>     import_data;
+      std::vector<types::global_dof_index> buffer;
+      for (const auto &import_target : superset.import_targets_data)
+        {
+          // the superset imports at least as many indices as requested now
+          buffer.resize(import_target.second);
+          MPI_Status status;
+          int        ierr = MPI_Recv(buffer.data(),
+                              static_cast<int>(buffer.size()),
+                              DEAL_II_DOF_INDEX_MPI_TYPE,
+                              import_target.first,
+                              mpi_tag,
+                              communicator,
+                              &status);
+          AssertThrowMPI(ierr);
+          int count = 0;
+          ierr =
+            MPI_Get_count(&status, DEAL_II_DOF_INDEX_MPI_TYPE, &count);
+          AssertThrowMPI(ierr);
+          if (count > 0)
+            {
+              IndexSet &indices = import_data[import_target.first];
+              indices.set_size(global_size);
+              indices.add_indices(buffer.begin(), buffer.begin() + count);
+            }
+        }
+
+      const int ierr =
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+
+      set_import_data(import_data);
+
+#  endif // #ifdef DEAL_II_WITH_MPI
+
+      finish_ghost_indices_setup(larger_ghost_index_set);
+    }
+
+
+
+    void
+    Partitioner::clear_communication_pattern_cache()
+    {
+      CommunicationPatternCache  &cache = get_communication_pattern_cache();
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      cache.patterns.clear();
+      cache.n_hits   = 0;
+      cache.n_misses = 0;
+    }
+
+
+
+    std::pair<unsigned int, unsigned int>
+    Partitioner::communication_pattern_cache_statistics()
+    {
+      CommunicationPatternCache  &cache = get_communication_pattern_cache();
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      return {cache.n_hits, cache.n_misses};
+    }
+
+
+
+    void
+    Partitioner::set_import_data(
+      const std::map<unsigned int, IndexSet> &import_data)
+    {
       // count import requests and set up the compressed indices
       n_import_indices_data = 0;
       import_targets_data   = {};
@@ -338,7 +735,15 @@ namespace Utilities
                                              interval->last() + 1 -
                                                local_range_data.first);
         }
+    }
+
+
 
+    void
+    Partitioner::finish_ghost_indices_setup(
+      const IndexSet &larger_ghost_index_set)
+    {
+#  ifdef DEAL_II_WITH_MPI
 #    ifdef DEBUG
 
       // simple check: the number of processors to which we want to send
@@ -413,21 +818,29 @@ namespace Utilities
           n_ghost_indices_in_larger_set = larger_ghost_index_set.n_elements();
 
           // first translate tight ghost indices into indices within the large
-          // set:
+          // set. the ghost indices are sorted, so translate all of them in
+          // one pass through the larger set:
+          const std::vector<types::global_dof_index> ghost_indices =
+            ghost_indices_data.get_index_vector();
+          std::vector<types::global_dof_index> indices_within_larger_set(
+            ghost_indices.size());
+          larger_ghost_index_set.compress();
+          larger_ghost_index_set.index_within_set(
+            make_array_view(ghost_indices),
+            make_array_view(indices_within_larger_set));
           std::vector<unsigned int> expanded_numbering;
-          for (const dealii::IndexSet::size_type index : ghost_indices_data)
+          expanded_numbering.reserve(indices_within_larger_set.size());
+          for (const types::global_dof_index index : indices_within_larger_set)
             {
-              Assert(larger_ghost_index_set.is_element(index),
+              Assert(index != numbers::invalid_dof_index,
                      ExcMessage("The given larger ghost index set must contain "
                                 "all indices in the actual index set."));
               Assert(
-                larger_ghost_index_set.index_within_set(index) <
-                  static_cast<types::global_dof_index>(
-                    std::numeric_limits<unsigned int>::max()),
+                index < static_cast<types::global_dof_index>(
+                          std::numeric_limits<unsigned int>::max()),
                 ExcMessage(
                   "Index overflow: This class supports at most 2^32-1 ghost elements"));
-              expanded_numbering.push_back(
-                larger_ghost_index_set.index_within_set(index));
+              expanded_numbering.push_back(index);
             }
 
           // now rework expanded_numbering into ranges and store in:
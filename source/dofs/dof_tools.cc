@@ -45,6 +45,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <utility>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -435,12 +436,19 @@ namespace DoFTools
     std::vector<unsigned char> dofs_by_component(dof.n_locally_owned_dofs());
     internal::get_component_association(dof, component_mask, dofs_by_component);
 
-    // fill the selected components in a vector
-    std::vector<types::global_dof_index> selected_dofs;
-    selected_dofs.reserve(dof.n_locally_owned_dofs());
+    // fill the positions of the selected components in a vector and
+    // translate them into global indices in a single pass through the
+    // locally owned index set
+    std::vector<types::global_dof_index> selected_positions;
+    selected_positions.reserve(dof.n_locally_owned_dofs());
     for (types::global_dof_index i = 0; i < dofs_by_component.size(); ++i)
       if (component_mask[dofs_by_component[i]] == true)
-        selected_dofs.push_back(dof.locally_owned_dofs().nth_index_in_set(i));
+        selected_positions.push_back(i);
+    std::vector<types::global_dof_index> selected_dofs(
+      selected_positions.size());
+    dof.locally_owned_dofs().nth_index_in_set(
+      make_array_view(std::as_const(selected_positions)),
+      make_array_view(selected_dofs));
 
     // fill vector of indices to return argument
     IndexSet result(dof.n_dofs());
@@ -1159,6 +1167,39 @@ namespace DoFTools
 
 
 
+  namespace internal
+  {
+    namespace
+    {
+      /**
+       * Remove the elements of @p index_set from the sorted vector @p dofs
+       * and make the remaining entries unique. All dofs are looked up in a
+       * single pass through @p index_set, which is much cheaper than calling
+       * IndexSet::is_element() for each of them if the index set consists of
+       * many ranges.
+       */
+      void
+      remove_dofs_in_set(const IndexSet                       &index_set,
+                         std::vector<types::global_dof_index> &dofs)
+      {
+        dofs.erase(std::unique(dofs.begin(), dofs.end()), dofs.end());
+
+        std::vector<types::global_dof_index> positions(dofs.size());
+        index_set.compress();
+        index_set.index_within_set(make_array_view(std::as_const(dofs)),
+                                   make_array_view(positions));
+
+        std::size_t n_kept = 0;
+        for (std::size_t i = 0; i < dofs.size(); ++i)
+          if (positions[i] == numbers::invalid_dof_index)
+            dofs[n_kept++] = dofs[i];
+        dofs.resize(n_kept);
+      }
+    } // namespace
+  }   // namespace internal
+
+
+
   template <int dim, int spacedim>
   IndexSet
   extract_locally_relevant_dofs(const DoFHandler<dim, spacedim> &dof_handler)
@@ -1182,13 +1223,14 @@ namespace DoFTools
         {
           dof_indices.resize(cell->get_fe().n_dofs_per_cell());
           cell->get_dof_indices(dof_indices);
-          for (const auto dof_index : dof_indices)
-            if (!dof_set.is_element(dof_index))
-              dofs_on_ghosts.push_back(dof_index);
+          dofs_on_ghosts.insert(dofs_on_ghosts.end(),
+                                dof_indices.begin(),
+                                dof_indices.end());
         }
 
-    // sort and put into an index set
+    // sort, remove the locally owned dofs and put into an index set
     std::sort(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
+    internal::remove_dofs_in_set(dof_set, dofs_on_ghosts);
     dof_set.add_indices(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
     dof_set.compress();
 
@@ -1238,13 +1280,14 @@ namespace DoFTools
 
         dof_indices.resize(cell->get_fe().n_dofs_per_cell());
         cell->get_mg_dof_indices(dof_indices);
-        for (const auto dof_index : dof_indices)
-          if (!dof_set.is_element(dof_index))
-            dofs_on_ghosts.push_back(dof_index);
+        dofs_on_ghosts.insert(dofs_on_ghosts.end(),
+                              dof_indices.begin(),
+                              dof_indices.end());
       }
 
-    // sort and fill into an index set
+    // sort, remove the locally owned dofs and fill into an index set
     std::sort(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
+    internal::remove_dofs_in_set(dof_set, dofs_on_ghosts);
     dof_set.add_indices(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
     dof_set.compress();
 
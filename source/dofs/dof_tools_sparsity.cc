@@ -12,9 +12,11 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
+#include <deal.II/base/thread_local_storage.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/distributed/shared_tria.h>
@@ -40,6 +42,7 @@
 
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/sparsity_pattern_base.h>
+#include <deal.II/lac/thread_local_sparsity_pattern.h>
 #include <deal.II/lac/vector.h>
 
 #include <algorithm>
@@ -51,6 +54,76 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace DoFTools
 {
+  namespace internal
+  {
+    namespace
+    {
+      /**
+       * Call @p worker on each locally owned active cell of @p dof that
+       * belongs to @p subdomain_id (or on all of them if it is
+       * numbers::invalid_subdomain_id), passing two scratch arrays for the
+       * indices of the cell and of a neighbor.
+       *
+       * If @p sparsity is a ThreadLocalSparsityPattern, which several threads
+       * may write into at the same time, the cells are split among threads
+       * and the pattern is compressed at the end. Otherwise, the cells are
+       * visited one after the other.
+       */
+      template <int dim, int spacedim, typename Worker>
+      void
+      loop_over_sparsity_cells(const DoFHandler<dim, spacedim> &dof,
+                               const types::subdomain_id        subdomain_id,
+                               SparsityPatternBase             &sparsity,
+                               const Worker                    &worker)
+      {
+        const auto cell_is_relevant = [subdomain_id](const auto &cell) {
+          return ((subdomain_id == numbers::invalid_subdomain_id) ||
+                  (subdomain_id == cell->subdomain_id())) &&
+                 cell->is_locally_owned();
+        };
+        const unsigned int max_dofs_per_cell =
+          dof.get_fe_collection().max_dofs_per_cell();
+
+        if (auto *tlsp = dynamic_cast<ThreadLocalSparsityPattern *>(&sparsity))
+          {
+            std::vector<
+              typename DoFHandler<dim, spacedim>::active_cell_iterator>
+              cells;
+            for (const auto &cell : dof.active_cell_iterators())
+              if (cell_is_relevant(cell))
+                cells.push_back(cell);
+
+            dealii::parallel::apply_to_subranges(
+              std::size_t(0),
+              cells.size(),
+              [&](const std::size_t begin, const std::size_t end) {
+                std::vector<types::global_dof_index> dofs_on_this_cell;
+                std::vector<types::global_dof_index> dofs_on_other_cell;
+                dofs_on_this_cell.reserve(max_dofs_per_cell);
+                dofs_on_other_cell.reserve(max_dofs_per_cell);
+                for (std::size_t c = begin; c < end; ++c)
+                  worker(cells[c], dofs_on_this_cell, dofs_on_other_cell);
+              },
+              64);
+
+            tlsp->compress();
+          }
+        else
+          {
+            std::vector<types::global_dof_index> dofs_on_this_cell;
+            std::vector<types::global_dof_index> dofs_on_other_cell;
+            dofs_on_this_cell.reserve(max_dofs_per_cell);
+            dofs_on_other_cell.reserve(max_dofs_per_cell);
+            for (const auto &cell : dof.active_cell_iterators())
+              if (cell_is_relevant(cell))
+                worker(cell, dofs_on_this_cell, dofs_on_other_cell);
+          }
+      }
+    } // namespace
+  }   // namespace internal
+
+
+
   template <int dim, int spacedim, typename number>
   void
   make_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
@@ -82,28 +155,27 @@ namespace DoFTools
                  "locally owned one does not make sense."));
       }
 
-    std::vector<types::global_dof_index> dofs_on_this_cell;
-    dofs_on_this_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
-
     // In case we work with a distributed sparsity pattern of Trilinos
     // type, we only have to do the work if the current cell is owned by
     // the calling processor. Otherwise, just continue.
-    for (const auto &cell : dof.active_cell_iterators())
-      if (((subdomain_id == numbers::invalid_subdomain_id) ||
-           (subdomain_id == cell->subdomain_id())) &&
-          cell->is_locally_owned())
-        {
-          const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
-          dofs_on_this_cell.resize(dofs_per_cell);
-          cell->get_dof_indices(dofs_on_this_cell);
-
-          // make sparsity pattern for this cell. if no constraints pattern
-          // was given, then the following call acts as if simply no
-          // constraints existed
-          constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                  sparsity,
-                                                  keep_constrained_dofs);
-        }
+    internal::loop_over_sparsity_cells(
+      dof,
+      subdomain_id,
+      sparsity,
+      [&](const auto                           &cell,
+          std::vector<types::global_dof_index> &dofs_on_this_cell,
+          std::vector<types::global_dof_index> &) {
+        const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
+        dofs_on_this_cell.resize(dofs_per_cell);
+        cell->get_dof_indices(dofs_on_this_cell);
+
+        // make sparsity pattern for this cell. if no constraints pattern
+        // was given, then the following call acts as if simply no
+        // constraints existed
+        constraints.add_entries_local_to_global(dofs_on_this_cell,
+                                                sparsity,
+                                                keep_constrained_dofs);
+      });
   }
 
 
@@ -167,33 +239,32 @@ namespace DoFTools
               bool_dof_mask[f](i, j) = true;
       }
 
-    std::vector<types::global_dof_index> dofs_on_this_cell(
-      fe_collection.max_dofs_per_cell());
-
     // In case we work with a distributed sparsity pattern of Trilinos
     // type, we only have to do the work if the current cell is owned by
     // the calling processor. Otherwise, just continue.
-    for (const auto &cell : dof.active_cell_iterators())
-      if (((subdomain_id == numbers::invalid_subdomain_id) ||
-           (subdomain_id == cell->subdomain_id())) &&
-          cell->is_locally_owned())
-        {
-          const types::fe_index fe_index = cell->active_fe_index();
-          const unsigned int    dofs_per_cell =
-            fe_collection[fe_index].n_dofs_per_cell();
-
-          dofs_on_this_cell.resize(dofs_per_cell);
-          cell->get_dof_indices(dofs_on_this_cell);
-
-
-          // make sparsity pattern for this cell. if no constraints pattern
-          // was given, then the following call acts as if simply no
-          // constraints existed
-          constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                  sparsity,
-                                                  keep_constrained_dofs,
-                                                  bool_dof_mask[fe_index]);
-        }
+    internal::loop_over_sparsity_cells(
+      dof,
+      subdomain_id,
+      sparsity,
+      [&](const auto                           &cell,
+          std::vector<types::global_dof_index> &dofs_on_this_cell,
+          std::vector<types::global_dof_index> &) {
+        const types::fe_index fe_index = cell->active_fe_index();
+        const unsigned int    dofs_per_cell =
+          fe_collection[fe_index].n_dofs_per_cell();
+
+        dofs_on_this_cell.resize(dofs_per_cell);
+        cell->get_dof_indices(dofs_on_this_cell);
+
+
+        // make sparsity pattern for this cell. if no constraints pattern
+        // was given, then the following call acts as if simply no
+        // constraints existed
+        constraints.add_entries_local_to_global(dofs_on_this_cell,
+                                                sparsity,
+                                                keep_constrained_dofs,
+                                                bool_dof_mask[fe_index]);
+      });
   }
 
 
@@ -555,11 +626,6 @@ namespace DoFTools
                  "locally owned one does not make sense."));
       }
 
-    std::vector<types::global_dof_index> dofs_on_this_cell;
-    std::vector<types::global_dof_index> dofs_on_other_cell;
-    dofs_on_this_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
-    dofs_on_other_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
-
     // TODO: in an old implementation, we used user flags before to tag
     // faces that were already touched. this way, we could reduce the work
     // a little bit. now, we instead add only data from one side. this
@@ -568,126 +634,128 @@ namespace DoFTools
     // In case we work with a distributed sparsity pattern of Trilinos
     // type, we only have to do the work if the current cell is owned by
     // the calling processor. Otherwise, just continue.
-    for (const auto &cell : dof.active_cell_iterators())
-      if (((subdomain_id == numbers::invalid_subdomain_id) ||
-           (subdomain_id == cell->subdomain_id())) &&
-          cell->is_locally_owned())
-        {
-          const unsigned int n_dofs_on_this_cell =
-            cell->get_fe().n_dofs_per_cell();
-          dofs_on_this_cell.resize(n_dofs_on_this_cell);
-          cell->get_dof_indices(dofs_on_this_cell);
-
-          // make sparsity pattern for this cell. if no constraints pattern
-          // was given, then the following call acts as if simply no
-          // constraints existed
-          constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                  sparsity,
-                                                  keep_constrained_dofs);
-
-          for (const unsigned int face : cell->face_indices())
-            {
-              typename DoFHandler<dim, spacedim>::face_iterator cell_face =
-                cell->face(face);
-              const bool periodic_neighbor = cell->has_periodic_neighbor(face);
-              if (!cell->at_boundary(face) || periodic_neighbor)
-                {
-                  typename DoFHandler<dim, spacedim>::level_cell_iterator
-                    neighbor = cell->neighbor_or_periodic_neighbor(face);
-
-                  // in 1d, we do not need to worry whether the neighbor
-                  // might have children and then loop over those children.
-                  // rather, we may as well go straight to the cell behind
-                  // this particular cell's most terminal child
-                  if (dim == 1)
-                    while (neighbor->has_children())
-                      neighbor = neighbor->child(face == 0 ? 1 : 0);
-
-                  if (neighbor->has_children())
-                    {
-                      for (unsigned int sub_nr = 0;
-                           sub_nr != cell_face->n_active_descendants();
-                           ++sub_nr)
-                        {
-                          const typename DoFHandler<dim, spacedim>::
-                            level_cell_iterator sub_neighbor =
-                              periodic_neighbor ?
-                                cell->periodic_neighbor_child_on_subface(
-                                  face, sub_nr) :
-                                cell->neighbor_child_on_subface(face, sub_nr);
-
-                          const unsigned int n_dofs_on_neighbor =
-                            sub_neighbor->get_fe().n_dofs_per_cell();
-                          dofs_on_other_cell.resize(n_dofs_on_neighbor);
-                          sub_neighbor->get_dof_indices(dofs_on_other_cell);
-
-                          constraints.add_entries_local_to_global(
-                            dofs_on_this_cell,
-                            dofs_on_other_cell,
-                            sparsity,
-                            keep_constrained_dofs);
+    internal::loop_over_sparsity_cells(
+      dof,
+      subdomain_id,
+      sparsity,
+      [&](const auto                           &cell,
+          std::vector<types::global_dof_index> &dofs_on_this_cell,
+          std::vector<types::global_dof_index> &dofs_on_other_cell) {
+        const unsigned int n_dofs_on_this_cell =
+          cell->get_fe().n_dofs_per_cell();
+        dofs_on_this_cell.resize(n_dofs_on_this_cell);
+        cell->get_dof_indices(dofs_on_this_cell);
+
+        // make sparsity pattern for this cell. if no constraints pattern
+        // was given, then the following call acts as if simply no
+        // constraints existed
+        constraints.add_entries_local_to_global(dofs_on_this_cell,
+                                                sparsity,
+                                                keep_constrained_dofs);
+
+        for (const unsigned int face : cell->face_indices())
+          {
+            typename DoFHandler<dim, spacedim>::face_iterator cell_face =
+              cell->face(face);
+            const bool periodic_neighbor = cell->has_periodic_neighbor(face);
+            if (!cell->at_boundary(face) || periodic_neighbor)
+              {
+                typename DoFHandler<dim, spacedim>::level_cell_iterator
+                  neighbor = cell->neighbor_or_periodic_neighbor(face);
+
+                // in 1d, we do not need to worry whether the neighbor
+                // might have children and then loop over those children.
+                // rather, we may as well go straight to the cell behind
+                // this particular cell's most terminal child
+                if (dim == 1)
+                  while (neighbor->has_children())
+                    neighbor = neighbor->child(face == 0 ? 1 : 0);
+
+                if (neighbor->has_children())
+                  {
+                    for (unsigned int sub_nr = 0;
+                         sub_nr != cell_face->n_active_descendants();
+                         ++sub_nr)
+                      {
+                        const typename DoFHandler<dim, spacedim>::
+                          level_cell_iterator sub_neighbor =
+                            periodic_neighbor ?
+                              cell->periodic_neighbor_child_on_subface(
+                                face, sub_nr) :
+                              cell->neighbor_child_on_subface(face, sub_nr);
+
+                        const unsigned int n_dofs_on_neighbor =
+                          sub_neighbor->get_fe().n_dofs_per_cell();
+                        dofs_on_other_cell.resize(n_dofs_on_neighbor);
+                        sub_neighbor->get_dof_indices(dofs_on_other_cell);
+
+                        constraints.add_entries_local_to_global(
+                          dofs_on_this_cell,
+                          dofs_on_other_cell,
+                          sparsity,
+                          keep_constrained_dofs);
+                        constraints.add_entries_local_to_global(
+                          dofs_on_other_cell,
+                          dofs_on_this_cell,
+                          sparsity,
+                          keep_constrained_dofs);
+                        // only need to add this when the neighbor is not
+                        // owned by the current processor, otherwise we add
+                        // the entries for the neighbor there
+                        if (sub_neighbor->subdomain_id() !=
+                            cell->subdomain_id())
                           constraints.add_entries_local_to_global(
                             dofs_on_other_cell,
-                            dofs_on_this_cell,
                             sparsity,
                             keep_constrained_dofs);
-                          // only need to add this when the neighbor is not
-                          // owned by the current processor, otherwise we add
-                          // the entries for the neighbor there
-                          if (sub_neighbor->subdomain_id() !=
-                              cell->subdomain_id())
-                            constraints.add_entries_local_to_global(
-                              dofs_on_other_cell,
-                              sparsity,
-                              keep_constrained_dofs);
-                        }
-                    }
-                  else
-                    {
-                      // Refinement edges are taken care of by coarser
-                      // cells
-                      if ((!periodic_neighbor &&
-                           cell->neighbor_is_coarser(face)) ||
-                          (periodic_neighbor &&
-                           cell->periodic_neighbor_is_coarser(face)))
-                        if (neighbor->subdomain_id() == cell->subdomain_id())
-                          continue;
-
-                      const unsigned int n_dofs_on_neighbor =
-                        neighbor->get_fe().n_dofs_per_cell();
-                      dofs_on_other_cell.resize(n_dofs_on_neighbor);
-
-                      neighbor->get_dof_indices(dofs_on_other_cell);
-
-                      constraints.add_entries_local_to_global(
-                        dofs_on_this_cell,
-                        dofs_on_other_cell,
-                        sparsity,
-                        keep_constrained_dofs);
-
-                      // only need to add these in case the neighbor cell
-                      // is not locally owned - otherwise, we touch each
-                      // face twice and hence put the indices the other way
-                      // around
-                      if (!cell->neighbor_or_periodic_neighbor(face)
-                             ->is_active() ||
-                          (neighbor->subdomain_id() != cell->subdomain_id()))
-                        {
+                      }
+                  }
+                else
+                  {
+                    // Refinement edges are taken care of by coarser
+                    // cells
+                    if ((!periodic_neighbor &&
+                         cell->neighbor_is_coarser(face)) ||
+                        (periodic_neighbor &&
+                         cell->periodic_neighbor_is_coarser(face)))
+                      if (neighbor->subdomain_id() == cell->subdomain_id())
+                        continue;
+
+                    const unsigned int n_dofs_on_neighbor =
+                      neighbor->get_fe().n_dofs_per_cell();
+                    dofs_on_other_cell.resize(n_dofs_on_neighbor);
+
+                    neighbor->get_dof_indices(dofs_on_other_cell);
+
+                    constraints.add_entries_local_to_global(
+                      dofs_on_this_cell,
+                      dofs_on_other_cell,
+                      sparsity,
+                      keep_constrained_dofs);
+
+                    // only need to add these in case the neighbor cell
+                    // is not locally owned - otherwise, we touch each
+                    // face twice and hence put the indices the other way
+                    // around
+                    if (!cell->neighbor_or_periodic_neighbor(face)
+                           ->is_active() ||
+                        (neighbor->subdomain_id() != cell->subdomain_id()))
+                      {
+                        constraints.add_entries_local_to_global(
+                          dofs_on_other_cell,
+                          dofs_on_this_cell,
+                          sparsity,
+                          keep_constrained_dofs);
+                        if (neighbor->subdomain_id() != cell->subdomain_id())
                           constraints.add_entries_local_to_global(
                             dofs_on_other_cell,
-                            dofs_on_this_cell,
                             sparsity,
                             keep_constrained_dofs);
-                          if (neighbor->subdomain_id() != cell->subdomain_id())
-                            constraints.add_entries_local_to_global(
-                              dofs_on_other_cell,
-                              sparsity,
-                              keep_constrained_dofs);
-                        }
-                    }
-                }
-            }
-        }
+                      }
+                  }
+              }
+          }
+      });
   }
 
 
@@ -864,19 +932,16 @@ namespace DoFTools
           bool(const typename DoFHandler<dim, spacedim>::active_cell_iterator &,
                const unsigned int)> &face_has_flux_coupling)
       {
-        std::vector<types::global_dof_index> rows;
-        std::vector<std::pair<SparsityPatternBase::size_type,
-                              SparsityPatternBase::size_type>>
-          cell_entries;
+        // the entries of a cell are collected before they are added to the
+        // sparsity pattern at once, in a separate array for each thread
+        Threads::ThreadLocalStorage<
+          std::vector<std::pair<SparsityPatternBase::size_type,
+                                SparsityPatternBase::size_type>>>
+          cell_entries_storage;
 
         const dealii::hp::FECollection<dim, spacedim> &fe =
           dof.get_fe_collection();
 
-        std::vector<types::global_dof_index> dofs_on_this_cell(
-          dof.get_fe_collection().max_dofs_per_cell());
-        std::vector<types::global_dof_index> dofs_on_other_cell(
-          dof.get_fe_collection().max_dofs_per_cell());
-
         const unsigned int n_components = fe.n_components();
         AssertDimension(int_mask.size(0), n_components);
         AssertDimension(int_mask.size(1), n_components);
@@ -913,115 +978,119 @@ namespace DoFTools
           }
 
 
-        for (const auto &cell : dof.active_cell_iterators())
-          if (((subdomain_id == numbers::invalid_subdomain_id) ||
-               (subdomain_id == cell->subdomain_id())) &&
-              cell->is_locally_owned())
-            {
-              dofs_on_this_cell.resize(cell->get_fe().n_dofs_per_cell());
-              cell->get_dof_indices(dofs_on_this_cell);
-
-              // make sparsity pattern for this cell also taking into
-              // account the couplings due to face contributions on the same
-              // cell
-              constraints.add_entries_local_to_global(
-                dofs_on_this_cell,
-                sparsity,
-                keep_constrained_dofs,
-                bool_int_and_flux_dof_mask[cell->active_fe_index()]);
-
-              // Loop over interior faces
-              for (const unsigned int face : cell->face_indices())
-                {
-                  const bool periodic_neighbor =
-                    cell->has_periodic_neighbor(face);
-
-                  if ((!cell->at_boundary(face)) || periodic_neighbor)
-                    {
-                      typename DoFHandler<dim, spacedim>::level_cell_iterator
-                        neighbor = cell->neighbor_or_periodic_neighbor(face);
-
-                      // If the cells are on the same level (and both are
-                      // active, locally-owned cells) then only add to the
-                      // sparsity pattern if the current cell is 'greater' in
-                      // the total ordering.
-                      if (neighbor->level() == cell->level() &&
-                          neighbor->index() > cell->index() &&
-                          neighbor->is_active() && neighbor->is_locally_owned())
-                        continue;
-
-                      // If we are more refined then the neighbor, then we
-                      // will automatically find the active neighbor cell when
-                      // we call 'neighbor (face)' above. The opposite is not
-                      // true; if the neighbor is more refined then the call
-                      // 'neighbor (face)' will *not* return an active
-                      // cell. Hence, only add things to the sparsity pattern
-                      // if (when the levels are different) the neighbor is
-                      // coarser than the current cell, except in the case
-                      // when the neighbor is not locally owned.
-                      if (neighbor->level() != cell->level() &&
-                          ((!periodic_neighbor &&
-                            !cell->neighbor_is_coarser(face)) ||
-                           (periodic_neighbor &&
-                            !cell->periodic_neighbor_is_coarser(face))) &&
-                          neighbor->is_locally_owned())
-                        continue; // (the neighbor is finer)
-
-                      if (!face_has_flux_coupling(cell, face))
-                        continue;
+        loop_over_sparsity_cells(
+          dof,
+          subdomain_id,
+          sparsity,
+          [&](const auto                           &cell,
+              std::vector<types::global_dof_index> &dofs_on_this_cell,
+              std::vector<types::global_dof_index> &dofs_on_other_cell) {
+            std::vector<std::pair<SparsityPatternBase::size_type,
+                                  SparsityPatternBase::size_type>>
+              &cell_entries = cell_entries_storage.get();
+            dofs_on_this_cell.resize(cell->get_fe().n_dofs_per_cell());
+            cell->get_dof_indices(dofs_on_this_cell);
+
+            // make sparsity pattern for this cell also taking into
+            // account the couplings due to face contributions on the same
+            // cell
+            constraints.add_entries_local_to_global(
+              dofs_on_this_cell,
+              sparsity,
+              keep_constrained_dofs,
+              bool_int_and_flux_dof_mask[cell->active_fe_index()]);
+
+            // Loop over interior faces
+            for (const unsigned int face : cell->face_indices())
+              {
+                const bool periodic_neighbor =
+                  cell->has_periodic_neighbor(face);
 
-                      const unsigned int neighbor_face_no =
-                        periodic_neighbor ?
-                          cell->periodic_neighbor_face_no(face) :
-                          cell->neighbor_face_no(face);
-
-                      // In 1d, go straight to the cell behind this
-                      // particular cell's most terminal cell. This makes us
-                      // skip the if (neighbor->has_children()) section
-                      // below. We need to do this since we otherwise
-                      // iterate over the children of the face, which are
-                      // always 0 in 1d.
-                      if (dim == 1)
-                        while (neighbor->has_children())
-                          neighbor = neighbor->child(face == 0 ? 1 : 0);
-
-                      if (neighbor->has_children())
-                        {
-                          for (unsigned int sub_nr = 0;
-                               sub_nr != cell->face(face)->n_children();
-                               ++sub_nr)
-                            {
-                              const typename DoFHandler<dim, spacedim>::
-                                level_cell_iterator sub_neighbor =
-                                  periodic_neighbor ?
-                                    cell->periodic_neighbor_child_on_subface(
-                                      face, sub_nr) :
-                                    cell->neighbor_child_on_subface(face,
-                                                                    sub_nr);
-                              add_cell_entries(cell,
-                                               face,
-                                               sub_neighbor,
-                                               neighbor_face_no,
-                                               flux_mask,
-                                               dofs_on_this_cell,
-                                               dofs_on_other_cell,
-                                               cell_entries);
-                            }
-                        }
-                      else
-                        add_cell_entries(cell,
-                                         face,
-                                         neighbor,
-                                         neighbor_face_no,
-                                         flux_mask,
-                                         dofs_on_this_cell,
-                                         dofs_on_other_cell,
-                                         cell_entries);
-                    }
-                }
-              sparsity.add_entries(make_array_view(cell_entries));
-              cell_entries.clear();
-            }
+                if ((!cell->at_boundary(face)) || periodic_neighbor)
+                  {
+                    typename DoFHandler<dim, spacedim>::level_cell_iterator
+                      neighbor = cell->neighbor_or_periodic_neighbor(face);
+
+                    // If the cells are on the same level (and both are
+                    // active, locally-owned cells) then only add to the
+                    // sparsity pattern if the current cell is 'greater' in
+                    // the total ordering.
+                    if (neighbor->level() == cell->level() &&
+                        neighbor->index() > cell->index() &&
+                        neighbor->is_active() && neighbor->is_locally_owned())
+                      continue;
+
+                    // If we are more refined then the neighbor, then we
+                    // will automatically find the active neighbor cell when
+                    // we call 'neighbor (face)' above. The opposite is not
+                    // true; if the neighbor is more refined then the call
+                    // 'neighbor (face)' will *not* return an active
+                    // cell. Hence, only add things to the sparsity pattern
+                    // if (when the levels are different) the neighbor is
+                    // coarser than the current cell, except in the case
+                    // when the neighbor is not locally owned.
+                    if (neighbor->level() != cell->level() &&
+                        ((!periodic_neighbor &&
+                          !cell->neighbor_is_coarser(face)) ||
+                         (periodic_neighbor &&
+                          !cell->periodic_neighbor_is_coarser(face))) &&
+                        neighbor->is_locally_owned())
+                      continue; // (the neighbor is finer)
+
+                    if (!face_has_flux_coupling(cell, face))
+                      continue;
+
+                    const unsigned int neighbor_face_no =
+                      periodic_neighbor ?
+                        cell->periodic_neighbor_face_no(face) :
+                        cell->neighbor_face_no(face);
+
+                    // In 1d, go straight to the cell behind this
+                    // particular cell's most terminal cell. This makes us
+                    // skip the if (neighbor->has_children()) section
+                    // below. We need to do this since we otherwise
+                    // iterate over the children of the face, which are
+                    // always 0 in 1d.
+                    if (dim == 1)
+                      while (neighbor->has_children())
+                        neighbor = neighbor->child(face == 0 ? 1 : 0);
+
+                    if (neighbor->has_children())
+                      {
+                        for (unsigned int sub_nr = 0;
+                             sub_nr != cell->face(face)->n_children();
+                             ++sub_nr)
+                          {
+                            const typename DoFHandler<dim, spacedim>::
+                              level_cell_iterator sub_neighbor =
+                                periodic_neighbor ?
+                                  cell->periodic_neighbor_child_on_subface(
+                                    face, sub_nr) :
+                                  cell->neighbor_child_on_subface(face, sub_nr);
+                            add_cell_entries(cell,
+                                             face,
+                                             sub_neighbor,
+                                             neighbor_face_no,
+                                             flux_mask,
+                                             dofs_on_this_cell,
+                                             dofs_on_other_cell,
+                                             cell_entries);
+                          }
+                      }
+                    else
+                      add_cell_entries(cell,
+                                       face,
+                                       neighbor,
+                                       neighbor_face_no,
+                                       flux_mask,
+                                       dofs_on_this_cell,
+                                       dofs_on_other_cell,
+                                       cell_entries);
+                  }
+              }
+            sparsity.add_entries(make_array_view(cell_entries));
+            cell_entries.clear();
+          });
       }
     } // namespace
 
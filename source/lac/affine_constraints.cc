@@ -60,7 +60,8 @@ DEAL_II_NAMESPACE_OPEN
       MatrixType &,                                           \
       VectorType &,                                           \
       bool,                                                   \
-      std::bool_constant<false>) const
+      std::bool_constant<false>,                              \
+      const AffineConstraints::size_type *) const
 
 #define INSTANTIATE_DLTG_BLOCK_VECTORMATRIX(MatrixType, VectorType) \
   template void AffineConstraints<MatrixType::value_type>::         \
@@ -71,7 +72,8 @@ DEAL_II_NAMESPACE_OPEN
       MatrixType &,                                                 \
       VectorType &,                                                 \
       bool,                                                         \
-      std::bool_constant<true>) const
+      std::bool_constant<true>,                                     \
+      const AffineConstraints::size_type *) const
 
 #define INSTANTIATE_DLTG_MATRIX(MatrixType)                              \
   template void                                                          \
@@ -0,0 +1,398 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/la_parallel_overlapped_sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename Number>
+    void
+    OverlappedSparseMatrix<Number>::reinit(
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+      const SparseMatrix<Number>                               &local_matrix)
+    {
+      Assert(partitioner.get() != nullptr, ExcNotInitialized());
+      const unsigned int n_owned = partitioner->locally_owned_size();
+      AssertDimension(local_matrix.m(), n_owned);
+      AssertDimension(local_matrix.n(),
+                      n_owned + partitioner->n_ghost_indices());
+
+      this->partitioner = partitioner;
+
+      owned_row_starts.clear();
+      owned_columns.clear();
+      owned_values.clear();
+      boundary_rows.clear();
+      ghost_row_starts.clear();
+      ghost_columns.clear();
+      ghost_values.clear();
+      private_range_starts.clear();
+      private_ranges.clear();
+      shared_ranges.clear();
+
+      std::vector<Number> owned_values_tmp, ghost_values_tmp;
+      owned_values_tmp.reserve(local_matrix.n_nonzero_elements());
+      owned_columns.reserve(local_matrix.n_nonzero_elements());
+
+      owned_row_starts.reserve(n_owned + 1);
+      owned_row_starts.push_back(0);
+      ghost_row_starts.push_back(0);
+      for (unsigned int row = 0; row < n_owned; ++row)
+        {
+          bool has_ghost_entries = false;
+          for (auto entry = local_matrix.begin(row);
+               entry != local_matrix.end(row);
+               ++entry)
+            if (entry->column() < n_owned)
+              {
+                owned_columns.push_back(entry->column());
+                owned_values_tmp.push_back(entry->value());
+              }
+            else
+              {
+                ghost_columns.push_back(entry->column());
+                ghost_values_tmp.push_back(entry->value());
+                has_ghost_entries = true;
+              }
+          owned_row_starts.push_back(owned_columns.size());
+          if (has_ghost_entries)
+            {
+              boundary_rows.push_back(row);
+              ghost_row_starts.push_back(ghost_columns.size());
+            }
+        }
+
+      owned_values.resize_fast(owned_values_tmp.size());
+      std::copy(owned_values_tmp.begin(),
+                owned_values_tmp.end(),
+                owned_values.begin());
+      ghost_values.resize_fast(ghost_values_tmp.size());
+      std::copy(ghost_values_tmp.begin(),
+                ghost_values_tmp.end(),
+                ghost_values.begin());
+
+      // split the rows into chunks of similar work that are the units of the
+      // parallel loop in do_vmult(). a process may own no rows at all
+      rows_per_chunk = std::max<std::size_t>(
+        1,
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size *
+          n_owned /
+          std::max<std::size_t>(1, owned_columns.size() + n_owned));
+      const unsigned int n_chunks =
+        (n_owned + rows_per_chunk - 1) / rows_per_chunk;
+
+      // an entry of the vectors can be handed to the functions before and
+      // after the product within the work of a chunk if only the rows of
+      // that chunk access it. this excludes entries read by rows of other
+      // chunks, the entries sent to other processes (which must be updated
+      // before the communication starts), and the boundary rows (which are
+      // only complete after the ghost columns have been added)
+      std::vector<bool> is_shared(n_owned, false);
+      for (unsigned int row = 0; row < n_owned; ++row)
+        for (std::size_t j = owned_row_starts[row];
+             j < owned_row_starts[row + 1];
+             ++j)
+          if (owned_columns[j] / rows_per_chunk != row / rows_per_chunk)
+            is_shared[owned_columns[j]] = true;
+      for (const auto &range : partitioner->import_indices())
+        for (unsigned int i = range.first; i < range.second; ++i)
+          is_shared[i] = true;
+      for (const unsigned int row : boundary_rows)
+        is_shared[row] = true;
+
+      private_range_starts.reserve(n_chunks + 1);
+      private_range_starts.push_back(0);
+      for (unsigned int c = 0; c < n_chunks; ++c)
+        {
+          const unsigned int end = std::min(n_owned, (c + 1) * rows_per_chunk);
+          for (unsigned int i = c * rows_per_chunk; i < end;)
+            {
+              const bool         shared = is_shared[i];
+              const unsigned int begin  = i;
+              while (i < end && is_shared[i] == shared)
+                ++i;
+              if (shared)
+                {
+                  if (!shared_ranges.empty() &&
+                      shared_ranges.back().second == begin)
+                    shared_ranges.back().second = i;
+                  else
+                    shared_ranges.emplace_back(begin, i);
+                }
+              else
+                private_ranges.emplace_back(begin, i);
+            }
+          private_range_starts.push_back(private_ranges.size());
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    OverlappedSparseMatrix<Number>::clear()
+    {
+      partitioner.reset();
+      owned_row_starts.clear();
+      owned_columns.clear();
+      owned_values.clear();
+      boundary_rows.clear();
+      ghost_row_starts.clear();
+      ghost_columns.clear();
+      ghost_values.clear();
+      rows_per_chunk = 1;
+      private_range_starts.assign(1, 0);
+      private_ranges.clear();
+      shared_ranges.clear();
+    }
+
+
+
+    template <typename Number>
+    typename OverlappedSparseMatrix<Number>::size_type
+    OverlappedSparseMatrix<Number>::m() const
+    {
+      return partitioner ? partitioner->size() : 0;
+    }
+
+
+
+    template <typename Number>
+    typename OverlappedSparseMatrix<Number>::size_type
+    OverlappedSparseMatrix<Number>::n() const
+    {
+      return partitioner ? partitioner->size() : 0;
+    }
+
+
+
+    template <typename Number>
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &
+    OverlappedSparseMatrix<Number>::get_partitioner() const
+    {
+      return partitioner;
+    }
+
+
+
+    template <typename Number>
+    unsigned int
+    OverlappedSparseMatrix<Number>::n_boundary_rows() const
+    {
+      return boundary_rows.size();
+    }
+
+
+
+    template <typename Number>
+    void
+    OverlappedSparseMatrix<Number>::vmult(Vector<Number>       &dst,
+                                          const Vector<Number> &src) const
+    {
+      do_vmult(dst, src, false, nullptr, nullptr);
+    }
+
+
+
+    template <typename Number>
+    void
+    OverlappedSparseMatrix<Number>::vmult(
+      Vector<Number>       &dst,
+      const Vector<Number> &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_matrix_vector_product,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_matrix_vector_product) const
+    {
+      do_vmult(dst,
+               src,
+               false,
+               &operation_before_matrix_vector_product,
+               &operation_after_matrix_vector_product);
+    }
+
+
+
+    template <typename Number>
+    void
+    OverlappedSparseMatrix<Number>::vmult_add(Vector<Number>       &dst,
+                                              const Vector<Number> &src) const
+    {
+      do_vmult(dst, src, true, nullptr, nullptr);
+    }
+
+
+
+    template <typename Number>
+    void
+    OverlappedSparseMatrix<Number>::vmult_owned_rows(const unsigned int begin,
+                                                     const unsigned int end,
+                                                     Number            *dst,
+                                                     const Number      *src,
+                                                     const bool add) const
+    {
+      const unsigned int *columns = owned_columns.data();
+      const Number       *values  = owned_values.data();
+      for (unsigned int row = begin; row < end; ++row)
+        {
+          Number sum = add ? dst[row] : Number();
+          for (std::size_t j = owned_row_starts[row];
+               j < owned_row_starts[row + 1];
+               ++j)
+            sum += values[j] * src[columns[j]];
+          dst[row] = sum;
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    OverlappedSparseMatrix<Number>::do_vmult(
+      Vector<Number>       &dst,
+      const Vector<Number> &src,
+      const bool            add,
+      const std::function<void(const unsigned int, const unsigned int)>
+        *operation_before,
+      const std::function<void(const unsigned int, const unsigned int)>
+        *operation_after) const
+    {
+      Assert(partitioner.get() != nullptr, ExcNotInitialized());
+      Assert(src.partitioners_are_compatible(*partitioner),
+             ExcMessage("The source vector must have the same parallel "
+                        "layout as the matrix."));
+      AssertDimension(dst.locally_owned_size(),
+                      partitioner->locally_owned_size());
+      Assert(&dst != &src,
+             ExcMessage("The source and destination vectors must differ."));
+
+      const unsigned int n_owned  = partitioner->locally_owned_size();
+      const unsigned int n_chunks = private_range_starts.size() - 1;
+
+      // the functions before and after the product are run on the entries
+      // only accessed by a chunk of rows as part of the work on that chunk.
+      // like in MatrixFree::cell_loop(), this is only done if the loop runs
+      // in serial, since the functions may not be called concurrently
+      const bool interleave_operations = MultithreadInfo::n_threads() == 1;
+      const auto run_on_private_ranges =
+        [&](const std::function<void(const unsigned int, const unsigned int)>
+              &operation,
+            const unsigned int begin_chunk,
+            const unsigned int end_chunk) {
+          for (unsigned int i = private_range_starts[begin_chunk];
+               i < private_range_starts[end_chunk];
+               ++i)
+            operation(private_ranges[i].first, private_ranges[i].second);
+        };
+
+      // the vector updates before the product may change the entries of the
+      // source vector, so they need to run on the entries shared between
+      // chunks and sent to other processes before the communication starts
+      if (operation_before != nullptr)
+        {
+          for (const auto &range : shared_ranges)
+            (*operation_before)(range.first, range.second);
+          if (interleave_operations == false)
+            run_on_private_ranges(*operation_before, 0, n_chunks);
+        }
+
+      const bool src_has_ghosts = src.has_ghost_elements();
+      if (src_has_ghosts == false)
+        src.update_ghost_values_start();
+
+      // the rows restricted to the locally owned columns do not need data
+      // from other processes and overlap with the communication
+      Number       *dst_ptr = dst.begin();
+      const Number *src_ptr = src.begin();
+      parallel::apply_to_subranges(
+        0U,
+        n_chunks,
+        [&](const unsigned int begin_chunk, const unsigned int end_chunk) {
+          for (unsigned int c = begin_chunk; c < end_chunk; ++c)
+            {
+              if (operation_before != nullptr && interleave_operations)
+                run_on_private_ranges(*operation_before, c, c + 1);
+              vmult_owned_rows(c * rows_per_chunk,
+                               std::min(n_owned, (c + 1) * rows_per_chunk),
+                               dst_ptr,
+                               src_ptr,
+                               add);
+              if (operation_after != nullptr && interleave_operations)
+                run_on_private_ranges(*operation_after, c, c + 1);
+            }
+        },
+        1);
+
+      if (src_has_ghosts == false)
+        src.update_ghost_values_finish();
+
+      // add the contributions of the ghost columns, which are usually only
+      // present in the rows at the boundary of the subdomain
+      for (unsigned int r = 0; r < boundary_rows.size(); ++r)
+        {
+          Number sum = Number();
+          for (std::size_t j = ghost_row_starts[r]; j < ghost_row_starts[r + 1];
+               ++j)
+            sum += ghost_values[j] * src_ptr[ghost_columns[j]];
+          dst_ptr[boundary_rows[r]] += sum;
+        }
+
+      if (src_has_ghosts == false)
+        src.zero_out_ghost_values();
+
+      if (operation_after != nullptr)
+        {
+          if (interleave_operations == false)
+            run_on_private_ranges(*operation_after, 0, n_chunks);
+          for (const auto &range : shared_ranges)
+            (*operation_after)(range.first, range.second);
+        }
+    }
+
+
+
+    template <typename Number>
+    std::size_t
+    OverlappedSparseMatrix<Number>::memory_consumption() const
+    {
+      return MemoryConsumption::memory_consumption(owned_row_starts) +
+             MemoryConsumption::memory_consumption(owned_columns) +
+             owned_values.memory_consumption() +
+             MemoryConsumption::memory_consumption(boundary_rows) +
+             MemoryConsumption::memory_consumption(ghost_row_starts) +
+             MemoryConsumption::memory_consumption(ghost_columns) +
+             ghost_values.memory_consumption() +
+             MemoryConsumption::memory_consumption(private_range_starts) +
+             MemoryConsumption::memory_consumption(private_ranges) +
+             MemoryConsumption::memory_consumption(shared_ranges);
+    }
+
+
+
+    // explicit instantiations
+    template class OverlappedSparseMatrix<float>;
+    template class OverlappedSparseMatrix<double>;
+  } // namespace distributed
+} // namespace LinearAlgebra
+
+DEAL_II_NAMESPACE_CLOSE
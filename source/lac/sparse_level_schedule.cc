@@ -0,0 +1,132 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/sparse_level_schedule.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace
+{
+  /**
+   * Sort the rows into levels, given the level of each row, by a counting
+   * sort that keeps the rows within a level in increasing order.
+   */
+  void
+  sort_rows_by_level(const std::vector<unsigned int>               &row_level,
+                     const unsigned int                              n_levels,
+                     std::vector<SparseLevelSchedule::size_type> &level_start,
+                     std::vector<SparseLevelSchedule::size_type> &rows)
+  {
+    level_start.assign(n_levels + 1, 0);
+    for (const unsigned int level : row_level)
+      ++level_start[level + 1];
+    for (unsigned int level = 0; level < n_levels; ++level)
+      level_start[level + 1] += level_start[level];
+
+    std::vector<SparseLevelSchedule::size_type> next(level_start.begin(),
+                                                      level_start.end() - 1);
+    rows.resize(row_level.size());
+    for (SparseLevelSchedule::size_type row = 0; row < row_level.size(); ++row)
+      rows[next[row_level[row]]++] = row;
+  }
+} // namespace
+
+
+
+void
+SparseLevelSchedule::initialize(const SparsityPattern &sparsity,
+                                const unsigned int     minimum_rows_per_level)
+{
+  AssertDimension(sparsity.n_rows(), sparsity.n_cols());
+  Assert(sparsity.is_compressed(), SparsityPattern::ExcNotCompressed());
+
+  clear();
+
+  const size_type n_rows = sparsity.n_rows();
+  if (MultithreadInfo::n_threads() == 1 || n_rows < minimum_rows_per_level)
+    return;
+
+  // the level of a row in the forward substitution is one more than the
+  // largest level among the rows to the left of the diagonal it depends on,
+  // so the levels can be computed in one sweep through the rows. the same
+  // holds for the backward substitution, going through the rows in reverse
+  // order
+  std::vector<unsigned int> row_level(n_rows, 0);
+  unsigned int              n_levels = 0;
+  for (size_type row = 0; row < n_rows; ++row)
+    {
+      unsigned int level = 0;
+      for (auto entry = sparsity.begin(row); entry != sparsity.end(row);
+           ++entry)
+        if (entry->column() < row)
+          level = std::max(level, row_level[entry->column()] + 1);
+      row_level[row] = level;
+      n_levels       = std::max(n_levels, level + 1);
+    }
+  if (n_rows < static_cast<size_type>(n_levels) * minimum_rows_per_level)
+    return;
+  sort_rows_by_level(row_level, n_levels, forward_level_start, forward_rows);
+
+  n_levels = 0;
+  for (size_type row = n_rows; row > 0;)
+    {
+      --row;
+      unsigned int level = 0;
+      for (auto entry = sparsity.begin(row); entry != sparsity.end(row);
+           ++entry)
+        if (entry->column() > row)
+          level = std::max(level, row_level[entry->column()] + 1);
+      row_level[row] = level;
+      n_levels       = std::max(n_levels, level + 1);
+    }
+  if (n_rows < static_cast<size_type>(n_levels) * minimum_rows_per_level)
+    {
+      clear();
+      return;
+    }
+  sort_rows_by_level(row_level, n_levels, backward_level_start, backward_rows);
+}
+
+
+
+void
+SparseLevelSchedule::clear()
+{
+  forward_level_start.clear();
+  forward_rows.clear();
+  backward_level_start.clear();
+  backward_rows.clear();
+}
+
+
+
+std::size_t
+SparseLevelSchedule::memory_consumption() const
+{
+  return MemoryConsumption::memory_consumption(forward_level_start) +
+         MemoryConsumption::memory_consumption(forward_rows) +
+         MemoryConsumption::memory_consumption(backward_level_start) +
+         MemoryConsumption::memory_consumption(backward_rows);
+}
+
+DEAL_II_NAMESPACE_CLOSE
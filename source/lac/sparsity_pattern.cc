@@ -13,18 +13,21 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/sparsity_tools.h>
+#include <deal.II/lac/thread_local_sparsity_pattern.h>
 
 #include <algorithm>
 #include <cmath>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <numeric>
 
@@ -206,6 +209,8 @@ SparsityPattern::reinit(const size_type                      m,
   AssertDimension(row_lengths.size(), m);
   resize(m, n);
 
+  relative_colnums.reset();
+
   // delete empty matrices
   if ((m == 0) || (n == 0))
     {
@@ -341,6 +346,8 @@ SparsityPattern::compress()
   if (compressed)
     return;
 
+  relative_colnums.reset();
+
   size_type next_free_entry = 0, next_row_start = 0, row_length = 0;
 
   // first find out how many non-zero elements there are, in order to allocate
@@ -539,6 +546,100 @@ SparsityPattern::copy_from(const DynamicSparsityPattern &dsp)
 
 
 
+void
+SparsityPattern::copy_from(const ThreadLocalSparsityPattern &tlsp)
+{
+  Assert(tlsp.is_compressed(),
+         ExcMessage("The ThreadLocalSparsityPattern must be compressed "
+                    "before it can be copied."));
+
+  const size_type n_rows           = tlsp.n_rows();
+  const bool      do_diag_optimize = (n_rows == tlsp.n_cols());
+  const auto     &buffers          = tlsp.buffers;
+
+  // Call 'row_operation' with the sorted and unique column indices of each
+  // row in [begin, end). Each buffer is sorted by rows, so the entries of a
+  // block of rows are found by one binary search per buffer.
+  const auto merge_rows = [&buffers](const size_type begin,
+                                     const size_type end,
+                                     const auto     &row_operation) {
+    using Entry = std::pair<size_type, size_type>;
+    std::vector<const Entry *> positions(buffers.size());
+    for (unsigned int b = 0; b < buffers.size(); ++b)
+      positions[b] =
+        std::lower_bound(buffers[b]->entries.data(),
+                         buffers[b]->entries.data() +
+                           buffers[b]->entries.size(),
+                         Entry(begin, 0));
+
+    std::vector<size_type> columns;
+    for (size_type row = begin; row < end; ++row)
+      {
+        columns.clear();
+        for (unsigned int b = 0; b < buffers.size(); ++b)
+          {
+            const Entry *buffer_end =
+              buffers[b]->entries.data() + buffers[b]->entries.size();
+            for (; positions[b] != buffer_end && positions[b]->first == row;
+                 ++positions[b])
+              columns.push_back(positions[b]->second);
+          }
+        if (buffers.size() > 1)
+          {
+            std::sort(columns.begin(), columns.end());
+            columns.erase(std::unique(columns.begin(), columns.end()),
+                          columns.end());
+          }
+        row_operation(row, columns);
+      }
+  };
+
+  const unsigned int grain_size = 1024;
+
+  std::vector<unsigned int> row_lengths(n_rows);
+  parallel::apply_to_subranges(
+    size_type(0),
+    n_rows,
+    [&](const size_type begin, const size_type end) {
+      merge_rows(begin,
+                 end,
+                 [&](const size_type               row,
+                     const std::vector<size_type> &columns) {
+                   row_lengths[row] = columns.size();
+                   if (do_diag_optimize &&
+                       !std::binary_search(columns.begin(), columns.end(), row))
+                     ++row_lengths[row];
+                 });
+    },
+    grain_size);
+
+  reinit(n_rows, tlsp.n_cols(), row_lengths);
+
+  if (n_rows != 0 && n_cols() != 0)
+    parallel::apply_to_subranges(
+      size_type(0),
+      n_rows,
+      [&](const size_type begin, const size_type end) {
+        merge_rows(begin,
+                   end,
+                   [&](const size_type               row,
+                       const std::vector<size_type> &columns) {
+                     size_type *cols =
+                       &colnums[rowstart[row]] + (do_diag_optimize ? 1 : 0);
+                     for (const size_type col : columns)
+                       if ((col != row) || !do_diag_optimize)
+                         *cols++ = col;
+                   });
+      },
+      grain_size);
+
+  // the columns of each row were written in sorted order and all slots were
+  // filled, so there is no need to call compress()
+  compressed = true;
+}
+
+
+
 template <typename number>
 void
 SparsityPattern::copy_from(const FullMatrix<number> &matrix)
@@ -1008,6 +1109,7 @@ SparsityPattern::block_read(std::istream &in)
   // reallocate space
   rowstart = std::make_unique<std::size_t[]>(max_dim + 1);
   colnums  = std::make_unique<size_type[]>(max_vec_len);
+  relative_colnums.reset();
 
   // then read data
   in.read(reinterpret_cast<char *>(rowstart.get()),
@@ -1026,11 +1128,44 @@ SparsityPattern::block_read(std::istream &in)
 
 
 
+void
+SparsityPattern::compute_relative_column_indices()
+{
+  Assert(compressed, ExcNotCompressed());
+
+  relative_colnums.reset();
+  if ((rowstart == nullptr) || (colnums == nullptr))
+    return;
+
+  // the difference computed in the unsigned type and converted to a signed
+  // type of the same size is correct also for columns left of the diagonal
+  using signed_size_type = std::make_signed_t<size_type>;
+  const auto distance    = [this](const size_type row, const std::size_t j) {
+    return static_cast<signed_size_type>(colnums[j] - row);
+  };
+
+  for (size_type row = 0; row < n_rows(); ++row)
+    for (std::size_t j = rowstart[row]; j < rowstart[row + 1]; ++j)
+      if (distance(row, j) > std::numeric_limits<std::int32_t>::max() ||
+          distance(row, j) < std::numeric_limits<std::int32_t>::min())
+        return;
+
+  relative_colnums = std::make_unique<std::int32_t[]>(rowstart[n_rows()]);
+  for (size_type row = 0; row < n_rows(); ++row)
+    for (std::size_t j = rowstart[row]; j < rowstart[row + 1]; ++j)
+      relative_colnums[j] = static_cast<std::int32_t>(distance(row, j));
+}
+
+
+
 std::size_t
 SparsityPattern::memory_consumption() const
 {
   return (max_dim * sizeof(size_type) + sizeof(*this) +
-          max_vec_len * sizeof(size_type));
+          max_vec_len * sizeof(size_type) +
+          (relative_colnums != nullptr ?
+             rowstart[rows] * sizeof(std::int32_t) :
+             0));
 }
 
 
@@ -0,0 +1,178 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/thread_local_sparsity_pattern.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace
+{
+  // Number of entries a thread buffer may hold before it is compressed for
+  // the first time. Later thresholds grow with the number of distinct
+  // entries in the buffer.
+  constexpr std::size_t initial_compress_threshold = 1 << 16;
+} // namespace
+
+
+
+ThreadLocalSparsityPattern::ThreadLocalSparsityPattern()
+  : thread_buffer(nullptr)
+{}
+
+
+
+ThreadLocalSparsityPattern::ThreadLocalSparsityPattern(const size_type m,
+                                                       const size_type n)
+  : SparsityPatternBase(m, n)
+  , thread_buffer(nullptr)
+{}
+
+
+
+void
+ThreadLocalSparsityPattern::reinit(const size_type m, const size_type n)
+{
+  resize(m, n);
+  thread_buffer.clear();
+  buffers.clear();
+}
+
+
+
+ThreadLocalSparsityPattern::Buffer &
+ThreadLocalSparsityPattern::get_buffer()
+{
+  Buffer *&buffer = thread_buffer.get();
+  if (buffer == nullptr)
+    {
+      std::lock_guard<std::mutex> lock(buffer_mutex);
+      buffers.push_back(std::make_unique<Buffer>());
+      buffer                     = buffers.back().get();
+      buffer->compress_threshold = initial_compress_threshold;
+      buffer->is_compressed      = true;
+    }
+  return *buffer;
+}
+
+
+
+void
+ThreadLocalSparsityPattern::Buffer::compress()
+{
+  if (is_compressed == false)
+    {
+      std::sort(entries.begin(), entries.end());
+      entries.erase(std::unique(entries.begin(), entries.end()),
+                    entries.end());
+      is_compressed = true;
+    }
+
+  // compress again once the buffer has doubled, which keeps the cost of the
+  // sorts proportional to the number of entries added
+  compress_threshold =
+    std::max(initial_compress_threshold, 2 * entries.size());
+}
+
+
+
+void
+ThreadLocalSparsityPattern::add_row_entries(
+  const size_type                  &row,
+  const ArrayView<const size_type> &columns,
+  const bool /*indices_are_sorted*/)
+{
+  AssertIndexRange(row, n_rows());
+
+  Buffer &buffer = get_buffer();
+  for (const size_type column : columns)
+    {
+      AssertIndexRange(column, n_cols());
+      buffer.entries.emplace_back(row, column);
+    }
+  if (columns.size() > 0)
+    buffer.is_compressed = false;
+  if (buffer.entries.size() > buffer.compress_threshold)
+    buffer.compress();
+}
+
+
+
+void
+ThreadLocalSparsityPattern::add_entries(
+  const ArrayView<const std::pair<size_type, size_type>> &entries)
+{
+  Buffer &buffer = get_buffer();
+  for (const auto &entry : entries)
+    {
+      AssertIndexRange(entry.first, n_rows());
+      AssertIndexRange(entry.second, n_cols());
+      buffer.entries.push_back(entry);
+    }
+  if (entries.size() > 0)
+    buffer.is_compressed = false;
+  if (buffer.entries.size() > buffer.compress_threshold)
+    buffer.compress();
+}
+
+
+
+void
+ThreadLocalSparsityPattern::compress()
+{
+  parallel::apply_to_subranges(
+    0U,
+    n_buffers(),
+    [this](const unsigned int begin, const unsigned int end) {
+      for (unsigned int b = begin; b < end; ++b)
+        buffers[b]->compress();
+    },
+    1);
+}
+
+
+
+bool
+ThreadLocalSparsityPattern::is_compressed() const
+{
+  for (const auto &buffer : buffers)
+    if (buffer->is_compressed == false)
+      return false;
+  return true;
+}
+
+
+
+unsigned int
+ThreadLocalSparsityPattern::n_buffers() const
+{
+  return buffers.size();
+}
+
+
+
+std::size_t
+ThreadLocalSparsityPattern::memory_consumption() const
+{
+  std::size_t memory = sizeof(*this);
+  for (const auto &buffer : buffers)
+    memory += sizeof(Buffer) + buffer->entries.capacity() *
+                                 sizeof(std::pair<size_type, size_type>);
+  return memory;
+}
+
+DEAL_II_NAMESPACE_CLOSE
@@ -0,0 +1,109 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check the variants of IndexSet::index_within_set() and
+// IndexSet::nth_index_in_set() that translate arrays of indices against the
+// functions for a single index, for sorted and unsorted queries on a
+// fragmented index set.
+
+#include <deal.II/base/index_set.h>
+
+#include "../tests.h"
+
+
+void
+test(const std::vector<types::global_dof_index> &queries,
+     const IndexSet                             &set)
+{
+  std::vector<types::global_dof_index> local(queries.size());
+  set.index_within_set(make_array_view(queries), make_array_view(local));
+
+  unsigned int n_errors = 0, n_elements = 0;
+  for (unsigned int i = 0; i < queries.size(); ++i)
+    {
+      if (local[i] != set.index_within_set(queries[i]))
+        ++n_errors;
+      const bool is_element = (local[i] != numbers::invalid_dof_index);
+      if (set.is_element(queries[i]) != is_element)
+        ++n_errors;
+      if (set.is_element(queries[i]))
+        ++n_elements;
+    }
+  deallog << "index_within_set: " << queries.size() << " queries, "
+          << n_elements << " elements, " << n_errors << " errors" << std::endl;
+
+  // translate the local indices of the elements back
+  std::vector<types::global_dof_index> nth, global;
+  for (const auto i : local)
+    if (i != numbers::invalid_dof_index)
+      nth.push_back(i);
+  global.resize(nth.size());
+  set.nth_index_in_set(make_array_view(nth), make_array_view(global));
+  n_errors = 0;
+  for (unsigned int i = 0; i < nth.size(); ++i)
+    if (global[i] != set.nth_index_in_set(nth[i]))
+      ++n_errors;
+  deallog << "nth_index_in_set: " << nth.size() << " queries, " << n_errors
+          << " errors" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  // a fragmented index set with isolated indices and ranges of varying
+  // length
+  const types::global_dof_index n = 100000;
+  IndexSet                      set(n);
+  for (types::global_dof_index i = 0; i < n; i += 7)
+    {
+      if (i % 3 == 0)
+        set.add_index(i);
+      else if (i % 3 == 1)
+        set.add_range(i, std::min(i + 4, n));
+    }
+  set.add_range(40000, 50000);
+  set.compress();
+  deallog << "Set with " << set.n_elements() << " elements in "
+          << set.n_intervals() << " intervals" << std::endl;
+
+  // all indices
+  std::vector<types::global_dof_index> queries(n);
+  for (types::global_dof_index i = 0; i < n; ++i)
+    queries[i] = i;
+  test(queries, set);
+
+  // sparse sorted queries, including the first and last index
+  queries.clear();
+  for (types::global_dof_index i = 0; i < n; i += 997)
+    queries.push_back(i);
+  queries.push_back(n - 1);
+  test(queries, set);
+
+  // unsorted queries with duplicates
+  queries.clear();
+  for (types::global_dof_index i = 0; i < 5000; ++i)
+    queries.push_back((i * 7919) % n);
+  queries.push_back(queries.front());
+  test(queries, set);
+
+  // empty set
+  IndexSet empty(n);
+  test(std::vector<types::global_dof_index>{0, 5, n - 1}, empty);
+}
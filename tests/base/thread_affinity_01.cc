@@ -0,0 +1,82 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check that vector operations and the initialization of AlignedVector give
+// the same results when threads are bound to cores through
+// MultithreadInfo::set_thread_affinity(), which switches the parallel loops
+// to a static assignment of index ranges to threads.
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const unsigned int size = 200000;
+
+  LinearAlgebra::distributed::Vector<double> v(size), w(size);
+  for (unsigned int i = 0; i < size; ++i)
+    {
+      v(i) = i % 7;
+      w(i) = 1.;
+    }
+  v.add(2., w);
+  deallog << "Vector sum: " << v.mean_value() * size
+          << ", dot product: " << v * w << std::endl;
+
+  // memory newly allocated with threads bound to cores gets touched and
+  // thus zeroed already in resize, independent of omit_zeroing_entries
+  LinearAlgebra::distributed::Vector<double> u;
+  u.reinit(size, true);
+  if (MultithreadInfo::get_thread_affinity() !=
+      MultithreadInfo::ThreadAffinity::none)
+    deallog << "Norm of new vector: " << u.l2_norm() << std::endl;
+
+  AlignedVector<double> a(size, 1.5);
+  double                sum = 0;
+  for (const double entry : a)
+    sum += entry;
+  deallog << "AlignedVector sum: " << sum << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog << "Default affinity: "
+          << static_cast<int>(MultithreadInfo::get_thread_affinity())
+          << std::endl;
+  test();
+
+  for (const auto affinity : {MultithreadInfo::ThreadAffinity::compact,
+                              MultithreadInfo::ThreadAffinity::scatter,
+                              MultithreadInfo::ThreadAffinity::none})
+    {
+      MultithreadInfo::set_thread_affinity(affinity);
+      deallog << "Affinity: "
+              << static_cast<int>(MultithreadInfo::get_thread_affinity())
+              << std::endl;
+      test();
+    }
+}
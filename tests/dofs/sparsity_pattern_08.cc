@@ -0,0 +1,166 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check that the variants of DoFTools::make_sparsity_pattern() and
+// DoFTools::make_flux_sparsity_pattern() give the same SparsityPattern when
+// filling a ThreadLocalSparsityPattern, which loops over the cells in
+// parallel, as when filling a DynamicSparsityPattern.
+
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/thread_local_sparsity_pattern.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, typename Function>
+void
+compare(const std::string &name,
+        const DoFHandler<dim> &dof,
+        const Function        &make_pattern)
+{
+  DynamicSparsityPattern dsp(dof.n_dofs(), dof.n_dofs());
+  make_pattern(dsp);
+  SparsityPattern sparsity_1;
+  sparsity_1.copy_from(dsp);
+
+  ThreadLocalSparsityPattern tlsp(dof.n_dofs(), dof.n_dofs());
+  make_pattern(tlsp);
+  SparsityPattern sparsity_2;
+  sparsity_2.copy_from(tlsp);
+
+  deallog << name << ": " << (sparsity_1 == sparsity_2 ? "OK" : "Failed")
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  deallog << "dim = " << dim << std::endl;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  {
+    FESystem<dim>   fe(FE_Q<dim>(2), 2);
+    DoFHandler<dim> dof(tria);
+    dof.distribute_dofs(fe);
+
+    AffineConstraints<double> constraints;
+    DoFTools::make_hanging_node_constraints(dof, constraints);
+    constraints.close();
+
+    compare("make_sparsity_pattern", dof, [&](SparsityPatternBase &sp) {
+      DoFTools::make_sparsity_pattern(dof, sp, constraints, false);
+    });
+
+    Table<2, DoFTools::Coupling> couplings(2, 2);
+    couplings.fill(DoFTools::none);
+    couplings(0, 0) = DoFTools::always;
+    couplings(1, 0) = DoFTools::always;
+    compare("make_sparsity_pattern with couplings",
+            dof,
+            [&](SparsityPatternBase &sp) {
+              DoFTools::make_sparsity_pattern(
+                dof, couplings, sp, constraints, true);
+            });
+  }
+
+  {
+    FE_DGQ<dim>     fe(1);
+    DoFHandler<dim> dof(tria);
+    dof.distribute_dofs(fe);
+
+    AffineConstraints<double> constraints;
+    constraints.close();
+
+    compare("make_flux_sparsity_pattern", dof, [&](SparsityPatternBase &sp) {
+      DoFTools::make_flux_sparsity_pattern(dof, sp, constraints, false);
+    });
+  }
+
+  {
+    FESystem<dim>   fe(FE_DGQ<dim>(1), 2);
+    DoFHandler<dim> dof(tria);
+    dof.distribute_dofs(fe);
+
+    AffineConstraints<double> constraints;
+    constraints.close();
+
+    Table<2, DoFTools::Coupling> cell_couplings(2, 2), face_couplings(2, 2);
+    cell_couplings.fill(DoFTools::always);
+    face_couplings.fill(DoFTools::none);
+    face_couplings(0, 0) = DoFTools::nonzero;
+    face_couplings(1, 0) = DoFTools::always;
+    compare("make_flux_sparsity_pattern with couplings",
+            dof,
+            [&](SparsityPatternBase &sp) {
+              DoFTools::make_flux_sparsity_pattern(
+                dof, sp, cell_couplings, face_couplings);
+            });
+
+    const auto face_has_flux_coupling =
+      [](const typename DoFHandler<dim>::active_cell_iterator &cell,
+         const unsigned int                                    face) {
+        return cell->face(face)->center()[0] < 0.5;
+      };
+    compare("make_flux_sparsity_pattern with face coupling",
+            dof,
+            [&](SparsityPatternBase &sp) {
+              DoFTools::make_flux_sparsity_pattern(
+                dof,
+                sp,
+                constraints,
+                false,
+                cell_couplings,
+                face_couplings,
+                numbers::invalid_subdomain_id,
+                face_has_flux_coupling);
+            });
+  }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
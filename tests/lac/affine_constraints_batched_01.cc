@@ -0,0 +1,188 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check that the batched AffineConstraints::distribute_local_to_global()
+// gives the same results as the one-cell-at-a-time variant, and that
+// distribute() works on a closed object with a mix of homogeneous,
+// inhomogeneous and chained constraints, as does condense() on the
+// homogeneous part. The "mesh" is a chain of cells with three unknowns
+// each, where neighboring cells share one unknown.
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+void
+test(const bool use_inhomogeneities_for_rhs)
+{
+  const unsigned int n_cells = 20;
+  const unsigned int n_dofs  = 2 * n_cells + 1;
+
+  AffineConstraints<double> constraints;
+  constraints.add_line(0);
+  constraints.set_inhomogeneity(0, 1.);
+  constraints.add_line(7);
+  constraints.add_entry(7, 6, 0.5);
+  constraints.add_entry(7, 8, 0.5);
+  constraints.add_line(8);
+  constraints.add_entry(8, 9, 1.);
+  constraints.set_inhomogeneity(8, -0.5);
+  constraints.add_line(n_dofs - 1);
+  constraints.add_entry(n_dofs - 1, 1, 1.);
+  constraints.close();
+
+  std::vector<std::vector<types::global_dof_index>> dof_indices(n_cells);
+  std::vector<FullMatrix<double>>                   local_matrices(n_cells);
+  std::vector<Vector<double>>                       local_vectors(n_cells);
+  for (unsigned int c = 0; c < n_cells; ++c)
+    {
+      dof_indices[c] = {2 * c, 2 * c + 1, 2 * c + 2};
+      local_matrices[c].reinit(3, 3);
+      local_vectors[c].reinit(3);
+      for (unsigned int i = 0; i < 3; ++i)
+        {
+          for (unsigned int j = 0; j < 3; ++j)
+            local_matrices[c](i, j) = random_value<double>();
+          local_matrices[c](i, i) += 3.;
+          local_vectors[c](i) = random_value<double>();
+        }
+    }
+
+  DynamicSparsityPattern dsp(n_dofs, n_dofs);
+  for (unsigned int c = 0; c < n_cells; ++c)
+    constraints.add_entries_local_to_global(dof_indices[c], dsp, false);
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<double> matrix_ref(sparsity), matrix(sparsity),
+    matrix_only(sparsity);
+  Vector<double> rhs_ref(n_dofs), rhs(n_dofs);
+
+  for (unsigned int c = 0; c < n_cells; ++c)
+    constraints.distribute_local_to_global(local_matrices[c],
+                                           local_vectors[c],
+                                           dof_indices[c],
+                                           matrix_ref,
+                                           rhs_ref,
+                                           use_inhomogeneities_for_rhs);
+  constraints.distribute_local_to_global(local_matrices,
+                                         local_vectors,
+                                         dof_indices,
+                                         matrix,
+                                         rhs,
+                                         use_inhomogeneities_for_rhs);
+  constraints.distribute_local_to_global(local_matrices,
+                                         dof_indices,
+                                         matrix_only);
+
+  matrix.add(-1., matrix_ref);
+  matrix_only.add(-1., matrix_ref);
+  rhs -= rhs_ref;
+  deallog << "Matrix difference: " << matrix.frobenius_norm() << std::endl;
+  deallog << "Matrix-only difference: " << matrix_only.frobenius_norm()
+          << std::endl;
+  deallog << "Vector difference: " << rhs.l2_norm() << std::endl;
+
+  // distribute() must reproduce the constraints, including the chained one
+  // that was resolved by close()
+  Vector<double> solution(n_dofs);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    solution(i) = i;
+  constraints.distribute(solution);
+  deallog << "Distributed values: " << solution(0) << ' ' << solution(7)
+          << ' ' << solution(8) << ' ' << solution(n_dofs - 1) << std::endl;
+
+  // a copy also copies the entry arrays set up by close(), and shift() must
+  // move both these arrays and the entries of the lines
+  AffineConstraints<double> copy(constraints);
+  bool same_lines = copy.get_lines().size() == constraints.get_lines().size();
+  for (unsigned int l = 0; same_lines && l < copy.get_lines().size(); ++l)
+    same_lines =
+      (copy.get_lines()[l].index == constraints.get_lines()[l].index) &&
+      (copy.get_lines()[l].entries == constraints.get_lines()[l].entries) &&
+      (copy.get_lines()[l].inhomogeneity ==
+       constraints.get_lines()[l].inhomogeneity);
+  deallog << "Same lines: " << same_lines << std::endl;
+
+  copy.shift(n_dofs);
+  bool shifted_lines = true;
+  for (unsigned int l = 0; l < copy.get_lines().size(); ++l)
+    for (unsigned int e = 0; e < copy.get_lines()[l].entries.size(); ++e)
+      shifted_lines &= (copy.get_lines()[l].entries[e].first ==
+                        constraints.get_lines()[l].entries[e].first + n_dofs);
+  deallog << "Shifted lines: " << shifted_lines << std::endl;
+
+  Vector<double> solution_shifted(2 * n_dofs);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    solution_shifted(n_dofs + i) = i;
+  copy.distribute(solution_shifted);
+  double shifted_difference = 0.;
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    shifted_difference +=
+      std::abs(solution_shifted(n_dofs + i) - solution(i));
+  deallog << "Shifted copy difference: " << shifted_difference << std::endl;
+
+  // condense() must move the constrained entries to the degrees of freedom
+  // they are constrained to and zero them out. Without a matrix, this is
+  // only possible for homogeneous constraints, so use the same constraints
+  // without their inhomogeneities.
+  AffineConstraints<double> homogeneous_constraints;
+  for (const auto &line : constraints.get_lines())
+    {
+      homogeneous_constraints.add_line(line.index);
+      for (const auto &entry : line.entries)
+        homogeneous_constraints.add_entry(line.index,
+                                          entry.first,
+                                          entry.second);
+    }
+  homogeneous_constraints.close();
+
+  Vector<double> condensed(n_dofs);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    condensed(i) = 1.;
+  homogeneous_constraints.condense(condensed);
+  deallog << "Condensed values:";
+  for (const unsigned int i : {0u, 1u, 6u, 7u, 8u, 9u, n_dofs - 1})
+    deallog << ' ' << condensed(i);
+  deallog << std::endl;
+
+  // get_dof_values() reads through the same arrays
+  std::vector<types::global_dof_index> indices = {7, 8, 9};
+  std::vector<double>                  values(3);
+  constraints.get_dof_values(solution,
+                             indices.begin(),
+                             values.begin(),
+                             values.end());
+  deallog << "Dof values: " << values[0] << ' ' << values[1] << ' '
+          << values[2] << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test(false);
+  test(true);
+}
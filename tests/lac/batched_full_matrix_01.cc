@@ -0,0 +1,166 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the LU and Cholesky factorizations, solves, inverses and products
+// of BatchedFullMatrix against FullMatrix, for a number of matrices that is
+// not a multiple of the vectorization width, and the product of empty
+// matrices
+
+#include <deal.II/lac/batched_full_matrix.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <typename Number>
+void
+test(const unsigned int n_matrices, const unsigned int size)
+{
+  deallog << "n_matrices=" << n_matrices << " size=" << size << std::endl;
+
+  constexpr unsigned int n_lanes = BatchedFullMatrix<Number>::n_lanes;
+  const double           tolerance =
+    std::is_same_v<Number, float> ? 1e-4 : 1e-12;
+
+  // symmetric and diagonally dominant matrices
+  std::vector<FullMatrix<Number>> matrices(n_matrices,
+                                           FullMatrix<Number>(size, size));
+  for (FullMatrix<Number> &matrix : matrices)
+    {
+      for (unsigned int i = 0; i < size; ++i)
+        for (unsigned int j = 0; j < i; ++j)
+          matrix(i, j) = matrix(j, i) = random_value<Number>() - 0.5;
+      for (unsigned int i = 0; i < size; ++i)
+        matrix(i, i) = size;
+    }
+
+  BatchedFullMatrix<Number> batched(n_matrices, size, size);
+  for (unsigned int index = 0; index < n_matrices; ++index)
+    batched.set_matrix(index, matrices[index]);
+
+  AlignedVector<VectorizedArray<Number>> src(batched.n_batches() * size),
+    dst(batched.n_batches() * size);
+  for (VectorizedArray<Number> &entry : src)
+    for (unsigned int v = 0; v < n_lanes; ++v)
+      entry[v] = random_value<Number>();
+
+  const auto check = [&](const std::string &name, const bool inverse) {
+    double error = 0;
+    for (unsigned int index = 0; index < n_matrices; ++index)
+      {
+        const unsigned int batch = index / n_lanes, lane = index % n_lanes;
+        Vector<Number>     x(size), y(size), reference(size);
+        for (unsigned int i = 0; i < size; ++i)
+          {
+            x(i) = src[batch * size + i][lane];
+            y(i) = dst[batch * size + i][lane];
+          }
+        if (inverse)
+          {
+            // check A y = x
+            matrices[index].vmult(reference, y);
+            reference -= x;
+          }
+        else
+          {
+            matrices[index].vmult(reference, x);
+            reference -= y;
+          }
+        error = std::max<double>(error, reference.linfty_norm());
+      }
+    deallog << name << ": " << (error < tolerance * size ? "OK" : "FAILED")
+            << std::endl;
+  };
+
+  batched.vmult(make_array_view(dst), make_array_view(std::as_const(src)));
+  check("vmult", false);
+
+  // matrix-matrix product with the identity and with itself
+  BatchedFullMatrix<Number> identity(n_matrices, size, size), product;
+  for (unsigned int b = 0; b < identity.n_batches(); ++b)
+    for (unsigned int i = 0; i < size; ++i)
+      identity(b, i, i) = 1.;
+  batched.mmult(product, identity);
+  product.vmult(make_array_view(dst), make_array_view(std::as_const(src)));
+  check("mmult identity", false);
+  batched.mmult(product, batched);
+  double error = 0;
+  for (unsigned int index = 0; index < n_matrices; index += 3)
+    {
+      FullMatrix<Number> reference(size, size), result;
+      matrices[index].mmult(reference, matrices[index]);
+      product.get_matrix(index, result);
+      result.add(-1., reference);
+      error = std::max<double>(error, result.frobenius_norm());
+    }
+  deallog << "mmult: " << (error < tolerance * size * size ? "OK" : "FAILED")
+          << std::endl;
+
+  for (unsigned int variant = 0; variant < 3; ++variant)
+    {
+      BatchedFullMatrix<Number> factorized(batched);
+      if (variant == 0)
+        factorized.compute_lu_factorization();
+      else if (variant == 1)
+        factorized.compute_cholesky_factorization();
+      else
+        factorized.invert();
+
+      dst = src;
+      factorized.solve(make_array_view(dst));
+      check(variant == 0 ? "LU solve" :
+                           (variant == 1 ? "Cholesky solve" : "inverse solve"),
+            true);
+    }
+
+  BatchedFullMatrix<Number> inverse(batched);
+  inverse.compute_cholesky_factorization();
+  inverse.invert();
+  inverse.vmult(make_array_view(dst), make_array_view(std::as_const(src)));
+  check("Cholesky inverse vmult", true);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<double>(1, 4);
+  test<double>(13, 5);
+  test<double>(101, 20);
+  test<float>(29, 12);
+  test<double>(9, 150);
+
+  {
+    BatchedFullMatrix<double> empty(5, 0, 0), product;
+    empty.mmult(product, empty);
+    deallog << "mmult of empty matrices: " << product.m() << 'x'
+            << product.n() << std::endl;
+
+    // a product over an empty inner dimension is zero
+    BatchedFullMatrix<double> left(5, 3, 0), right(5, 0, 2);
+    left.mmult(product, right);
+    double norm = 0;
+    for (unsigned int b = 0; b < product.n_batches(); ++b)
+      for (unsigned int i = 0; i < product.m(); ++i)
+        for (unsigned int j = 0; j < product.n(); ++j)
+          norm += std::abs(product(b, i, j).sum());
+    deallog << "mmult with empty inner dimension: " << product.m() << 'x'
+            << product.n() << ", norm " << norm << std::endl;
+  }
+}
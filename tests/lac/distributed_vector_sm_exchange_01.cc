@@ -0,0 +1,122 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test LinearAlgebra::distributed::Vector::update_ghost_values() and
+// compress() when the vector exchanges the data with the processes in a
+// shared-memory communicator directly through their memory, see
+// enable_shared_memory_ghost_exchange(). The processes of each compute node
+// are split into groups of two, so that both the exchange through shared
+// memory and through MPI are used also if all processes run on one node.
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "../tests.h"
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  AssertDimension(Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD), 4);
+
+  const unsigned int my_rank =
+    Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  MPI_Comm sm_comm;
+  MPI_Comm_split_type(
+    MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, my_rank, MPI_INFO_NULL, &sm_comm);
+  const unsigned int rank_in_sm = Utilities::MPI::this_mpi_process(sm_comm);
+
+  MPI_Comm node_comm;
+  MPI_Comm_split(sm_comm, rank_in_sm / 2, rank_in_sm, &node_comm);
+
+  IndexSet is_local(40);
+  is_local.add_range(10 * my_rank, 10 * my_rank + 10);
+  IndexSet is_ghost(40);
+  is_ghost.add_index(10 * ((my_rank + 1) % 4));
+  is_ghost.add_index(10 * ((my_rank + 1) % 4) + 1);
+  is_ghost.add_index(10 * ((my_rank + 3) % 4) + 9);
+
+  const auto partitioner_ref =
+    std::make_shared<Utilities::MPI::Partitioner>(is_local,
+                                                  is_ghost,
+                                                  MPI_COMM_WORLD);
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(is_local,
+                                                  is_ghost,
+                                                  MPI_COMM_WORLD);
+
+  LinearAlgebra::distributed::Vector<double> vector_ref(partitioner_ref);
+  LinearAlgebra::distributed::Vector<double> vector;
+  vector.reinit(partitioner, node_comm);
+  vector.enable_shared_memory_ghost_exchange();
+  deallog << "Shared-memory exchange: "
+          << vector.uses_shared_memory_ghost_exchange() << std::endl;
+
+  for (unsigned int i = 0; i < partitioner->locally_owned_size(); ++i)
+    {
+      vector.local_element(i)     = 10 * my_rank + i;
+      vector_ref.local_element(i) = 10 * my_rank + i;
+    }
+
+  for (unsigned int repeat = 0; repeat < 2; ++repeat)
+    {
+      vector.update_ghost_values();
+      vector_ref.update_ghost_values();
+
+      deallog << "Ghost values:";
+      for (const auto i : is_ghost)
+        {
+          deallog << ' ' << static_cast<unsigned int>(vector(i));
+          AssertThrow(vector(i) == vector_ref(i), ExcInternalError());
+        }
+      deallog << std::endl;
+
+      vector.zero_out_ghost_values();
+      vector_ref.zero_out_ghost_values();
+
+      for (const auto i : is_ghost)
+        {
+          vector(i)     = 1. + i;
+          vector_ref(i) = 1. + i;
+        }
+      vector.compress(VectorOperation::add);
+      vector_ref.compress(VectorOperation::add);
+
+      deallog << "Locally owned values:";
+      for (unsigned int i = 0; i < partitioner->locally_owned_size(); ++i)
+        {
+          deallog << ' ' << static_cast<unsigned int>(vector.local_element(i));
+          AssertThrow(vector.local_element(i) == vector_ref.local_element(i),
+                      ExcInternalError());
+        }
+      deallog << std::endl;
+
+      // the owners zero the ghost values in shared memory, so wait until
+      // all of them have finished compress() before looking at them
+      MPI_Barrier(MPI_COMM_WORLD);
+      for (const auto i : is_ghost)
+        AssertThrow(vector(i) == 0., ExcInternalError());
+    }
+
+  MPI_Comm_free(&node_comm);
+  MPI_Comm_free(&sm_comm);
+}
@@ -0,0 +1,224 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check LinearAlgebra::distributed::OverlappedSparseMatrix for a
+// one-dimensional Laplacian distributed among the MPI processes: compare the
+// matrix-vector product against the analytic result, and solve a linear
+// system with SolverCG, which uses the variant of vmult() with operations
+// before and after the product, and with SolverGMRES. For the variant with
+// operations, also check that the operations are called exactly once on each
+// locally owned entry, and the operation after the product only after the
+// operation before the product. Finally, check processes that own no rows.
+
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_overlapped_sparse_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include "../tests.h"
+
+
+
+void
+test(const unsigned int n)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  const unsigned int rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  deallog << "n = " << n << std::endl;
+
+  // contiguous distribution of the rows; the neighbors of the first and last
+  // locally owned row are ghosts
+  const unsigned int begin = n * rank / n_ranks;
+  const unsigned int end   = n * (rank + 1) / n_ranks;
+  IndexSet           owned(n), ghosts(n);
+  owned.add_range(begin, end);
+  if (begin > 0)
+    ghosts.add_index(begin - 1);
+  if (end < n)
+    ghosts.add_index(end);
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(owned,
+                                                  ghosts,
+                                                  MPI_COMM_WORLD);
+
+  // matrix with entries 2 + i/n on the diagonal and -1 on the off-diagonals,
+  // in the local numbering of the partitioner
+  const unsigned int     n_owned = end - begin;
+  const unsigned int     n_local = n_owned + partitioner->n_ghost_indices();
+  DynamicSparsityPattern dsp(n_owned, n_local);
+  for (unsigned int i = begin; i < end; ++i)
+    for (unsigned int j = (i > 0 ? i - 1 : 0); j < std::min(i + 2, n); ++j)
+      dsp.add(i - begin, partitioner->global_to_local(j));
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+  SparseMatrix<double> local_matrix(sparsity);
+  for (unsigned int i = begin; i < end; ++i)
+    for (unsigned int j = (i > 0 ? i - 1 : 0); j < std::min(i + 2, n); ++j)
+      local_matrix.set(i - begin,
+                       partitioner->global_to_local(j),
+                       i == j ? 2. + 1. * i / n : -1.);
+
+  LinearAlgebra::distributed::OverlappedSparseMatrix<double> matrix;
+  matrix.reinit(partitioner, local_matrix);
+  deallog << "Number of boundary rows: "
+          << Utilities::MPI::sum(matrix.n_boundary_rows(), MPI_COMM_WORLD)
+          << std::endl;
+
+  const auto source = [](const unsigned int i) {
+    return std::sin(0.1 * i) + 1.;
+  };
+
+  VectorType src(partitioner), dst(partitioner);
+  for (unsigned int i = begin; i < end; ++i)
+    src(i) = source(i);
+  matrix.vmult(dst, src);
+
+  double error = 0;
+  for (unsigned int i = begin; i < end; ++i)
+    {
+      double result = (2. + 1. * i / n) * source(i);
+      if (i > 0)
+        result -= source(i - 1);
+      if (i + 1 < n)
+        result -= source(i + 1);
+      error = std::max(error, std::abs(dst(i) - result));
+    }
+  deallog << "Error of matrix-vector product: "
+          << (Utilities::MPI::max(error, MPI_COMM_WORLD) < 1e-14 ? "OK" :
+                                                                    "Failed")
+          << std::endl;
+  deallog << "Ghost values zeroed: " << (src.has_ghost_elements() == false)
+          << std::endl;
+
+  VectorType dst_add(dst);
+  matrix.vmult_add(dst_add, src);
+  dst_add.add(-2., dst);
+  deallog << "Error of vmult_add: "
+          << (dst_add.linfty_norm() < 1e-14 ? "OK" : "Failed") << std::endl;
+
+  // the operation before the product zeroes the destination vector, so the
+  // result must be the same as for vmult()
+  std::vector<unsigned int> n_before(n_owned), n_after(n_owned);
+  VectorType                dst_operations(partitioner);
+  dst_operations = 1.;
+  matrix.vmult(
+    dst_operations,
+    src,
+    [&](const unsigned int range_begin, const unsigned int range_end) {
+      for (unsigned int i = range_begin; i < range_end; ++i)
+        {
+          ++n_before[i];
+          dst_operations.local_element(i) = 0.;
+        }
+    },
+    [&](const unsigned int range_begin, const unsigned int range_end) {
+      for (unsigned int i = range_begin; i < range_end; ++i)
+        if (n_before[i] == 1)
+          ++n_after[i];
+    });
+  bool operations_once = true;
+  for (unsigned int i = 0; i < n_owned; ++i)
+    if (n_before[i] != 1 || n_after[i] != 1)
+      operations_once = false;
+  dst_operations -= dst;
+  deallog << "Operations called once on each entry: "
+          << (Utilities::MPI::min(operations_once ? 1 : 0, MPI_COMM_WORLD) ==
+              1)
+          << std::endl;
+  deallog << "Error of vmult with operations: "
+          << (dst_operations.linfty_norm() < 1e-14 ? "OK" : "Failed")
+          << std::endl;
+
+  // solve a linear system with a Jacobi preconditioner
+  VectorType diagonal(partitioner);
+  for (unsigned int i = begin; i < end; ++i)
+    diagonal(i) = 1. / (2. + 1. * i / n);
+  DiagonalMatrix<VectorType> preconditioner(diagonal);
+
+  VectorType rhs(partitioner), solution(partitioner), residual(partitioner);
+  rhs = 1.;
+
+  const auto check_residual = [&](const std::string &name) {
+    matrix.vmult(residual, solution);
+    residual.sadd(-1., 1., rhs);
+    deallog << name << " residual below tolerance: "
+            << (residual.l2_norm() < 1e-9 * rhs.l2_norm()) << std::endl;
+  };
+
+  {
+    SolverControl        control(200, 1e-12 * rhs.l2_norm(), false, false);
+    SolverCG<VectorType> solver(control);
+    solver.solve(matrix, solution, rhs, preconditioner);
+    check_residual("CG");
+  }
+  {
+    solution = 0.;
+    SolverControl           control(200, 1e-12 * rhs.l2_norm(), false, false);
+    SolverGMRES<VectorType> solver(control);
+    solver.solve(matrix, solution, rhs, preconditioner);
+    check_residual("GMRES");
+  }
+}
+
+
+
+// set up and apply a matrix on a process without any rows, which also
+// happens for the first process in test(2) with three processes
+void
+test_empty()
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  const auto partitioner = std::make_shared<Utilities::MPI::Partitioner>(0U);
+
+  DynamicSparsityPattern dsp(0, 0);
+  SparsityPattern        sparsity;
+  sparsity.copy_from(dsp);
+  SparseMatrix<double> local_matrix(sparsity);
+
+  LinearAlgebra::distributed::OverlappedSparseMatrix<double> matrix;
+  matrix.reinit(partitioner, local_matrix);
+
+  VectorType src(partitioner), dst(partitioner);
+  matrix.vmult(dst, src);
+  matrix.vmult_add(dst, src);
+  deallog << "Empty matrix: m = " << matrix.m()
+          << ", boundary rows = " << matrix.n_boundary_rows() << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test(100);
+  test(1000);
+  test(2);
+  test_empty();
+}
@@ -0,0 +1,107 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check LinearAlgebra::distributed::fused_vector_operation() against the
+// separate vector operations it replaces, for sizes that are not multiples
+// of the SIMD width and that span several blocks.
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/la_parallel_vector_fused_operation.h>
+
+#include "../tests.h"
+
+
+template <typename Number>
+void
+test(const unsigned int size)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  VectorType x(size), r(size), p(size), v(size);
+  for (unsigned int i = 0; i < size; ++i)
+    {
+      x(i) = random_value<Number>();
+      r(i) = random_value<Number>();
+      p(i) = random_value<Number>();
+      v(i) = random_value<Number>();
+    }
+
+  const Number alpha = 0.7;
+
+  // reference computation with the separate operations
+  VectorType x_ref(x), r_ref(r);
+  x_ref.add(alpha, p);
+  r_ref.add(-alpha, v);
+  const Number r_norm_sqr = r_ref.norm_sqr();
+  const Number r_dot_v    = r_ref * v;
+
+  const std::array<Number, 2> results =
+    LinearAlgebra::distributed::fused_vector_operation<2>(
+      [alpha](std::array<VectorizedArray<Number>, 2> &sums,
+              VectorizedArray<Number>                &x,
+              VectorizedArray<Number>                &r,
+              const VectorizedArray<Number>          &p,
+              const VectorizedArray<Number>          &v) {
+        x += alpha * p;
+        r -= alpha * v;
+        sums[0] += r * r;
+        sums[1] += r * v;
+      },
+      x,
+      r,
+      std::as_const(p),
+      std::as_const(v));
+
+  x -= x_ref;
+  r -= r_ref;
+  const Number tolerance = 100 * std::numeric_limits<Number>::epsilon();
+  deallog << "Size " << size << ": update error "
+          << (x.linfty_norm() + r.linfty_norm() < tolerance ? "OK" : "Failed")
+          << ", reduction error "
+          << (std::abs(results[0] - r_norm_sqr) < tolerance * r_norm_sqr &&
+                  std::abs(results[1] - r_dot_v) <
+                    tolerance * std::sqrt(r_norm_sqr * v.norm_sqr()) ?
+                "OK" :
+                "Failed")
+          << std::endl;
+
+  // pure reduction over a const vector, in which the unused lanes at the end
+  // would contribute a nonzero value
+  const std::array<Number, 1> sum =
+    LinearAlgebra::distributed::fused_vector_operation<1>(
+      [](std::array<VectorizedArray<Number>, 1> &sums,
+         const VectorizedArray<Number>          &p) { sums[0] += p + 1.; },
+      std::as_const(p));
+  deallog << "Sum of entries plus one: "
+          << (std::abs(sum[0] - p.mean_value() * size - size) <
+                  tolerance * size ?
+                "OK" :
+                "Failed")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (const unsigned int size : {1U, 3U, 17U, 4096U, 10007U})
+    test<double>(size);
+  for (const unsigned int size : {5U, 20001U})
+    test<float>(size);
+}
@@ -0,0 +1,142 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test reuse of the eigenvalue estimates of PreconditionChebyshev across
+// calls to initialize() with AdditionalData::eigenvalue_drift_tolerance, as
+// well as the serialization of the estimates and set_eigenvalue_information()
+
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+using Chebyshev = PreconditionChebyshev<SparseMatrix<double>,
+                                        Vector<double>,
+                                        DiagonalMatrix<Vector<double>>>;
+
+
+void
+print(const std::string &name, const Chebyshev::EigenvalueInformation &info)
+{
+  deallog << name << ": CG iterations " << info.cg_iterations
+          << ", eigenvalues " << info.min_eigenvalue_estimate << " "
+          << info.max_eigenvalue_estimate << std::endl;
+}
+
+
+
+void
+test(const Chebyshev::AdditionalData::EigenvalueAlgorithm algorithm)
+{
+  const unsigned int size = 16;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure), B(structure);
+  testproblem.five_point(A);
+
+  // fix the preconditioner such that the scaling of the matrix changes the
+  // spectrum of the preconditioned matrix
+  Chebyshev::AdditionalData data;
+  data.preconditioner = std::make_shared<DiagonalMatrix<Vector<double>>>();
+  data.preconditioner->get_vector().reinit(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    data.preconditioner->get_vector()(i) = 1. / A.diag_element(i);
+  data.degree                     = 4;
+  data.smoothing_range            = 20;
+  data.eig_cg_n_iterations        = 12;
+  data.eigenvalue_algorithm       = algorithm;
+  data.eigenvalue_drift_tolerance = 0.05;
+
+  Vector<double> src(dim), dst(dim), dst_ref(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    src(i) = random_value<double>();
+
+  Chebyshev cheby;
+  cheby.initialize(A, data);
+  print("Initial matrix", cheby.estimate_eigenvalues(src));
+  cheby.vmult(dst_ref, src);
+
+  // the same matrix again: the estimate is reused
+  cheby.initialize(A, data);
+  print("Same matrix", cheby.estimate_eigenvalues(src));
+  cheby.vmult(dst, src);
+  dst -= dst_ref;
+  deallog << "Difference vmult: " << dst.linfty_norm() << std::endl;
+
+  // small change of the matrix: the estimate is reused
+  B.copy_from(A);
+  B *= 1.02;
+  cheby.initialize(B, data);
+  print("Matrix scaled by 1.02", cheby.estimate_eigenvalues(src));
+
+  // large change of the matrix: the eigenvalues are computed again
+  B.copy_from(A);
+  B *= 1.5;
+  cheby.initialize(B, data);
+  print("Matrix scaled by 1.5", cheby.estimate_eigenvalues(src));
+
+  // the estimates can be stored and restored
+  cheby.initialize(A, data);
+  print("Original matrix", cheby.estimate_eigenvalues(src));
+  cheby.vmult(dst_ref, src);
+  std::ostringstream oss;
+  {
+    boost::archive::text_oarchive oa(oss, boost::archive::no_header);
+    oa << cheby.get_eigenvalue_information();
+  }
+  Chebyshev::EigenvalueInformation restored_info;
+  {
+    std::istringstream            iss(oss.str());
+    boost::archive::text_iarchive ia(iss, boost::archive::no_header);
+    ia >> restored_info;
+  }
+
+  Chebyshev cheby_restored;
+  cheby_restored.initialize(A, data);
+  cheby_restored.set_eigenvalue_information(restored_info);
+  print("Restored", cheby_restored.estimate_eigenvalues(src));
+  cheby_restored.vmult(dst, src);
+  dst -= dst_ref;
+  deallog << "Difference vmult: " << dst.linfty_norm() << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(6);
+
+  deallog.push("lanczos");
+  test(Chebyshev::AdditionalData::EigenvalueAlgorithm::lanczos);
+  deallog.pop();
+  deallog.push("power");
+  test(Chebyshev::AdditionalData::EigenvalueAlgorithm::power_iteration);
+  deallog.pop();
+}
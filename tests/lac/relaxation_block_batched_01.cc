@@ -0,0 +1,131 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that RelaxationBlockJacobi gives the same results with
+// AdditionalData::batched_inverses as with the default storage of the
+// inverses, for overlapping blocks of different sizes, and that the batched
+// inverses are part of memory_consumption()
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/relaxation_block.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename RelaxationType, typename InverseNumberType>
+void
+check(const std::string                       &name,
+      const SparseMatrix<double>              &A,
+      typename RelaxationType::AdditionalData &data,
+      const Vector<double>                    &src,
+      const double                             tolerance)
+{
+  Vector<double> dst(src.size()), dst_batched(src.size());
+
+  data.batched_inverses = false;
+  RelaxationType relaxation;
+  relaxation.initialize(A, data);
+  relaxation.vmult(dst, src);
+  relaxation.step(dst, src);
+  relaxation.Tstep(dst, src);
+
+  data.batched_inverses = true;
+  RelaxationType relaxation_batched;
+  relaxation_batched.initialize(A, data);
+  relaxation_batched.vmult(dst_batched, src);
+  relaxation_batched.step(dst_batched, src);
+  relaxation_batched.Tstep(dst_batched, src);
+
+  dst_batched -= dst;
+  deallog << name << ": "
+          << (dst_batched.linfty_norm() < tolerance * dst.linfty_norm() ?
+                "OK" :
+                "FAILED")
+          << std::endl;
+
+  std::size_t inverse_size = 0;
+  for (unsigned int block = 0; block < data.block_list.n_rows(); ++block)
+    inverse_size += data.block_list.row_length(block) *
+                    data.block_list.row_length(block) *
+                    sizeof(InverseNumberType);
+  deallog << name << " memory consumption: "
+          << (relaxation_batched.memory_consumption() >= inverse_size ?
+                "OK" :
+                "FAILED")
+          << std::endl;
+}
+
+
+
+template <typename InverseNumberType>
+void
+test(const double tolerance)
+{
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+
+  // one block per unknown consisting of the unknown and its neighbors,
+  // giving overlapping blocks of three, four, and five unknowns
+  DynamicSparsityPattern dsp(dim, dim);
+  for (unsigned int row = 0; row < dim; ++row)
+    for (auto entry = structure.begin(row); entry != structure.end(row);
+         ++entry)
+      dsp.add(row, entry->column());
+
+  using Jacobi =
+    RelaxationBlockJacobi<SparseMatrix<double>, InverseNumberType>;
+
+  typename Jacobi::AdditionalData data;
+  data.block_list.copy_from(dsp);
+  data.relaxation = 0.5;
+
+  Vector<double> src(dim);
+  for (unsigned int i = 0; i < dim; ++i)
+    src(i) = random_value<double>();
+
+  check<Jacobi, InverseNumberType>("Jacobi", A, data, src, tolerance);
+
+  // a different order of the blocks
+  data.order.resize(1);
+  for (unsigned int i = 0; i < dim; ++i)
+    data.order[0].push_back(dim - 1 - i);
+  check<Jacobi, InverseNumberType>("Jacobi reordered", A, data, src, tolerance);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("double");
+  test<double>(1e-12);
+  deallog.pop();
+  deallog.push("float");
+  test<float>(1e-5);
+  deallog.pop();
+}
@@ -0,0 +1,98 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check SolverGMRES with a basis of more than 128 vectors and vectors that
+// are longer than one chunk of the fused orthogonalization kernels: The
+// classical Gram-Schmidt variants must give the same solution as the
+// modified Gram-Schmidt algorithm, for dealii::Vector and
+// LinearAlgebra::distributed::Vector
+
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename VectorType>
+void
+test(const SparseMatrix<double> &A)
+{
+  VectorType rhs(A.m()), reference(A.m());
+  for (unsigned int i = 0; i < A.m(); ++i)
+    rhs(i) = random_value<double>();
+
+  const std::array<LinearAlgebra::OrthogonalizationStrategy, 3> strategies = {
+    {LinearAlgebra::OrthogonalizationStrategy::modified_gram_schmidt,
+     LinearAlgebra::OrthogonalizationStrategy::classical_gram_schmidt,
+     LinearAlgebra::OrthogonalizationStrategy::delayed_classical_gram_schmidt}};
+
+  for (const auto strategy : strategies)
+    {
+      VectorType solution(A.m());
+
+      SolverControl control(1000, 1e-8 * rhs.l2_norm());
+      typename SolverGMRES<VectorType>::AdditionalData data;
+      data.max_basis_size             = 200;
+      data.orthogonalization_strategy = strategy;
+      SolverGMRES<VectorType> solver(control, data);
+      check_solver_within_range(
+        solver.solve(A, solution, rhs, PreconditionIdentity()),
+        control.last_step(),
+        150,
+        200);
+
+      if (strategy ==
+          LinearAlgebra::OrthogonalizationStrategy::modified_gram_schmidt)
+        reference = solution;
+      else
+        {
+          solution -= reference;
+          deallog << "Difference to modified Gram-Schmidt "
+                  << (solution.l2_norm() < 1e-6 * reference.l2_norm() ?
+                        "OK" :
+                        "FAILED")
+                  << std::endl;
+        }
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(3);
+
+  const unsigned int size = 101;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A, true);
+
+  test<Vector<double>>(A);
+  test<LinearAlgebra::distributed::Vector<double>>(A);
+}
@@ -0,0 +1,95 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Solve a Laplace problem to double accuracy with SolverIterativeRefinement
+// around an inner CG solver working on a SparseMatrix<float> and float
+// vectors, and check the application of SparseMatrix<float> to double
+// vectors
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_iterative_refinement.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename VectorType, typename InnerVectorType>
+void
+test(const SparseMatrix<double> &A, const SparseMatrix<float> &A_float)
+{
+  const unsigned int size = A.m();
+
+  VectorType x(size), b(size), r(size);
+  for (unsigned int i = 0; i < size; ++i)
+    b(i) = random_value<double>();
+
+  // the float matrix applied to double vectors
+  A.vmult(r, b);
+  A_float.vmult(x, b);
+  x -= r;
+  deallog << "Mixed-precision vmult "
+          << (x.l2_norm() < 1e-6 * r.l2_norm() ? "OK" : "FAILED")
+          << std::endl;
+  x = 0.;
+
+  ReductionControl          inner_control(100, 1e-30, 1e-3);
+  SolverCG<InnerVectorType> inner_solver(inner_control);
+
+  SolverControl                         control(100, 1e-10 * b.l2_norm());
+  SolverIterativeRefinement<VectorType> solver(control);
+  check_solver_within_range(
+    solver.solve(A, x, b, A_float, inner_solver, PreconditionIdentity()),
+    control.last_step(),
+    3,
+    6);
+
+  // the final residual is computed in double precision
+  A.vmult(r, x);
+  r -= b;
+  deallog << "Relative residual "
+          << (r.l2_norm() < 1e-10 * b.l2_norm() ? "OK" : "FAILED")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(4);
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+  SparseMatrix<float> A_float(structure);
+  A_float.copy_from(A);
+
+  test<Vector<double>, Vector<float>>(A, A_float);
+  test<LinearAlgebra::distributed::Vector<double>,
+       LinearAlgebra::distributed::Vector<float>>(A, A_float);
+}
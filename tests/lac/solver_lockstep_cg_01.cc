@@ -0,0 +1,128 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Solve a Laplace problem for several right hand sides with
+// SolverLockstepCG and compare with the solutions obtained by SolverCG for
+// each right hand side separately
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_lockstep_cg.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+// Apply a matrix or preconditioner to each block of a block vector
+template <typename OperatorType>
+class BlockDiagonalOperator
+{
+public:
+  BlockDiagonalOperator(const OperatorType &op)
+    : op(op)
+  {}
+
+  template <typename BlockVectorType>
+  void
+  vmult(BlockVectorType &dst, const BlockVectorType &src) const
+  {
+    for (unsigned int b = 0; b < src.n_blocks(); ++b)
+      op.vmult(dst.block(b), src.block(b));
+  }
+
+private:
+  const OperatorType &op;
+};
+
+
+
+template <typename BlockVectorType,
+          typename PreconditionerType,
+          typename BlockPreconditionerType>
+void
+test(const SparseMatrix<double>    &A,
+     const PreconditionerType      &preconditioner,
+     const BlockPreconditionerType &block_preconditioner)
+{
+  const unsigned int n_rhs = 5;
+  const unsigned int size  = A.m();
+
+  BlockVectorType x(n_rhs, size), b(n_rhs, size);
+  for (unsigned int i = 0; i < n_rhs; ++i)
+    for (unsigned int j = 0; j < size; ++j)
+      b.block(i)(j) = random_value<double>();
+  // one right hand side is zero
+  b.block(2) = 0.;
+
+  SolverControl                     control(200, 1e-10);
+  SolverLockstepCG<BlockVectorType> solver(control);
+  check_solver_within_range(
+    solver.solve(BlockDiagonalOperator(A), x, b, block_preconditioner),
+    control.last_step(),
+    100,
+    140);
+
+  using VectorType = typename BlockVectorType::BlockType;
+  for (unsigned int i = 0; i < n_rhs; ++i)
+    {
+      VectorType           reference(size);
+      SolverControl        control_ref(200, 1e-10);
+      SolverCG<VectorType> solver_ref(control_ref);
+      solver_ref.solve(A, reference, b.block(i), preconditioner);
+      VectorType difference(x.block(i));
+      difference -= reference;
+      deallog << "Block " << i << ": difference to SolverCG "
+              << (difference.l2_norm() <= 1e-8 * (1. + reference.l2_norm()) ?
+                    "OK" :
+                    "FAILED")
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(4);
+
+  const unsigned int size = 33;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+
+  PreconditionJacobi<SparseMatrix<double>> jacobi;
+  jacobi.initialize(A);
+
+  test<BlockVector<double>>(A,
+                            PreconditionIdentity(),
+                            PreconditionIdentity());
+  test<BlockVector<double>>(A, jacobi, BlockDiagonalOperator(jacobi));
+  test<LinearAlgebra::distributed::BlockVector<double>>(
+    A, PreconditionIdentity(), PreconditionIdentity());
+}
@@ -0,0 +1,132 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Solve a Laplace problem with SolverPipelinedCG and compare the solution and
+// the number of iterations with the ones of SolverCG, for the generic vector
+// implementation and the fused one of LinearAlgebra::distributed::Vector, and
+// for a matrix that runs the preconditioner within the matrix-vector product
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_overlapped_sparse_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_pipelined_cg.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+template <typename VectorType, typename MatrixType, typename PreconditionerType>
+void
+test(const MatrixType         &A,
+     const PreconditionerType &preconditioner,
+     const unsigned int        min_iterations,
+     const unsigned int        max_iterations)
+{
+  const unsigned int size = A.m();
+
+  VectorType x, x_ref, b;
+  if constexpr (std::is_same_v<
+                  MatrixType,
+                  LinearAlgebra::distributed::OverlappedSparseMatrix<double>>)
+    {
+      x.reinit(A.get_partitioner());
+      x_ref.reinit(A.get_partitioner());
+      b.reinit(A.get_partitioner());
+    }
+  else
+    {
+      x.reinit(size);
+      x_ref.reinit(size);
+      b.reinit(size);
+    }
+  for (unsigned int i = 0; i < size; ++i)
+    b(i) = random_value<double>();
+
+  SolverControl        control_ref(200, 1e-8 * b.l2_norm());
+  SolverCG<VectorType> solver_ref(control_ref);
+  solver_ref.solve(A, x_ref, b, preconditioner);
+
+  SolverControl                 control(200, 1e-8 * b.l2_norm());
+  SolverPipelinedCG<VectorType> solver(control);
+  check_solver_within_range(solver.solve(A, x, b, preconditioner),
+                            control.last_step(),
+                            min_iterations,
+                            max_iterations);
+
+  deallog << "Iterations compared to CG "
+          << (control.last_step() <= control_ref.last_step() + 2 ? "OK" :
+                                                                  "FAILED")
+          << std::endl;
+
+  x -= x_ref;
+  deallog << "Difference to CG solution "
+          << (x.l2_norm() < 1e-6 * x_ref.l2_norm() ? "OK" : "FAILED")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(4);
+
+  const unsigned int size = 65;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+
+  PreconditionJacobi<SparseMatrix<double>> jacobi;
+  jacobi.initialize(A);
+
+  test<Vector<double>>(A, PreconditionIdentity(), 185, 205);
+  test<Vector<double>>(A, jacobi, 185, 205);
+  test<LinearAlgebra::distributed::Vector<double>>(A,
+                                                   PreconditionIdentity(),
+                                                   185,
+                                                   205);
+
+  // the preconditioner is applied within the matrix-vector product of
+  // OverlappedSparseMatrix through DiagonalMatrix::apply()
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(complete_index_set(dim),
+                                                  MPI_COMM_SELF);
+  LinearAlgebra::distributed::OverlappedSparseMatrix<double> A_overlapped;
+  A_overlapped.reinit(partitioner, A);
+  LinearAlgebra::distributed::Vector<double> inverse_diagonal(partitioner);
+  for (unsigned int i = 0; i < dim; ++i)
+    inverse_diagonal(i) = 1. / A.diag_element(i);
+  DiagonalMatrix<LinearAlgebra::distributed::Vector<double>> diagonal(
+    inverse_diagonal);
+  test<LinearAlgebra::distributed::Vector<double>>(A_overlapped,
+                                                   diagonal,
+                                                   185,
+                                                   205);
+}
@@ -0,0 +1,179 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that the level-scheduled variants of SparseILU, PreconditionSOR and
+// PreconditionSSOR give exactly the same results as the sequential ones, for
+// a five-point stencil with red-black numbering (two levels) and with a
+// random numbering
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sparse_ilu.h>
+#include <deal.II/lac/sparse_level_schedule.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <algorithm>
+
+#include "../tests.h"
+
+
+void
+compare(const std::string    &name,
+        const Vector<double> &result,
+        const Vector<double> &reference)
+{
+  Vector<double> difference(result);
+  difference -= reference;
+  deallog << name << ": " << (difference.linfty_norm() == 0. ? "OK" : "FAILED")
+          << std::endl;
+}
+
+
+
+void
+test(const unsigned int n, const std::vector<unsigned int> &numbering)
+{
+  const unsigned int N = n * n;
+
+  DynamicSparsityPattern dsp(N, N);
+  for (unsigned int i = 0; i < n; ++i)
+    for (unsigned int j = 0; j < n; ++j)
+      {
+        const unsigned int row = numbering[i * n + j];
+        dsp.add(row, row);
+        if (i > 0)
+          dsp.add(row, numbering[(i - 1) * n + j]);
+        if (i < n - 1)
+          dsp.add(row, numbering[(i + 1) * n + j]);
+        if (j > 0)
+          dsp.add(row, numbering[i * n + j - 1]);
+        if (j < n - 1)
+          dsp.add(row, numbering[i * n + j + 1]);
+      }
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  // a non-symmetric matrix with dominant diagonal
+  SparseMatrix<double> A(sparsity);
+  for (unsigned int row = 0; row < N; ++row)
+    for (auto entry = A.begin(row); entry != A.end(row); ++entry)
+      entry->value() = (entry->column() == row) ? 5. : -random_value<double>();
+
+  SparseLevelSchedule schedule;
+  schedule.initialize(sparsity, 1);
+  deallog << "Forward levels: " << schedule.n_forward_levels()
+          << ", backward levels: " << schedule.n_backward_levels()
+          << std::endl;
+
+  // check that the levels respect the dependencies
+  std::vector<unsigned int> level_of_row(N);
+  for (unsigned int l = 0; l < schedule.n_forward_levels(); ++l)
+    for (const auto row : schedule.forward_level(l))
+      level_of_row[row] = l;
+  for (unsigned int row = 0; row < N; ++row)
+    for (auto entry = sparsity.begin(row); entry != sparsity.end(row); ++entry)
+      if (entry->column() < row)
+        AssertThrow(level_of_row[entry->column()] < level_of_row[row],
+                    ExcInternalError());
+  for (unsigned int l = 0; l < schedule.n_backward_levels(); ++l)
+    for (const auto row : schedule.backward_level(l))
+      level_of_row[row] = l;
+  for (unsigned int row = 0; row < N; ++row)
+    for (auto entry = sparsity.begin(row); entry != sparsity.end(row); ++entry)
+      if (entry->column() > row)
+        AssertThrow(level_of_row[entry->column()] < level_of_row[row],
+                    ExcInternalError());
+
+  Vector<double> src(N), dst(N), ref(N);
+  for (unsigned int i = 0; i < N; ++i)
+    src(i) = random_value<double>();
+
+  // SOR and TSOR
+  {
+    PreconditionSOR<SparseMatrix<double>>                 sor;
+    PreconditionSOR<SparseMatrix<double>>::AdditionalData data(1.2);
+    data.use_level_scheduling = true;
+    sor.initialize(A, data);
+
+    A.precondition_SOR(ref, src, 1.2);
+    sor.vmult(dst, src);
+    compare("SOR", dst, ref);
+
+    A.precondition_TSOR(ref, src, 1.2);
+    sor.Tvmult(dst, src);
+    compare("TSOR", dst, ref);
+  }
+
+  // SSOR, where the sequential reference needs to use the same positions
+  // right of the diagonal as the preconditioner
+  {
+    PreconditionSSOR<SparseMatrix<double>> ssor_sequential;
+    ssor_sequential.initialize(A, 1.2);
+    ssor_sequential.vmult(ref, src);
+
+    PreconditionSSOR<SparseMatrix<double>>                 ssor;
+    PreconditionSSOR<SparseMatrix<double>>::AdditionalData data(1.2);
+    data.use_level_scheduling = true;
+    ssor.initialize(A, data);
+    ssor.vmult(dst, src);
+    compare("SSOR", dst, ref);
+  }
+
+  // ILU
+  {
+    SparseILU<double> ilu_sequential;
+    ilu_sequential.initialize(A);
+    ilu_sequential.vmult(ref, src);
+
+    SparseILU<double>                 ilu;
+    SparseILU<double>::AdditionalData data;
+    data.use_level_scheduling = true;
+    ilu.initialize(A, data);
+    ilu.vmult(dst, src);
+    compare("ILU", dst, ref);
+  }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int n = 80;
+
+  // red-black numbering
+  {
+    std::vector<unsigned int> numbering(n * n);
+    unsigned int              red = 0, black = (n * n + 1) / 2;
+    for (unsigned int i = 0; i < n; ++i)
+      for (unsigned int j = 0; j < n; ++j)
+        numbering[i * n + j] = ((i + j) % 2 == 0) ? red++ : black++;
+    test(n, numbering);
+  }
+
+  // random numbering
+  {
+    std::vector<unsigned int> numbering(n * n);
+    for (unsigned int i = 0; i < n * n; ++i)
+      numbering[i] = i;
+    for (unsigned int i = n * n - 1; i > 0; --i)
+      std::swap(numbering[i], numbering[Testing::rand() % (i + 1)]);
+    test(n, numbering);
+  }
+}
@@ -0,0 +1,200 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check SparseMatrixBSR against a SparseMatrix with the same entries:
+// assembly through AffineConstraints, matrix-vector products, and the block
+// preconditioners
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_ilu.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix_bsr.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <array>
+
+#include "../tests.h"
+
+
+void
+test(const unsigned int block_size)
+{
+  deallog << "Block size " << block_size << std::endl;
+
+  // a periodic chain of blocks where elements connect each block with the
+  // next block and with the block at a distance of five, which leads to
+  // fill-in that an ILU(0) decomposition drops
+  const unsigned int                      n_blocks = 12;
+  std::vector<std::array<unsigned int, 2>> elements;
+  for (unsigned int i = 0; i < n_blocks; ++i)
+    {
+      elements.push_back({{i, (i + 1) % n_blocks}});
+      elements.push_back({{i, (i + 5) % n_blocks}});
+    }
+
+  // one degree of freedom is constrained to a degree of freedom in the next
+  // block and one is eliminated; the pattern of the blocks is condensed
+  // with the respective constraint between the blocks
+  AffineConstraints<double> constraints;
+  constraints.add_line(block_size);
+  constraints.add_entry(block_size, 2 * block_size, 0.5);
+  constraints.add_line(n_blocks * block_size - 1);
+  constraints.close();
+  AffineConstraints<double> block_constraints;
+  block_constraints.add_line(1);
+  block_constraints.add_entry(1, 2, 1.);
+  block_constraints.close();
+
+  DynamicSparsityPattern block_dsp(n_blocks, n_blocks);
+  for (const auto &element : elements)
+    for (const unsigned int i : element)
+      for (const unsigned int j : element)
+        block_dsp.add(i, j);
+  block_constraints.condense(block_dsp);
+  for (unsigned int i = 0; i < n_blocks; ++i)
+    block_dsp.add(i, i);
+
+  DynamicSparsityPattern dsp(n_blocks * block_size, n_blocks * block_size);
+  for (unsigned int i = 0; i < n_blocks; ++i)
+    for (auto entry = block_dsp.begin(i); entry != block_dsp.end(i); ++entry)
+      for (unsigned int r = 0; r < block_size; ++r)
+        for (unsigned int c = 0; c < block_size; ++c)
+          dsp.add(i * block_size + r, entry->column() * block_size + c);
+
+  SparsityPattern block_sparsity, sparsity;
+  block_sparsity.copy_from(block_dsp);
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<double>    matrix(sparsity);
+  SparseMatrixBSR<double> matrix_bsr(block_sparsity, block_size);
+  deallog << "Stored blocks: " << matrix_bsr.n_nonzero_blocks()
+          << ", entries: " << matrix_bsr.n_nonzero_elements() << " of "
+          << matrix.n_nonzero_elements() << std::endl;
+
+  // assemble symmetric positive definite element matrices
+  FullMatrix<double> cell_matrix(2 * block_size, 2 * block_size);
+  std::vector<types::global_dof_index> dof_indices(2 * block_size);
+  for (unsigned int e = 0; e < elements.size(); ++e)
+    {
+      for (unsigned int i = 0; i < 2 * block_size; ++i)
+        {
+          dof_indices[i] =
+            elements[e][i / block_size] * block_size + i % block_size;
+          for (unsigned int j = 0; j < 2 * block_size; ++j)
+            cell_matrix(i, j) =
+              (i == j ? 4. * block_size : 0.) -
+              1. / (1. + i + j + (e % 3) + (i / block_size != j / block_size));
+        }
+      constraints.distribute_local_to_global(cell_matrix, dof_indices, matrix);
+      constraints.distribute_local_to_global(cell_matrix,
+                                             dof_indices,
+                                             matrix_bsr);
+    }
+
+  double error = 0.;
+  for (unsigned int i = 0; i < matrix.m(); ++i)
+    for (unsigned int j = 0; j < matrix.n(); ++j)
+      error = std::max(error, std::abs(matrix.el(i, j) - matrix_bsr.el(i, j)));
+  deallog << "Difference after assembly: " << error << std::endl;
+
+  Vector<double> src(matrix.n()), dst(matrix.m()), dst_bsr(matrix.m());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  matrix.vmult(dst, src);
+  matrix_bsr.vmult(dst_bsr, src);
+  dst_bsr -= dst;
+  deallog << "vmult error: "
+          << filter_out_small_numbers(dst_bsr.l2_norm(), 1e-12) << std::endl;
+
+  matrix.vmult_add(dst, src);
+  matrix_bsr.vmult(dst_bsr, src);
+  matrix_bsr.vmult_add(dst_bsr, src);
+  dst_bsr -= dst;
+  deallog << "vmult_add error: "
+          << filter_out_small_numbers(dst_bsr.l2_norm(), 1e-12) << std::endl;
+
+  matrix.Tvmult(dst, src);
+  matrix_bsr.Tvmult(dst_bsr, src);
+  dst_bsr -= dst;
+  deallog << "Tvmult error: "
+          << filter_out_small_numbers(dst_bsr.l2_norm(), 1e-12) << std::endl;
+
+  const double residual     = matrix.residual(dst, src, dst_bsr);
+  const double residual_bsr = matrix_bsr.residual(dst_bsr, src, dst_bsr);
+  deallog << "residual error: "
+          << filter_out_small_numbers(std::abs(residual - residual_bsr), 1e-12)
+          << std::endl;
+
+  // copy_from() gives the same matrix
+  SparseMatrixBSR<double> matrix_copy(block_sparsity, block_size);
+  matrix_copy.copy_from(matrix);
+  matrix_copy.vmult(dst_bsr, src);
+  matrix.vmult(dst, src);
+  dst_bsr -= dst;
+  deallog << "copy_from error: "
+          << filter_out_small_numbers(dst_bsr.l2_norm(), 1e-12) << std::endl;
+
+  // solve with the block preconditioners
+  Vector<double> solution(matrix.m());
+  {
+    SparseBlockJacobi<double> jacobi;
+    jacobi.initialize(matrix_bsr);
+    SolverControl            control(200, 1e-10 * src.l2_norm());
+    SolverCG<Vector<double>> solver(control);
+    solver.solve(matrix_bsr, solution, src, jacobi);
+    deallog << "CG with block Jacobi: " << control.last_step()
+            << " iterations" << std::endl;
+  }
+  {
+    SparseBlockILU<double> ilu;
+    ilu.initialize(matrix_bsr);
+    SolverControl            control(200, 1e-10 * src.l2_norm());
+    SolverCG<Vector<double>> solver(control);
+    solution = 0;
+    solver.solve(matrix_bsr, solution, src, ilu);
+    deallog << "CG with block ILU: " << control.last_step() << " iterations"
+            << std::endl;
+
+    // for blocks of size one, the block ILU is the same as SparseILU
+    if (block_size == 1)
+      {
+        SparseILU<double> scalar_ilu;
+        scalar_ilu.initialize(matrix);
+        scalar_ilu.vmult(dst, src);
+        ilu.vmult(dst_bsr, src);
+        dst_bsr -= dst;
+        deallog << "Difference to SparseILU: "
+                << filter_out_small_numbers(dst_bsr.l2_norm(), 1e-12)
+                << std::endl;
+      }
+  }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (const unsigned int block_size : {1, 2, 3, 5})
+    test(block_size);
+}
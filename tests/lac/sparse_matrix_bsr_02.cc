@@ -0,0 +1,208 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check SparseMatrixBSR on the route described in its documentation: the
+// block pattern comes from a DoFHandler with a scalar FE_Q element, the
+// matrix is assembled with an FESystem of FE_Q elements renumbered by
+// DoFRenumbering::support_point_wise() and with hanging node constraints,
+// and the result is compared with a SparseMatrix assembled the usual way,
+// for all block sizes with specialized kernels
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix_bsr.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const unsigned int degree, const unsigned int n_components)
+{
+  deallog << "dim = " << dim << ", degree = " << degree
+          << ", components = " << n_components << std::endl;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_scalar(tria);
+  dof_scalar.distribute_dofs(FE_Q<dim>(degree));
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(FESystem<dim>(FE_Q<dim>(degree), n_components));
+  DoFRenumbering::support_point_wise(dof);
+
+  // the degrees of freedom at the k-th support point of the scalar
+  // DoFHandler must be the ones with indices k * n_components + c
+  {
+    const auto points_scalar =
+      DoFTools::map_dofs_to_support_points(MappingQ1<dim>(), dof_scalar);
+    const auto points =
+      DoFTools::map_dofs_to_support_points(MappingQ1<dim>(), dof);
+    bool matches = points.size() == n_components * points_scalar.size();
+    for (unsigned int i = 0; i < points.size() && matches; ++i)
+      matches =
+        points.at(i).distance(points_scalar.at(i / n_components)) < 1e-12;
+    deallog << "Numbering matches: " << matches << std::endl;
+  }
+
+  AffineConstraints<double> constraints_scalar, constraints;
+  DoFTools::make_hanging_node_constraints(dof_scalar, constraints_scalar);
+  constraints_scalar.close();
+  DoFTools::make_hanging_node_constraints(dof, constraints);
+  constraints.close();
+  deallog << "Constrained dofs: " << constraints.n_constraints() << std::endl;
+
+  DynamicSparsityPattern dsp_scalar(dof_scalar.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_scalar,
+                                  dsp_scalar,
+                                  constraints_scalar,
+                                  false);
+  SparsityPattern block_sparsity;
+  block_sparsity.copy_from(dsp_scalar);
+
+  DynamicSparsityPattern dsp(dof.n_dofs());
+  DoFTools::make_sparsity_pattern(dof, dsp, constraints, false);
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<double>    matrix(sparsity);
+  SparseMatrixBSR<double> matrix_bsr(block_sparsity, n_components);
+
+  // a vector Laplacian with a coupling between the components through the
+  // divergence and a mass term
+  const QGauss<dim>  quadrature(degree + 1);
+  FEValues<dim>      fe_values(dof.get_fe(),
+                               quadrature,
+                               update_values | update_gradients |
+                                 update_JxW_values);
+  const unsigned int dofs_per_cell = dof.get_fe().n_dofs_per_cell();
+  FullMatrix<double> cell_matrix(dofs_per_cell, dofs_per_cell);
+  std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+  for (const auto &cell : dof.active_cell_iterators())
+    {
+      fe_values.reinit(cell);
+      cell_matrix = 0;
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        for (unsigned int j = 0; j < dofs_per_cell; ++j)
+          {
+            const unsigned int ci =
+              dof.get_fe().system_to_component_index(i).first;
+            const unsigned int cj =
+              dof.get_fe().system_to_component_index(j).first;
+            for (const unsigned int q : fe_values.quadrature_point_indices())
+              {
+                double value = fe_values.shape_grad(i, q)[ci % dim] *
+                               fe_values.shape_grad(j, q)[cj % dim];
+                if (ci == cj)
+                  value += fe_values.shape_grad(i, q) *
+                             fe_values.shape_grad(j, q) +
+                           fe_values.shape_value(i, q) *
+                             fe_values.shape_value(j, q);
+                cell_matrix(i, j) += value * fe_values.JxW(q);
+              }
+          }
+      cell->get_dof_indices(dof_indices);
+      constraints.distribute_local_to_global(cell_matrix, dof_indices, matrix);
+      constraints.distribute_local_to_global(cell_matrix,
+                                             dof_indices,
+                                             matrix_bsr);
+    }
+
+  double error = 0.;
+  for (unsigned int i = 0; i < matrix.m(); ++i)
+    for (auto entry = matrix.begin(i); entry != matrix.end(i); ++entry)
+      error = std::max(error,
+                       std::abs(entry->value() -
+                                matrix_bsr.el(i, entry->column())));
+  deallog << "Difference after assembly: "
+          << filter_out_small_numbers(error, 1e-12) << std::endl;
+
+  Vector<double> src(dof.n_dofs()), dst(dof.n_dofs()), dst_bsr(dof.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+  constraints.set_zero(src);
+
+  matrix.vmult(dst, src);
+  matrix_bsr.vmult(dst_bsr, src);
+  dst_bsr -= dst;
+  deallog << "vmult error: "
+          << filter_out_small_numbers(dst_bsr.l2_norm(), 1e-12) << std::endl;
+
+  // the block Jacobi preconditioner must apply the inverses of the diagonal
+  // blocks of the matrix
+  SparseBlockJacobi<double> jacobi;
+  jacobi.initialize(matrix_bsr);
+  jacobi.vmult(dst_bsr, src);
+  FullMatrix<double> block(n_components, n_components);
+  Vector<double>     block_src(n_components), block_dst(n_components);
+  for (unsigned int k = 0; k < dof_scalar.n_dofs(); ++k)
+    {
+      for (unsigned int r = 0; r < n_components; ++r)
+        {
+          for (unsigned int c = 0; c < n_components; ++c)
+            block(r, c) = matrix.el(k * n_components + r, k * n_components + c);
+          block_src(r) = src(k * n_components + r);
+        }
+      block.gauss_jordan();
+      block.vmult(block_dst, block_src);
+      for (unsigned int r = 0; r < n_components; ++r)
+        dst(k * n_components + r) = block_dst(r);
+    }
+  dst_bsr -= dst;
+  deallog << "Block Jacobi error: "
+          << filter_out_small_numbers(dst_bsr.l2_norm(), 1e-12) << std::endl;
+
+  Vector<double> solution(dof.n_dofs());
+  SolverControl  control(500, 1e-10 * src.l2_norm());
+  SolverCG<Vector<double>> solver(control);
+  solver.solve(matrix_bsr, solution, src, jacobi);
+  constraints.distribute(solution);
+  deallog << "CG with block Jacobi: " << control.last_step() << " iterations"
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(2, 1);
+  test<2>(2, 2);
+  test<3>(1, 3);
+  test<2>(1, 4);
+}
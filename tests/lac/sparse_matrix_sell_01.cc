@@ -0,0 +1,134 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check SparseMatrixSELL::vmult, vmult_add, Tvmult, Tvmult_add and residual
+// against SparseMatrix for a rectangular matrix with rows of varying length
+// and different sorting windows
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix_sell.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <typename number2>
+void
+check_difference(const std::string     &name,
+                 const Vector<number2> &result,
+                 const Vector<number2> &reference,
+                 const double           tolerance)
+{
+  Vector<number2> difference(result);
+  difference -= reference;
+  deallog << name << ": "
+          << (difference.linfty_norm() <= tolerance * reference.linfty_norm() ?
+                "OK" :
+                "FAILED")
+          << std::endl;
+}
+
+
+
+template <typename number, typename number2>
+void
+test(const unsigned int m, const unsigned int n, const unsigned int sigma)
+{
+  deallog << "m=" << m << " n=" << n << " sigma=" << sigma << std::endl;
+
+  const double tolerance =
+    std::is_same_v<number, float> || std::is_same_v<number2, float> ? 1e-5 :
+                                                                      1e-12;
+
+  DynamicSparsityPattern dsp(m, n);
+  for (unsigned int i = 0; i < m; ++i)
+    {
+      // every fifth row is empty, the others get between 1 and 12 entries
+      if (i % 5 == 3)
+        continue;
+      const unsigned int row_length = 1 + Testing::rand() % 12;
+      for (unsigned int k = 0; k < row_length; ++k)
+        dsp.add(i, Testing::rand() % n);
+    }
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<number> A(sparsity);
+  for (auto entry = A.begin(); entry != A.end(); ++entry)
+    entry->value() = random_value<number>();
+
+  typename SparseMatrixSELL<number>::AdditionalData data(sigma);
+  SparseMatrixSELL<number>                          B(A, data);
+  deallog << "n_nonzero_elements: " << B.n_nonzero_elements() << std::endl;
+  AssertThrow(B.n_stored_elements() >= B.n_nonzero_elements(),
+              ExcInternalError());
+
+  Vector<number2> src(n), dst(m), ref(m), rhs(m);
+  for (unsigned int i = 0; i < n; ++i)
+    src(i) = random_value<number2>();
+  for (unsigned int i = 0; i < m; ++i)
+    rhs(i) = random_value<number2>();
+
+  A.vmult(ref, src);
+  B.vmult(dst, src);
+  check_difference("vmult", dst, ref, tolerance);
+
+  A.vmult_add(ref, src);
+  B.vmult_add(dst, src);
+  check_difference("vmult_add", dst, ref, tolerance);
+
+  const double ref_norm = A.residual(ref, src, rhs);
+  const double norm     = B.residual(dst, src, rhs);
+  check_difference("residual", dst, ref, tolerance);
+  AssertThrow(std::abs(norm - ref_norm) <= tolerance * ref_norm,
+              ExcInternalError());
+
+  Vector<number2> tsrc(m), tdst(n), tref(n);
+  for (unsigned int i = 0; i < m; ++i)
+    tsrc(i) = random_value<number2>();
+
+  A.Tvmult(tref, tsrc);
+  B.Tvmult(tdst, tsrc);
+  check_difference("Tvmult", tdst, tref, tolerance);
+
+  A.Tvmult_add(tref, tsrc);
+  B.Tvmult_add(tdst, tsrc);
+  check_difference("Tvmult_add", tdst, tref, tolerance);
+
+  // change the values of the matrix and refresh B keeping the layout
+  for (auto entry = A.begin(); entry != A.end(); ++entry)
+    entry->value() *= number(2.);
+  B.copy_from(A);
+  A.vmult(ref, src);
+  B.vmult(dst, src);
+  check_difference("vmult after copy_from", dst, ref, tolerance);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<double, double>(1, 1, 1);
+  test<double, double>(100, 80, 1);
+  test<double, double>(101, 130, 16);
+  test<double, double>(333, 333, numbers::invalid_unsigned_int);
+  test<float, float>(257, 200, 32);
+  test<float, double>(131, 131, 8);
+}
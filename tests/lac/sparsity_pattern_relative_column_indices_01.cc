@@ -0,0 +1,132 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check SparsityPattern::compute_relative_column_indices(): the results of
+// SparseMatrix::vmult, vmult_add, residual and SparseILU::vmult must be the
+// same as with the full column indices, and the relative indices must be
+// removed when the sparsity pattern is changed
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_ilu.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+void
+compare(const std::string    &name,
+        const Vector<double> &result,
+        const Vector<double> &reference)
+{
+  Vector<double> difference(result);
+  difference -= reference;
+  deallog << name << ": " << (difference.linfty_norm() == 0. ? "OK" : "FAILED")
+          << std::endl;
+}
+
+
+
+void
+test(const unsigned int m, const unsigned int n)
+{
+  deallog << "m=" << m << " n=" << n << std::endl;
+
+  DynamicSparsityPattern dsp(m, n);
+  for (unsigned int i = 0; i < m; ++i)
+    {
+      if (i < n)
+        dsp.add(i, i);
+      for (unsigned int k = 0; k < 6; ++k)
+        dsp.add(i, Testing::rand() % n);
+    }
+  SparsityPattern sparsity;
+  sparsity.copy_from(dsp);
+
+  SparseMatrix<double> A(sparsity);
+  for (unsigned int row = 0; row < m; ++row)
+    for (auto entry = A.begin(row); entry != A.end(row); ++entry)
+      entry->value() = (entry->column() == row) ? 10. : -random_value<double>();
+
+  Vector<double> src(n), rhs(m), ref(m), ref_add(m), ref_res(m), dst(m);
+  for (unsigned int i = 0; i < n; ++i)
+    src(i) = random_value<double>();
+  for (unsigned int i = 0; i < m; ++i)
+    rhs(i) = random_value<double>();
+
+  // results with the full column indices
+  A.vmult(ref, src);
+  ref_add = rhs;
+  A.vmult_add(ref_add, src);
+  const double ref_norm = A.residual(ref_res, src, rhs);
+
+  sparsity.compute_relative_column_indices();
+  deallog << "has relative column indices: "
+          << sparsity.has_relative_column_indices() << std::endl;
+
+  A.vmult(dst, src);
+  compare("vmult", dst, ref);
+  dst = rhs;
+  A.vmult_add(dst, src);
+  compare("vmult_add", dst, ref_add);
+  const double norm = A.residual(dst, src, rhs);
+  compare("residual", dst, ref_res);
+  AssertThrow(norm == ref_norm, ExcInternalError());
+
+  // SparseILU on the same and on an extended sparsity pattern, which gets
+  // relative column indices as well
+  if (m == n)
+    for (unsigned int extra_off_diagonals = 0; extra_off_diagonals < 2;
+         ++extra_off_diagonals)
+      {
+        const SparseILU<double>::AdditionalData data_extended(
+          0., extra_off_diagonals);
+
+        sparsity.compute_relative_column_indices();
+        SparseILU<double> ilu_relative;
+        ilu_relative.initialize(A, data_extended);
+        Vector<double> ilu_dst(m), ilu_ref(m);
+        ilu_relative.vmult(ilu_dst, rhs);
+
+        // rebuild the pattern without relative column indices
+        SparsityPattern sparsity_full;
+        sparsity_full.copy_from(sparsity);
+        SparseMatrix<double> A_full(sparsity_full);
+        A_full.copy_from(A);
+        SparseILU<double> ilu_full;
+        ilu_full.initialize(A_full, data_extended);
+        ilu_full.vmult(ilu_ref, rhs);
+        deallog << "extra off-diagonals: " << extra_off_diagonals << std::endl;
+        compare("ILU vmult", ilu_dst, ilu_ref);
+      }
+
+  // changing the sparsity pattern removes the relative column indices
+  sparsity.copy_from(dsp);
+  deallog << "has relative column indices after copy_from: "
+          << sparsity.has_relative_column_indices() << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test(200, 200);
+  test(97, 231);
+  test(150, 40);
+}
@@ -0,0 +1,143 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Fill a ThreadLocalSparsityPattern from several tasks through
+// AffineConstraints::add_entries_local_to_global() and check that the
+// SparsityPattern copied from it is the same as the one obtained from a
+// DynamicSparsityPattern filled serially. The "mesh" is a chain of cells
+// with three unknowns each, where neighboring cells share one unknown.
+
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/thread_local_sparsity_pattern.h>
+
+#include <thread>
+
+#include "../tests.h"
+
+
+void
+check_equal(const SparsityPattern &sp1, const SparsityPattern &sp2)
+{
+  bool equal = (sp1.n_rows() == sp2.n_rows()) &&
+               (sp1.n_cols() == sp2.n_cols()) &&
+               (sp1.n_nonzero_elements() == sp2.n_nonzero_elements());
+  for (unsigned int row = 0; equal && row < sp1.n_rows(); ++row)
+    {
+      equal = equal && (sp1.row_length(row) == sp2.row_length(row));
+      for (unsigned int k = 0; equal && k < sp1.row_length(row); ++k)
+        equal = (sp1.column_number(row, k) == sp2.column_number(row, k));
+    }
+  deallog << "Rows: " << sp1.n_rows() << ", columns: " << sp1.n_cols()
+          << ", nonzeros: " << sp1.n_nonzero_elements()
+          << (equal ? ", equal" : ", DIFFERENT") << std::endl;
+}
+
+
+
+void
+test(const unsigned int n_cells, const bool keep_constrained_dofs)
+{
+  const unsigned int n_dofs = 2 * n_cells + 1;
+
+  AffineConstraints<double> constraints;
+  for (unsigned int i = 5; i + 1 < n_dofs; i += 17)
+    {
+      constraints.add_line(i);
+      constraints.add_entry(i, i - 1, 0.5);
+      constraints.add_entry(i, i + 1, 0.5);
+    }
+  constraints.add_line(n_dofs - 1);
+  constraints.add_entry(n_dofs - 1, 0, 1.);
+  constraints.close();
+
+  const auto cell_dofs = [](const unsigned int c) {
+    return std::vector<types::global_dof_index>{2 * c, 2 * c + 1, 2 * c + 2};
+  };
+
+  DynamicSparsityPattern dsp(n_dofs, n_dofs);
+  for (unsigned int c = 0; c < n_cells; ++c)
+    constraints.add_entries_local_to_global(cell_dofs(c),
+                                            dsp,
+                                            keep_constrained_dofs);
+  SparsityPattern sp_ref;
+  sp_ref.copy_from(dsp);
+
+  ThreadLocalSparsityPattern tlsp(n_dofs, n_dofs);
+  parallel::apply_to_subranges(
+    0U,
+    n_cells,
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int c = begin; c < end; ++c)
+        constraints.add_entries_local_to_global(cell_dofs(c),
+                                                tlsp,
+                                                keep_constrained_dofs);
+    },
+    16);
+  tlsp.compress();
+  SparsityPattern sp;
+  sp.copy_from(tlsp);
+
+  check_equal(sp, sp_ref);
+}
+
+
+
+void
+test_rectangular()
+{
+  DynamicSparsityPattern     dsp(50, 70);
+  ThreadLocalSparsityPattern tlsp(50, 70);
+  for (unsigned int i = 0; i < 50; ++i)
+    for (unsigned int j = 0; j < 70; ++j)
+      if ((i * 7 + j * 3) % 11 == 0)
+        dsp.add(i, j);
+  // use explicit threads with overlapping column ranges, so that several
+  // buffers contain the same entries
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < 4; ++t)
+    threads.emplace_back([&tlsp, t]() {
+      for (unsigned int j = 15 * t; j < std::min(15 * t + 25, 70U); ++j)
+        for (unsigned int i = 0; i < 50; ++i)
+          if ((i * 7 + j * 3) % 11 == 0)
+            tlsp.add(i, j);
+    });
+  for (auto &thread : threads)
+    thread.join();
+  tlsp.compress();
+  deallog << "Number of buffers: " << tlsp.n_buffers() << std::endl;
+
+  SparsityPattern sp, sp_ref;
+  sp_ref.copy_from(dsp);
+  sp.copy_from(tlsp);
+  check_equal(sp, sp_ref);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test(100, true);
+  test(100, false);
+  test(20000, true);
+  test_rectangular();
+}
@@ -0,0 +1,107 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check that GrowingVectorMemory::alloc_like() returns vectors with the
+// layout of the model vector, prefers unused vectors of matching layout, and
+// records hits and misses in the statistics of the pool.
+
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/lac/vector_memory.h>
+
+#include "../tests.h"
+
+
+
+template <typename VectorType>
+void
+print_statistics()
+{
+  const auto statistics = GrowingVectorMemory<VectorType>::get_statistics();
+  deallog << "hits: " << statistics.n_hits
+          << ", misses: " << statistics.n_misses
+          << ", vectors: " << statistics.n_vectors << ", peak >= memory: "
+          << (statistics.peak_memory >= statistics.memory &&
+              statistics.memory > 0)
+          << std::endl;
+}
+
+
+
+template <typename VectorType>
+void
+test(const VectorType &coarse, const VectorType &fine)
+{
+  GrowingVectorMemory<VectorType>::reset_statistics();
+
+  GrowingVectorMemory<VectorType> memory;
+
+  // simulate an outer solver on the fine level with an inner solver on the
+  // coarse level, called several times
+  typename VectorMemory<VectorType>::Pointer outer(memory, fine);
+  deallog << "outer size: " << outer->size()
+          << ", norm: " << outer->l2_norm() << std::endl;
+
+  const VectorType *previous = nullptr;
+  for (unsigned int i = 0; i < 3; ++i)
+    {
+      typename VectorMemory<VectorType>::Pointer inner_1(memory, coarse);
+      typename VectorMemory<VectorType>::Pointer inner_2(memory, coarse, true);
+      deallog << "inner sizes: " << inner_1->size() << ' ' << inner_2->size()
+              << ", norm: " << inner_1->l2_norm() << std::endl;
+      if (previous != nullptr)
+        deallog << "reused vector: "
+                << (previous == inner_1.get() || previous == inner_2.get())
+                << std::endl;
+      previous = inner_1.get();
+
+      *inner_1 = 1.;
+      typename VectorMemory<VectorType>::Pointer fine_tmp(memory, fine);
+      deallog << "fine size: " << fine_tmp->size() << std::endl;
+    }
+  print_statistics<VectorType>();
+
+  // after releasing all vectors, a new request for the coarse layout is
+  // again served by one of the existing vectors
+  outer.reset();
+  typename VectorMemory<VectorType>::Pointer last(memory, coarse);
+  deallog << "last size: " << last->size() << ", norm: " << last->l2_norm()
+          << std::endl;
+  print_statistics<VectorType>();
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  {
+    deallog.push("Vector");
+    test(Vector<double>(7), Vector<double>(25));
+    deallog.pop();
+  }
+
+  {
+    deallog.push("LA::distributed::Vector");
+    LinearAlgebra::distributed::Vector<double> coarse(7), fine(25);
+    test(coarse, fine);
+    deallog.pop();
+  }
+}
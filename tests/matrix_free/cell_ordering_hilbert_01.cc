@@ -0,0 +1,175 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check MatrixFree::AdditionalData::order_cells_along_hilbert_curve on a mesh
+// whose coarse cells are given in scrambled order: all cells must still be
+// visited exactly once, consecutive cell batches must be closer to each other
+// and, combined with DoFRenumbering::matrix_free_data_locality, the cell
+// batches must access a narrower range of vector entries.
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include <set>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+create_scrambled_mesh(Triangulation<dim> &tria)
+{
+  Triangulation<dim> tria_in_order;
+  GridGenerator::subdivided_hyper_cube(tria_in_order, dim == 2 ? 16 : 8);
+
+  std::vector<CellData<dim>> cells(tria_in_order.n_active_cells());
+  for (const auto &cell : tria_in_order.active_cell_iterators())
+    {
+      // permutation of the coarse cells by a multiplicative hash
+      const unsigned int index =
+        (cell->active_cell_index() * 37) % tria_in_order.n_active_cells();
+      cells[index].vertices.resize(cell->n_vertices());
+      for (const unsigned int v : cell->vertex_indices())
+        cells[index].vertices[v] = cell->vertex_index(v);
+    }
+  tria.create_triangulation(tria_in_order.get_vertices(), cells, SubCellData());
+}
+
+
+
+template <int dim>
+void
+test(const unsigned int level)
+{
+  using MatrixFreeType = MatrixFree<dim, double, VectorizedArray<double, 1>>;
+
+  Triangulation<dim> tria(
+    Triangulation<dim>::limit_level_difference_at_vertices);
+  create_scrambled_mesh(tria);
+  tria.refine_global(1);
+
+  FE_Q<dim> fe(2);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFreeType::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFreeType::AdditionalData::none;
+  data.mapping_update_flags  = update_default;
+  data.mg_level              = level;
+
+  std::vector<double> distances, index_spans;
+  for (const bool hilbert : {false, true})
+    {
+      DoFHandler<dim> dof(tria);
+      dof.distribute_dofs(fe);
+      dof.distribute_mg_dofs();
+
+      data.order_cells_along_hilbert_curve = hilbert;
+      if (level == numbers::invalid_unsigned_int)
+        DoFRenumbering::matrix_free_data_locality(dof, constraints, data);
+
+      MatrixFreeType mf;
+      mf.reinit(MappingQ1<dim>(), dof, constraints, QGauss<1>(2), data);
+
+      std::set<std::pair<int, int>> visited_cells;
+      double distance = 0, index_span = 0;
+      Point<dim>                           previous_center;
+      std::vector<types::global_dof_index> dof_indices(fe.dofs_per_cell);
+      for (unsigned int cell = 0; cell < mf.n_cell_batches(); ++cell)
+        {
+          const auto cell_it = mf.get_cell_iterator(cell, 0);
+          visited_cells.emplace(cell_it->level(), cell_it->index());
+          if (cell > 0)
+            distance += cell_it->center().distance(previous_center);
+          previous_center = cell_it->center();
+          if (level == numbers::invalid_unsigned_int)
+            {
+              cell_it->get_dof_indices(dof_indices);
+              index_span +=
+                *std::max_element(dof_indices.begin(), dof_indices.end()) -
+                *std::min_element(dof_indices.begin(), dof_indices.end());
+            }
+        }
+      deallog << "Hilbert ordering " << std::boolalpha << hilbert
+              << ": all cells visited once: "
+              << (visited_cells.size() == mf.n_cell_batches() &&
+                  visited_cells.size() ==
+                    (level == numbers::invalid_unsigned_int ?
+                       tria.n_active_cells() :
+                       tria.n_cells(level)))
+              << std::endl;
+
+      // a precomputed position of the coarse cells along the curve must give
+      // the same order of the cells
+      if (hilbert)
+        {
+          typename MatrixFreeType::AdditionalData data_with_rank = data;
+          data_with_rank.coarse_cell_hilbert_rank =
+            MatrixFreeTools::compute_hilbert_rank_of_coarse_cells(tria);
+          MatrixFreeType mf_with_rank;
+          mf_with_rank.reinit(MappingQ1<dim>(),
+                              dof,
+                              constraints,
+                              QGauss<1>(2),
+                              data_with_rank);
+          bool same_order =
+            mf_with_rank.n_cell_batches() == mf.n_cell_batches();
+          for (unsigned int cell = 0; same_order && cell < mf.n_cell_batches();
+               ++cell)
+            same_order = mf_with_rank.get_cell_iterator(cell, 0) ==
+                         mf.get_cell_iterator(cell, 0);
+          deallog << "Same order with precomputed rank: " << same_order
+                  << std::endl;
+        }
+      distances.push_back(distance);
+      index_spans.push_back(index_span);
+    }
+  deallog << "Smaller distance between consecutive cells: "
+          << (distances[1] < 0.9 * distances[0]) << std::endl;
+  if (level == numbers::invalid_unsigned_int)
+    deallog << "Smaller range of DoF indices per cell: "
+            << (index_spans[1] < 0.9 * index_spans[0]) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d active");
+  test<2>(numbers::invalid_unsigned_int);
+  deallog.pop();
+  deallog.push("2d level 1");
+  test<2>(1);
+  deallog.pop();
+  deallog.push("3d active");
+  test<3>(numbers::invalid_unsigned_int);
+  deallog.pop();
+  deallog.push("3d level 1");
+  test<3>(1);
+  deallog.pop();
+}
@@ -0,0 +1,249 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the fused cell-plus-face kernel of an element-centric loop as
+// described in the documentation of MatrixFree::loop_cell_centric(): the
+// interior side of all faces of a cell is evaluated from the cell's own
+// degrees of freedom and the face integrals are accumulated into a cell-local
+// array, which must give the same result as the face-centric loop for an
+// interior penalty discretization of the Laplacian.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include "../tests.h"
+
+
+template <int dim, int fe_degree>
+void
+test(const unsigned int n_refinements)
+{
+  using Number              = double;
+  using VectorizedArrayType = VectorizedArray<Number>;
+  using VectorType          = LinearAlgebra::distributed::Vector<Number>;
+  using MF                  = MatrixFree<dim, Number, VectorizedArrayType>;
+
+  // in 3d, the ball contains faces in non-standard orientation, where the
+  // points on a face are numbered differently when seen from the cell than
+  // in the face-centric loop
+  Triangulation<dim> tria;
+  if (dim == 3)
+    GridGenerator::hyper_ball(tria);
+  else
+    GridGenerator::subdivided_hyper_cube(tria, 2, -1., 1.);
+  tria.refine_global(n_refinements);
+  GridTools::distort_random(0.1, tria);
+
+  if (dim == 3)
+    {
+      unsigned int n_faces_non_standard = 0;
+      for (const auto &cell : tria.active_cell_iterators())
+        for (const unsigned int face : cell->face_indices())
+          if (cell->face_orientation(face) == false ||
+              cell->face_flip(face) || cell->face_rotation(face))
+            ++n_faces_non_standard;
+      deallog << "Faces in non-standard orientation: " << n_faces_non_standard
+              << std::endl;
+    }
+
+  FE_DGQ<dim>     fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  MappingQ<dim> mapping(1);
+
+  AffineConstraints<Number> constraint;
+  constraint.close();
+
+  typename MF::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_values | update_gradients;
+  additional_data.mapping_update_flags_inner_faces =
+    update_values | update_gradients;
+  additional_data.mapping_update_flags_boundary_faces =
+    update_values | update_gradients;
+  additional_data.mapping_update_flags_faces_by_cells =
+    update_values | update_gradients;
+  additional_data.hold_all_faces_to_owned_cells = true;
+  MatrixFreeTools::categorize_by_boundary_ids(tria, additional_data);
+
+  MF matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     constraint,
+                     QGauss<1>(fe_degree + 1),
+                     additional_data);
+
+  VectorType src, dst_face_centric, dst_fused;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst_face_centric);
+  matrix_free.initialize_dof_vector(dst_fused);
+  for (auto &value : src)
+    value = random_value<Number>();
+
+  FEEvaluation<dim, fe_degree>     phi(matrix_free);
+  FEFaceEvaluation<dim, fe_degree> phi_m(matrix_free, true);
+  FEFaceEvaluation<dim, fe_degree> phi_p(matrix_free, false);
+
+  const Number penalty_factor = std::max(fe_degree, 1) * (fe_degree + 1.0);
+
+  const auto flags = EvaluationFlags::values | EvaluationFlags::gradients;
+
+  // flux of the symmetric interior penalty method, with the exterior values
+  // set to zero on the boundary; the penalty parameter is averaged over the
+  // quadrature points to not depend on their numbering
+  const auto submit_flux = [&](const bool interior_face) {
+    VectorizedArrayType sigma = VectorizedArrayType();
+    for (const unsigned int q : phi_m.quadrature_point_indices())
+      sigma += std::abs((phi_m.normal_vector(q) *
+                         phi_m.inverse_jacobian(q))[dim - 1]) +
+               (interior_face ? std::abs((phi_m.normal_vector(q) *
+                                          phi_p.inverse_jacobian(q))[dim - 1]) :
+                                std::abs((phi_m.normal_vector(q) *
+                                          phi_m.inverse_jacobian(q))[dim - 1]));
+    sigma *= penalty_factor / phi_m.n_q_points;
+    for (const unsigned int q : phi_m.quadrature_point_indices())
+      {
+        const VectorizedArrayType jump =
+          phi_m.get_value(q) - (interior_face ? phi_p.get_value(q) :
+                                                VectorizedArrayType());
+        const VectorizedArrayType average_gradient =
+          0.5 * (phi_m.get_normal_derivative(q) +
+                 (interior_face ? phi_p.get_normal_derivative(q) :
+                                  phi_m.get_normal_derivative(q)));
+        phi_m.submit_normal_derivative(-0.5 * jump, q);
+        phi_m.submit_value(sigma * jump - average_gradient, q);
+        if (interior_face)
+          {
+            phi_p.submit_normal_derivative(-0.5 * jump, q);
+            phi_p.submit_value(average_gradient - sigma * jump, q);
+          }
+      }
+  };
+
+  const auto cell_integral = [&]() {
+    phi.evaluate(EvaluationFlags::gradients);
+    for (const unsigned int q : phi.quadrature_point_indices())
+      phi.submit_gradient(phi.get_gradient(q), q);
+    phi.integrate(EvaluationFlags::gradients);
+  };
+
+  // face-centric loop
+  matrix_free.template loop<VectorType, VectorType>(
+    [&](const auto &, auto &dst, const auto &src, const auto range) {
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          cell_integral();
+          phi.distribute_local_to_global(dst);
+        }
+    },
+    [&](const auto &, auto &dst, const auto &src, const auto range) {
+      for (unsigned int face = range.first; face < range.second; ++face)
+        {
+          phi_m.reinit(face);
+          phi_p.reinit(face);
+          phi_m.gather_evaluate(src, flags);
+          phi_p.gather_evaluate(src, flags);
+          submit_flux(true);
+          phi_m.integrate_scatter(flags, dst);
+          phi_p.integrate_scatter(flags, dst);
+        }
+    },
+    [&](const auto &, auto &dst, const auto &src, const auto range) {
+      for (unsigned int face = range.first; face < range.second; ++face)
+        {
+          phi_m.reinit(face);
+          phi_m.gather_evaluate(src, flags);
+          submit_flux(false);
+          phi_m.integrate_scatter(flags, dst);
+        }
+    },
+    dst_face_centric,
+    src,
+    true);
+
+  // element-centric loop, reading the vector only once per cell and once
+  // per neighbor
+  AlignedVector<VectorizedArrayType> face_integrals(phi.dofs_per_cell);
+  matrix_free.template loop_cell_centric<VectorType, VectorType>(
+    [&](const auto &, auto &dst, const auto &src, const auto range) {
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+
+          face_integrals.fill(VectorizedArrayType());
+          for (const unsigned int face : GeometryInfo<dim>::face_indices())
+            {
+              const bool interior_face =
+                matrix_free.get_faces_by_cells_boundary_id(cell, face)[0] ==
+                numbers::internal_face_boundary_id;
+              phi_m.reinit(cell, face);
+              phi_m.evaluate(phi.begin_dof_values(), flags);
+              if (interior_face)
+                {
+                  phi_p.reinit(cell, face);
+                  phi_p.gather_evaluate(src, flags);
+                }
+              submit_flux(interior_face);
+              phi_m.integrate(flags, face_integrals.data(), true);
+            }
+
+          cell_integral();
+          for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+            phi.begin_dof_values()[i] += face_integrals[i];
+          phi.set_dof_values(dst);
+        }
+    },
+    dst_fused,
+    src,
+    true);
+
+  dst_fused -= dst_face_centric;
+  deallog << "Dimension " << dim << ", degree " << fe_degree
+          << ": difference fused element-centric to face-centric loop "
+          << (dst_fused.linfty_norm() < 1e-12 * dst_face_centric.linfty_norm() ?
+                "OK" :
+                "FAILED")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1>(3);
+  test<2, 3>(2);
+  test<3, 1>(1);
+  test<3, 2>(1);
+}
@@ -0,0 +1,135 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that the tensor product evaluation with sizes given at run time, path
+// evaluate_general, gives the same result as the evaluation with sizes given
+// as template arguments, both for the sizes where the length of the sums is
+// rounded up to a compile-time bound and for larger sizes
+
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/matrix_free/tensor_product_kernels.h>
+
+#include <iostream>
+
+#include "../tests.h"
+
+
+template <int dim, int M, int N>
+void
+test()
+{
+  using Number = VectorizedArray<double>;
+
+  AlignedVector<double> shape_values(M * N), shape_gradients(M * N);
+  for (unsigned int i = 0; i < M * N; ++i)
+    {
+      shape_values[i]    = -1. + 2. * random_value<double>();
+      shape_gradients[i] = -1. + 2. * random_value<double>();
+    }
+
+  const unsigned int    size = Utilities::pow(std::max(M, N), dim);
+  AlignedVector<Number> input(size), result_runtime(size),
+    result_templated(size), tmp_runtime(size), tmp_templated(size);
+  for (unsigned int i = 0; i < size; ++i)
+    for (unsigned int v = 0; v < Number::size(); ++v)
+      input[i][v] = random_value<double>();
+
+  internal::EvaluatorTensorProduct<internal::evaluate_general,
+                                   dim,
+                                   0,
+                                   0,
+                                   Number,
+                                   double>
+    evaluator_runtime(
+      shape_values.data(), shape_gradients.data(), nullptr, M, N);
+  internal::EvaluatorTensorProduct<internal::evaluate_general,
+                                   dim,
+                                   M,
+                                   N,
+                                   Number,
+                                   double>
+    evaluator_templated(shape_values.data(), shape_gradients.data(), nullptr);
+
+  double error = 0;
+  const auto compare = [&]() {
+    for (unsigned int i = 0; i < size; ++i)
+      for (unsigned int v = 0; v < Number::size(); ++v)
+        error = std::max<double>(error,
+                                 std::abs(result_runtime[i][v] -
+                                          result_templated[i][v]));
+  };
+
+  // interpolation from M to N points in all directions, with a gradient in
+  // the last direction
+  evaluator_runtime.template values<0, true, false>(input.data(),
+                                                    result_runtime.data());
+  evaluator_templated.template values<0, true, false>(input.data(),
+                                                      result_templated.data());
+  compare();
+  if (dim > 1)
+    {
+      evaluator_runtime.template gradients<dim - 1, true, false>(
+        result_runtime.data(), tmp_runtime.data());
+      evaluator_templated.template gradients<dim - 1, true, false>(
+        result_templated.data(), tmp_templated.data());
+      result_runtime   = tmp_runtime;
+      result_templated = tmp_templated;
+      compare();
+    }
+
+  // integration from N to M points, adding into the result
+  result_runtime   = input;
+  result_templated = input;
+  evaluator_runtime.template values<dim - 1, false, true>(
+    input.data(), result_runtime.data());
+  evaluator_templated.template values<dim - 1, false, true>(
+    input.data(), result_templated.data());
+  compare();
+
+  // in-place operation
+  if (M == N)
+    {
+      result_runtime   = input;
+      result_templated = input;
+      evaluator_runtime.template gradients<0, true, false>(
+        result_runtime.data(), result_runtime.data());
+      evaluator_templated.template gradients<0, true, false>(
+        result_templated.data(), result_templated.data());
+      compare();
+    }
+
+  deallog << "Test " << dim << "d " << M << " x " << N << ": "
+          << (error < 1e-14 ? "OK" : "FAILED") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1, 2, 3>();
+  test<2, 3, 3>();
+  test<2, 4, 6>();
+  test<3, 5, 5>();
+  test<3, 6, 4>();
+  test<3, 8, 9>();
+  test<2, 9, 12>();
+  test<3, 12, 11>();
+  test<2, 13, 14>();
+  test<3, 14, 14>();
+}
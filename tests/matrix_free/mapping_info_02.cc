@@ -0,0 +1,196 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that MatrixFree::AdditionalData::store_mapping_support_points gives
+// the same inverse Jacobians, JxW values, and quadrature points on a curved
+// mesh as the tabulated geometry, both with FEEvaluation::reinit() on cell
+// batches and on arbitrary cells, and that it uses less memory.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+template <int dim, typename Number>
+void
+test(const unsigned int mapping_degree)
+{
+  using VectorizedArrayType = VectorizedArray<Number>;
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1., 2 * dim);
+  tria.refine_global(1);
+
+  FE_Q<dim>       fe(3);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  MappingQ<dim> mapping(mapping_degree);
+
+  // two quadrature formulas with more and fewer points than the mapping has
+  // support points in each direction
+  const std::vector<Quadrature<1>> quadratures{QGauss<1>(mapping_degree + 2),
+                                               QGauss<1>(2)};
+
+  typename MatrixFree<dim, Number>::AdditionalData data;
+  data.mapping_update_flags =
+    update_gradients | update_JxW_values | update_quadrature_points;
+
+  const std::vector<const DoFHandler<dim> *> dofs{&dof};
+  const std::vector<const AffineConstraints<double> *> constraint_vector{
+    &constraints};
+
+  MatrixFree<dim, Number> mf_tabulated, mf_on_the_fly;
+  mf_tabulated.reinit(mapping, dofs, constraint_vector, quadratures, data);
+  data.store_mapping_support_points = true;
+  mf_on_the_fly.reinit(mapping, dofs, constraint_vector, quadratures, data);
+
+  unsigned int n_on_the_fly = 0;
+  for (unsigned int cell = 0; cell < mf_on_the_fly.n_cell_batches(); ++cell)
+    if (mf_on_the_fly.get_mapping_info().cell_geometry_computed_on_the_fly(
+          cell))
+      ++n_on_the_fly;
+  deallog << "Geometry computed on the fly on all cell batches: "
+          << std::boolalpha << (n_on_the_fly == mf_on_the_fly.n_cell_batches())
+          << std::endl;
+  deallog << "Less memory for geometry: "
+          << (mf_on_the_fly.get_mapping_info().memory_consumption() <
+              mf_tabulated.get_mapping_info().memory_consumption())
+          << std::endl;
+
+  for (unsigned int quad = 0; quad < quadratures.size(); ++quad)
+    {
+      FEEvaluation<dim, -1, 0, 1, Number> eval_tabulated(mf_tabulated,
+                                                         0,
+                                                         quad);
+      FEEvaluation<dim, -1, 0, 1, Number> eval_on_the_fly(mf_on_the_fly,
+                                                          0,
+                                                          quad);
+
+      double error_jxw = 0, error_jac = 0, error_points = 0;
+      for (unsigned int cell = 0; cell < mf_tabulated.n_cell_batches();
+           ++cell)
+        {
+          eval_tabulated.reinit(cell);
+          eval_on_the_fly.reinit(cell);
+          for (const unsigned int q :
+               eval_tabulated.quadrature_point_indices())
+            for (unsigned int v = 0;
+                 v < mf_tabulated.n_active_entries_per_cell_batch(cell);
+                 ++v)
+              {
+                const Tensor<2, dim, VectorizedArrayType> jac =
+                  eval_tabulated.inverse_jacobian(q);
+                const Tensor<2, dim, VectorizedArrayType> jac_fly =
+                  eval_on_the_fly.inverse_jacobian(q);
+                const Point<dim, VectorizedArrayType> point =
+                  eval_tabulated.quadrature_point(q);
+                const Point<dim, VectorizedArrayType> point_fly =
+                  eval_on_the_fly.quadrature_point(q);
+                error_jxw = std::max<double>(
+                  error_jxw,
+                  std::abs(eval_tabulated.JxW(q)[v] -
+                           eval_on_the_fly.JxW(q)[v]) /
+                    eval_tabulated.JxW(q)[v]);
+                double jac_norm = 0, jac_difference = 0;
+                for (unsigned int d = 0; d < dim; ++d)
+                  for (unsigned int e = 0; e < dim; ++e)
+                    {
+                      jac_norm += Utilities::fixed_power<2>(jac[d][e][v]);
+                      jac_difference += Utilities::fixed_power<2>(
+                        jac[d][e][v] - jac_fly[d][e][v]);
+                    }
+                error_jac =
+                  std::max(error_jac, std::sqrt(jac_difference / jac_norm));
+                for (unsigned int d = 0; d < dim; ++d)
+                  error_points =
+                    std::max<double>(error_points,
+                                     std::abs(point[d][v] - point_fly[d][v]));
+              }
+        }
+
+      // reinit on cells collected from different cell batches, with lanes
+      // in reverse order
+      double error_lanes = 0;
+      for (unsigned int cell = 0; cell + 1 < mf_tabulated.n_cell_batches();
+           cell += 2)
+        {
+          std::array<unsigned int, n_lanes> cell_ids;
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            {
+              const unsigned int batch = cell + v % 2;
+              const unsigned int lane  = n_lanes - 1 - v;
+              cell_ids[v] =
+                lane < mf_tabulated.n_active_entries_per_cell_batch(batch) ?
+                  batch * n_lanes + lane :
+                  numbers::invalid_unsigned_int;
+            }
+          eval_on_the_fly.reinit(cell_ids);
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            if (cell_ids[v] != numbers::invalid_unsigned_int)
+              {
+                eval_tabulated.reinit(cell_ids[v] / n_lanes);
+                const unsigned int lane = cell_ids[v] % n_lanes;
+                for (const unsigned int q :
+                     eval_tabulated.quadrature_point_indices())
+                  error_lanes = std::max<double>(
+                    error_lanes,
+                    std::abs(eval_tabulated.JxW(q)[lane] -
+                             eval_on_the_fly.JxW(q)[v]) /
+                      eval_tabulated.JxW(q)[lane]);
+              }
+        }
+
+      const double tolerance = std::is_same_v<Number, float> ? 1e-5 : 1e-12;
+      deallog << "Quadrature " << quad << " with "
+              << eval_tabulated.n_q_points << " points: JxW "
+              << (error_jxw < tolerance ? "OK" : "FAILED")
+              << ", inverse Jacobians "
+              << (error_jac < tolerance ? "OK" : "FAILED")
+              << ", quadrature points "
+              << (error_points < tolerance ? "OK" : "FAILED")
+              << ", cell ids " << (error_lanes < tolerance ? "OK" : "FAILED")
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2, double>(4);
+  test<2, float>(5);
+  deallog.pop();
+  deallog.push("3d");
+  test<3, double>(3);
+  test<3, float>(4);
+  deallog.pop();
+}
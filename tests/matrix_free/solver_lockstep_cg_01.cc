@@ -0,0 +1,196 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Solve a Helmholtz problem for several right hand sides with
+// SolverLockstepCG and a matrix-free operator that evaluates all right hand
+// sides in a single pass over the cells, through an FEEvaluation object with
+// as many components as there are blocks. Compare with the solutions obtained
+// by SolverCG with a matrix-free operator for each right hand side
+// separately.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_lockstep_cg.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+#include "matrix_vector_mf.h"
+
+
+
+// Apply the Helmholtz operator of matrix_vector_mf.h to all blocks of a block
+// vector with a single cell loop
+template <int dim, int fe_degree, int n_rhs, typename Number>
+class LockstepHelmholtzOperator
+{
+public:
+  using BlockVectorType = LinearAlgebra::distributed::BlockVector<Number>;
+
+  LockstepHelmholtzOperator(const MatrixFree<dim, Number> &data)
+    : data(data)
+  {}
+
+  void
+  vmult(BlockVectorType &dst, const BlockVectorType &src) const
+  {
+    AssertDimension(src.n_blocks(), n_rhs);
+    data.cell_loop(
+      &LockstepHelmholtzOperator::local_apply, this, dst, src, true);
+  }
+
+private:
+  void
+  local_apply(const MatrixFree<dim, Number>               &data,
+              BlockVectorType                             &dst,
+              const BlockVectorType                       &src,
+              const std::pair<unsigned int, unsigned int> &cell_range) const
+  {
+    // each block is read as one component of the scalar element
+    FEEvaluation<dim, fe_degree, fe_degree + 1, n_rhs, Number> phi(data);
+
+    for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+      {
+        phi.reinit(cell);
+        phi.gather_evaluate(src,
+                            EvaluationFlags::values |
+                              EvaluationFlags::gradients);
+        for (const unsigned int q : phi.quadrature_point_indices())
+          {
+            phi.submit_value(Number(10) * phi.get_value(q), q);
+            phi.submit_gradient(phi.get_gradient(q), q);
+          }
+        phi.integrate_scatter(EvaluationFlags::values |
+                                EvaluationFlags::gradients,
+                              dst);
+      }
+  }
+
+  const MatrixFree<dim, Number> &data;
+};
+
+
+
+template <int dim, int fe_degree, int n_rhs>
+void
+test()
+{
+  using Number          = double;
+  using VectorType      = LinearAlgebra::distributed::Vector<Number>;
+  using BlockVectorType = LinearAlgebra::distributed::BlockVector<Number>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(5 - dim);
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  deallog << "Testing " << fe.get_name() << " with " << n_rhs
+          << " right hand sides" << std::endl;
+
+  MatrixFree<dim, Number> mf_data;
+  mf_data.reinit(MappingQ1<dim>(),
+                 dof,
+                 constraints,
+                 QGauss<1>(fe_degree + 1),
+                 typename MatrixFree<dim, Number>::AdditionalData());
+
+  MatrixFreeTest<dim, fe_degree, Number, VectorType> mf_ref(mf_data);
+  LockstepHelmholtzOperator<dim, fe_degree, n_rhs, Number> mf(mf_data);
+
+  BlockVectorType x(n_rhs), b(n_rhs), result(n_rhs);
+  for (unsigned int i = 0; i < n_rhs; ++i)
+    {
+      mf_data.initialize_dof_vector(b.block(i));
+      for (unsigned int j = 0; j < b.block(i).locally_owned_size(); ++j)
+        b.block(i).local_element(j) = random_value<double>();
+    }
+  b.collect_sizes();
+  // one right hand side is zero
+  b.block(1) = 0.;
+  x.reinit(b);
+  result.reinit(b);
+
+  // the single pass over the cells must give the same result as the
+  // operator applied to each block separately
+  mf.vmult(result, b);
+  for (unsigned int i = 0; i < n_rhs; ++i)
+    {
+      VectorType reference;
+      reference.reinit(b.block(i));
+      mf_ref.vmult(reference, b.block(i));
+      reference -= result.block(i);
+      deallog << "Block " << i << ": difference of vmult "
+              << (reference.linfty_norm() <= 1e-12 * result.linfty_norm() ?
+                    "OK" :
+                    "FAILED")
+              << std::endl;
+    }
+
+  SolverControl                     control(200, 1e-10);
+  SolverLockstepCG<BlockVectorType> solver(control);
+  check_solver_within_range(solver.solve(mf, x, b, PreconditionIdentity()),
+                            control.last_step(),
+                            80,
+                            160);
+
+  for (unsigned int i = 0; i < n_rhs; ++i)
+    {
+      VectorType reference;
+      reference.reinit(b.block(i));
+      SolverControl        control_ref(200, 1e-10);
+      SolverCG<VectorType> solver_ref(control_ref);
+      solver_ref.solve(mf_ref, reference, b.block(i), PreconditionIdentity());
+      VectorType difference(x.block(i));
+      difference -= reference;
+      deallog << "Block " << i << ": difference to SolverCG "
+              << (difference.l2_norm() <= 1e-8 * (1. + reference.l2_norm()) ?
+                    "OK" :
+                    "FAILED")
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(4);
+
+  test<2, 2, 3>();
+  test<2, 3, 4>();
+  test<3, 2, 3>();
+}
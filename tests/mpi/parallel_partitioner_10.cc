@@ -0,0 +1,163 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that Partitioner::set_ghost_indices() gives the same communication
+// pattern when it is taken from the cache, that the patterns of a freed
+// communicator are not used for a new communicator, and that
+// Partitioner::reinit_from_superset() gives the same pattern as a partitioner
+// set up from scratch
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/utilities.h>
+
+#include <iostream>
+#include <vector>
+
+#include "../tests.h"
+
+
+void
+check_same_pattern(const Utilities::MPI::Partitioner &a,
+                   const Utilities::MPI::Partitioner &b)
+{
+  AssertThrow(a.ghost_indices() == b.ghost_indices(), ExcInternalError());
+  AssertThrow(a.ghost_targets() == b.ghost_targets(), ExcInternalError());
+  AssertThrow(a.import_targets() == b.import_targets(), ExcInternalError());
+  AssertThrow(a.import_indices() == b.import_indices(), ExcInternalError());
+  AssertDimension(a.n_import_indices(), b.n_import_indices());
+}
+
+
+
+void
+print_cache_statistics()
+{
+  const auto statistics =
+    Utilities::MPI::Partitioner::communication_pattern_cache_statistics();
+  deallog << "cache hits: " << statistics.first
+          << ", misses: " << statistics.second << std::endl;
+}
+
+
+
+void
+test()
+{
+  const unsigned int myid    = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int numproc = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  // each process owns 100 indices and ghosts some indices of all other
+  // processes
+  const unsigned int local_size = 100;
+  IndexSet           local_owned(local_size * numproc);
+  local_owned.add_range(myid * local_size, (myid + 1) * local_size);
+  IndexSet ghosts(local_size * numproc);
+  IndexSet ghosts_subset(local_size * numproc);
+  for (unsigned int p = 0; p < numproc; ++p)
+    if (p != myid)
+      {
+        ghosts.add_range(p * local_size + 10 * myid,
+                         p * local_size + 10 * myid + 20);
+        ghosts.add_index(p * local_size + 99);
+        // only take some of the ghosts into the subset, and none from the
+        // last process
+        if (p + 1 < numproc)
+          ghosts_subset.add_range(p * local_size + 10 * myid + 5,
+                                  p * local_size + 10 * myid + 8);
+      }
+
+  Utilities::MPI::Partitioner::clear_communication_pattern_cache();
+  Utilities::MPI::Partitioner first(local_owned, ghosts, MPI_COMM_WORLD);
+
+  // the second partitioner gets its pattern from the cache
+  Utilities::MPI::Partitioner second(local_owned, ghosts, MPI_COMM_WORLD);
+  check_same_pattern(first, second);
+  deallog << "cached pattern OK" << std::endl;
+  print_cache_statistics();
+
+  // a partitioner on a duplicate of the communicator can not use the
+  // pattern of MPI_COMM_WORLD, and after the duplicate has been freed, its
+  // pattern must not be used for the next duplicate, which may get the same
+  // handle
+  for (unsigned int repetition = 0; repetition < 2; ++repetition)
+    {
+      MPI_Comm communicator;
+      MPI_Comm_dup(MPI_COMM_WORLD, &communicator);
+      Utilities::MPI::Partitioner on_duplicate(local_owned,
+                                               ghosts,
+                                               communicator);
+      check_same_pattern(first, on_duplicate);
+      MPI_Comm_free(&communicator);
+    }
+  deallog << "pattern on duplicated communicator OK" << std::endl;
+  print_cache_statistics();
+
+  Utilities::MPI::Partitioner subset_reference(local_owned,
+                                               ghosts_subset,
+                                               MPI_COMM_WORLD);
+  Utilities::MPI::Partitioner subset;
+  subset.reinit_from_superset(first, ghosts_subset, first.ghost_indices());
+  check_same_pattern(subset, subset_reference);
+  deallog << "subset pattern OK" << std::endl;
+
+  // exchange the global indices as values into a zero-initialized array of
+  // the size of the larger set of ghosts; the entries outside the subset
+  // must stay zero, as for the ghost values of a vector
+  std::vector<double> owned_values(local_size);
+  for (unsigned int i = 0; i < local_size; ++i)
+    owned_values[i] = myid * local_size + i;
+  std::vector<double> temporary_storage(subset.n_import_indices());
+  std::vector<double> ghost_values(first.n_ghost_indices());
+  std::vector<MPI_Request> requests;
+  subset.export_to_ghosted_array_start<double>(
+    0,
+    ArrayView<const double>(owned_values.data(), owned_values.size()),
+    make_array_view(temporary_storage),
+    make_array_view(ghost_values),
+    requests);
+  subset.export_to_ghosted_array_finish<double>(make_array_view(ghost_values),
+                                                requests);
+  unsigned int n_errors = 0;
+  for (unsigned int i = 0; i < ghost_values.size(); ++i)
+    {
+      const types::global_dof_index index =
+        first.ghost_indices().nth_index_in_set(i);
+      const double expected = ghosts_subset.is_element(index) ? index : 0.;
+      if (ghost_values[i] != expected)
+        ++n_errors;
+    }
+  deallog << "subset exchange errors: " << n_errors << std::endl;
+
+  // after clearing the cache, the pattern is computed again
+  Utilities::MPI::Partitioner::clear_communication_pattern_cache();
+  Utilities::MPI::Partitioner third(local_owned, ghosts, MPI_COMM_WORLD);
+  check_same_pattern(first, third);
+  deallog << "recomputed pattern OK" << std::endl;
+  print_cache_statistics();
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(
+    argc, argv, testing_max_num_threads());
+
+  MPILogInitAll log;
+
+  test();
+}
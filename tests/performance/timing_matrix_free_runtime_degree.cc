@@ -0,0 +1,169 @@
+/* ------------------------------------------------------------------------
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ * Copyright (C) 2026 by the deal.II authors
+ *
+ * This file is part of the deal.II library.
+ *
+ * Part of the source code is dual licensed under Apache-2.0 WITH
+ * LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+ * governing the source code and code contributions can be found in
+ * LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+ *
+ * ------------------------------------------------------------------------
+ *
+ * Description:
+ *
+ * This test compares the cost of FEEvaluation::evaluate() and
+ * FEEvaluation::integrate() with the polynomial degree and the number of
+ * quadrature points given at run time to the cost with the templated
+ * kernels, for FE_Q elements in 3d. The two combinations of degree and
+ * number of quadrature points are not among the precompiled ones, such that
+ * the run-time variant uses the generic kernels whose one-dimensional sums
+ * are rounded up to a length known at compile time.
+ *
+ * Status: experimental
+ */
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+
+
+template <int dim, int fe_degree, int n_q_points_1d>
+double
+run_evaluate_integrate(const MatrixFree<dim, double> &matrix_free,
+                       const Vector<double>          &src,
+                       Vector<double>                &dst,
+                       const unsigned int             n_repetitions)
+{
+  FEEvaluation<dim, fe_degree, n_q_points_1d, 1, double> phi(matrix_free);
+
+  // repeat the interpolation on each cell batch to focus on the cost of the
+  // evaluation kernels rather than the access to the global vectors
+  Timer time;
+  dst = 0.;
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      phi.reinit(cell);
+      phi.read_dof_values(src);
+      for (unsigned int r = 0; r < n_repetitions; ++r)
+        {
+          phi.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              phi.submit_value(phi.get_value(q), q);
+              phi.submit_gradient(phi.get_gradient(q), q);
+            }
+          phi.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+        }
+      phi.distribute_local_to_global(dst);
+    }
+  return time.wall_time();
+}
+
+
+
+template <int fe_degree, int n_q_points_1d>
+std::array<double, 2>
+run(const unsigned int n_global_refinements)
+{
+  constexpr int dim = 3;
+
+  unsigned int n_evaluations = 0;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_evaluations = 20;
+        break;
+      case TestingEnvironment::medium:
+        n_evaluations = 50;
+        break;
+      case TestingEnvironment::heavy:
+        n_evaluations = 100;
+        break;
+    }
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(n_global_refinements);
+
+  FE_Q<dim>       fe(fe_degree);
+  MappingQ1<dim>  mapping;
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(n_q_points_1d),
+                     additional_data);
+
+  AssertThrow((FEEvaluation<dim, -1, 0, 1, double>::fast_evaluation_supported(
+                fe_degree, n_q_points_1d) == false),
+              ExcInternalError());
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = static_cast<double>(i % 7) / 7.;
+
+  const double dt_runtime =
+    run_evaluate_integrate<dim, -1, 0>(matrix_free, src, dst, n_evaluations);
+  const double dt_templated =
+    run_evaluate_integrate<dim, fe_degree, n_q_points_1d>(matrix_free,
+                                                          src,
+                                                          dst,
+                                                          n_evaluations);
+
+  return {{dt_runtime, dt_templated}};
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"degree_3_q7_runtime",
+           "degree_3_q7_templated",
+           "degree_7_q8_runtime",
+           "degree_7_q8_templated"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  const auto result_3 = run<3, 7>(3);
+  const auto result_7 = run<7, 8>(2);
+
+  return {result_3[0], result_3[1], result_7[0], result_7[1]};
+}
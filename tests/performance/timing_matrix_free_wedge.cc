@@ -0,0 +1,181 @@
+/* ------------------------------------------------------------------------
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ * Copyright (C) 2026 by the deal.II authors
+ *
+ * This file is part of the deal.II library.
+ *
+ * Part of the source code is dual licensed under Apache-2.0 WITH
+ * LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+ * governing the source code and code contributions can be found in
+ * LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+ *
+ * ------------------------------------------------------------------------
+ *
+ * Description:
+ *
+ * This test compares the cost of FEEvaluation::evaluate() and
+ * FEEvaluation::integrate() for FE_WedgeP elements of degree 2 between the
+ * kernel that splits the interpolation into a product on the triangle and a
+ * product in z direction and the dense kernel that applies the full shape
+ * function matrix. The dense kernel is selected by a second MatrixFree
+ * object that uses the same quadrature points with the points in z direction
+ * running fastest, which does not have the product layout the factorized
+ * kernel needs.
+ *
+ * Status: experimental
+ */
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_wedge_p.h>
+#include <deal.II/fe/mapping_fe.h>
+
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../simplex/simplex_grids.h"
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+
+
+template <int dim>
+double
+run_evaluate_integrate(const MatrixFree<dim, double> &matrix_free,
+                       const Vector<double>          &src,
+                       Vector<double>                &dst,
+                       const unsigned int             n_repetitions)
+{
+  FEEvaluation<dim, -1, 0, 1, double> phi(matrix_free);
+
+  // repeat the interpolation on each cell batch to focus on the cost of the
+  // evaluation kernels rather than the access to the global vectors
+  Timer time;
+  dst = 0.;
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      phi.reinit(cell);
+      phi.read_dof_values(src);
+      for (unsigned int r = 0; r < n_repetitions; ++r)
+        {
+          phi.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              phi.submit_value(phi.get_value(q), q);
+              phi.submit_gradient(phi.get_gradient(q), q);
+            }
+          phi.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+        }
+      phi.distribute_local_to_global(dst);
+    }
+  return time.wall_time();
+}
+
+
+
+Measurement
+run(const unsigned int degree)
+{
+  constexpr int dim = 3;
+
+  unsigned int repetitions   = 0;
+  unsigned int n_evaluations = 0;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        repetitions   = 12;
+        n_evaluations = 20;
+        break;
+      case TestingEnvironment::medium:
+        repetitions   = 16;
+        n_evaluations = 50;
+        break;
+      case TestingEnvironment::heavy:
+        repetitions   = 20;
+        n_evaluations = 100;
+        break;
+    }
+
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube_with_wedges(tria, repetitions);
+
+  FE_WedgeP<dim>  fe(degree);
+  MappingFE<dim>  mapping(FE_WedgeP<dim>(1));
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values;
+
+  // QGaussWedge runs through the points on the triangle first; renumber the
+  // points such that the points in z direction run fastest for the dense
+  // kernel
+  const QGaussWedge<dim>  quadrature(degree + 1);
+  const unsigned int      n_q_points_line = degree + 1;
+  const unsigned int      n_q_points_triangle =
+    quadrature.size() / n_q_points_line;
+  std::vector<Point<dim>> points;
+  std::vector<double>     weights;
+  for (unsigned int qt = 0; qt < n_q_points_triangle; ++qt)
+    for (unsigned int ql = 0; ql < n_q_points_line; ++ql)
+      {
+        points.push_back(quadrature.point(ql * n_q_points_triangle + qt));
+        weights.push_back(quadrature.weight(ql * n_q_points_triangle + qt));
+      }
+  const Quadrature<dim> quadrature_dense(points, weights);
+
+  MatrixFree<dim, double> matrix_free, matrix_free_dense;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, quadrature, additional_data);
+  matrix_free_dense.reinit(
+    mapping, dof_handler, constraints, quadrature_dense, additional_data);
+  AssertThrow(!matrix_free.get_shape_info().wedge_data.empty(),
+              ExcInternalError());
+  AssertThrow(matrix_free_dense.get_shape_info().wedge_data.empty(),
+              ExcInternalError());
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = static_cast<double>(i % 7) / 7.;
+
+  const double dt_factorized =
+    run_evaluate_integrate(matrix_free, src, dst, n_evaluations);
+  const double dt_dense =
+    run_evaluate_integrate(matrix_free_dense, src, dst, n_evaluations);
+
+  return {dt_factorized, dt_dense};
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"degree_2_factorized", "degree_2_dense"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  const auto result = run(2);
+
+  return {result.timing[0], result.timing[1]};
+}
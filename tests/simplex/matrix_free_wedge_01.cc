@@ -0,0 +1,172 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the evaluation of FE_WedgeP in FEEvaluation that splits the
+// interpolation into a product on the triangle and a product in z direction:
+// compare values and gradients as well as the result of integration with
+// FEValues. Degree 1 uses the dense kernel, which is cheaper for linear
+// elements, and serves as a reference.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/fe_wedge_p.h>
+#include <deal.II/fe/mapping_fe.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+#include "./simplex_grids.h"
+
+
+void
+test(const unsigned int degree)
+{
+  constexpr int dim = 3;
+
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube_with_wedges(tria, 3);
+  GridTools::distort_random(0.1, tria);
+
+  FE_WedgeP<dim>  fe(degree);
+  MappingFE<dim>  mapping(FE_WedgeP<dim>(1));
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  const QGaussWedge<dim> quad_wedge(degree + 1);
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, quad_wedge, additional_data);
+
+  deallog << "Degree " << degree << ": factorized evaluation "
+          << std::boolalpha << !matrix_free.get_shape_info().wedge_data.empty()
+          << std::endl;
+
+  Vector<double> src(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = random_value<double>();
+
+  // compare with FEValues
+  FEEvaluation<dim, -1, 0, 1, double> phi(matrix_free, 0, 0);
+
+  FEValues<dim> fe_values(mapping,
+                          fe,
+                          quad_wedge,
+                          update_values | update_gradients |
+                            update_JxW_values);
+
+  std::vector<double>         values(quad_wedge.size());
+  std::vector<Tensor<1, dim>> gradients(quad_wedge.size());
+  double                      error_values = 0, error_gradients = 0;
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      phi.reinit(cell);
+      phi.read_dof_values(src);
+      phi.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(cell);
+           ++v)
+        {
+          fe_values.reinit(matrix_free.get_cell_iterator(cell, v));
+          fe_values.get_function_values(src, values);
+          fe_values.get_function_gradients(src, gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              error_values =
+                std::max(error_values,
+                         std::abs(phi.get_value(q)[v] - values[q]));
+              for (unsigned int d = 0; d < dim; ++d)
+                error_gradients =
+                  std::max(error_gradients,
+                           std::abs(phi.get_gradient(q)[d][v] -
+                                    gradients[q][d]));
+            }
+        }
+    }
+  deallog << "Error values " << (error_values < 1e-12 ? "OK" : "FAILED")
+          << ", error gradients " << (error_gradients < 1e-10 ? "OK" : "FAILED")
+          << std::endl;
+
+  // compare integration with FEValues, summing the results of testing by
+  // values, by gradients, and by both
+  Vector<double> dst(dof_handler.n_dofs()), dst_ref(dof_handler.n_dofs());
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    for (const EvaluationFlags::EvaluationFlags flags :
+         {EvaluationFlags::values,
+          EvaluationFlags::gradients,
+          EvaluationFlags::values | EvaluationFlags::gradients})
+      {
+        phi.reinit(cell);
+        phi.gather_evaluate(src, flags);
+        for (const unsigned int q : phi.quadrature_point_indices())
+          {
+            if (flags & EvaluationFlags::values)
+              phi.submit_value(phi.get_value(q), q);
+            if (flags & EvaluationFlags::gradients)
+              phi.submit_gradient(phi.get_gradient(q), q);
+          }
+        phi.integrate_scatter(flags, dst);
+      }
+
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      fe_values.reinit(cell);
+      fe_values.get_function_values(src, values);
+      fe_values.get_function_gradients(src, gradients);
+      cell->get_dof_indices(dof_indices);
+      for (const unsigned int i : fe_values.dof_indices())
+        for (const unsigned int q : fe_values.quadrature_point_indices())
+          dst_ref(dof_indices[i]) +=
+            2. *
+            (values[q] * fe_values.shape_value(i, q) +
+             gradients[q] * fe_values.shape_grad(i, q)) *
+            fe_values.JxW(q);
+    }
+  dst -= dst_ref;
+  deallog << "Difference of integration to FEValues "
+          << (dst.linfty_norm() < 1e-12 * dst_ref.linfty_norm() ? "OK" :
+                                                                  "FAILED")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test(1);
+  test(2);
+}